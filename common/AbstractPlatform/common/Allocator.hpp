@@ -0,0 +1,396 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Memory.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#if defined( __has_include )
+#if __has_include( <memory_resource> )
+#include <memory_resource>
+#if defined( __cpp_lib_memory_resource )
+#define ABSTRACT_PLATFORM_HAS_PMR 1
+#endif
+#endif
+#endif
+
+namespace AbstractPlatform
+{
+/**
+ * @brief The bump (linear) allocator over the caller-provided buffer.
+ *
+ * The allocation is a pointer increment, the memory is released all at once by Reset() or back
+ * to the marker taken earlier by Mark(). There is no per-allocation deallocation and no
+ * destructors are called. Not thread-safe.
+ */
+class CArena
+{
+public:
+    /// @brief The arena fill level to rewind to.
+    using TMarker = size_t;
+
+    CArena( void* aBuffer, size_t aSize )
+        : iBuffer{ static_cast< std::uint8_t* >( aBuffer ) }
+        , iSize{ aSize }
+    {
+    }
+
+    CArena( const CArena& ) = delete;
+    CArena& operator=( const CArena& ) = delete;
+
+    /**
+     * @brief Allocates aSize bytes aligned to aAlignment (a power of two).
+     *
+     * @return void* The memory, or nullptr if the arena is exhausted.
+     */
+    void*
+    Allocate( size_t aSize, size_t aAlignment = alignof( std::max_align_t ) ) NOEXCEPT
+    {
+        assert( aAlignment != 0 && ( aAlignment & ( aAlignment - 1 ) ) == 0 );
+
+        const std::uintptr_t base = reinterpret_cast< std::uintptr_t >( iBuffer );
+        const std::uintptr_t mask = static_cast< std::uintptr_t >( aAlignment - 1 );
+        const std::uintptr_t aligned = ( base + iUsed + mask ) & ~mask;
+        const size_t offset = static_cast< size_t >( aligned - base );
+        if ( offset > iSize || aSize > iSize - offset )
+        {
+            return nullptr;
+        }
+        iUsed = offset + aSize;
+        return iBuffer + offset;
+    }
+
+    /**
+     * @brief Allocates the uninitialised storage for aCount objects of taValue.
+     */
+    template < typename taValue >
+    taValue*
+    Allocate( size_t aCount = 1 ) NOEXCEPT
+    {
+        if ( aCount > iSize / sizeof( taValue ) )
+        {
+            return nullptr;
+        }
+        return static_cast< taValue* >(
+            Allocate( sizeof( taValue ) * aCount, alignof( taValue ) ) );
+    }
+
+    /// @brief Returns the current fill level.
+    TMarker
+    Mark( ) const NOEXCEPT
+    {
+        return iUsed;
+    }
+
+    /// @brief Releases everything allocated after the marker was taken.
+    void
+    Rewind( TMarker aMarker ) NOEXCEPT
+    {
+        assert( aMarker <= iUsed );
+        iUsed = aMarker;
+    }
+
+    /// @brief Releases everything.
+    void
+    Reset( ) NOEXCEPT
+    {
+        iUsed = 0;
+    }
+
+    size_t
+    Used( ) const NOEXCEPT
+    {
+        return iUsed;
+    }
+
+    /// @brief Checks if the pointer refers to the arena buffer.
+    bool
+    Owns( const void* aPointer ) const NOEXCEPT
+    {
+        const auto* pointer = static_cast< const std::uint8_t* >( aPointer );
+        return pointer >= iBuffer && pointer < iBuffer + iSize;
+    }
+
+    size_t
+    Capacity( ) const NOEXCEPT
+    {
+        return iSize;
+    }
+
+private:
+    std::uint8_t* const iBuffer;
+    const size_t iSize;
+    size_t iUsed = 0;
+};
+
+/**
+ * @brief The arena owning the statically sized buffer.
+ */
+template < size_t taSize, size_t taAlignment = alignof( std::max_align_t ) >
+class TStaticArena : public CArena
+{
+public:
+    TStaticArena( )
+        : CArena{ iStorage, taSize }
+    {
+    }
+
+private:
+    alignas( taAlignment ) std::uint8_t iStorage[ taSize ];
+};
+
+/**
+ * @brief Rewinds the arena to the level it had at the construction of the scope, releasing the
+ * temporary allocations made within the scope (e.g. the per-frame scratch).
+ */
+class CArenaScope
+{
+public:
+    explicit CArenaScope( CArena& aArena )
+        : iArena{ aArena }
+        , iMarker{ aArena.Mark( ) }
+    {
+    }
+
+    CArenaScope( const CArenaScope& ) = delete;
+    CArenaScope& operator=( const CArenaScope& ) = delete;
+
+    ~CArenaScope( )
+    {
+        iArena.Rewind( iMarker );
+    }
+
+private:
+    CArena& iArena;
+    const CArena::TMarker iMarker;
+};
+
+/**
+ * @brief The pool of the fixed-size blocks in the static storage.
+ *
+ * The free blocks form the lock-free stack (the Treiber stack). The head holds the block index
+ * together with the modification tag, so the compare-and-swap detects the head being popped and
+ * pushed back in between (the ABA problem). Allocate() and Deallocate() are O(1) and may be
+ * called from any thread.
+ *
+ * @tparam taBlockSize The block size in bytes.
+ * @tparam taBlockCount The count of the blocks.
+ * @tparam taAlignment The alignment of the blocks.
+ */
+template < size_t taBlockSize,
+           size_t taBlockCount,
+           size_t taAlignment = alignof( std::max_align_t ) >
+class TBlockPool
+{
+public:
+    static_assert( taBlockSize > 0, "taBlockSize has to be positive" );
+    static_assert( taBlockCount > 0 && taBlockCount < 0xFFFFFFFFu,
+                   "taBlockCount has to be in range [1, 2^32 - 1)" );
+    static_assert( taAlignment != 0 && ( taAlignment & ( taAlignment - 1 ) ) == 0,
+                   "taAlignment has to be a power of two" );
+
+    static constexpr size_t kBlockSize = ( taBlockSize + taAlignment - 1 ) & ~( taAlignment - 1 );
+    static constexpr size_t kBlockCount = taBlockCount;
+    static constexpr size_t kAlignment = taAlignment;
+
+    TBlockPool( )
+    {
+        for ( size_t index = 0; index < taBlockCount; ++index )
+        {
+            const std::uint32_t next
+                = index + 1 < taBlockCount ? static_cast< std::uint32_t >( index + 1 ) : kNil;
+            iNext[ index ].store( next, std::memory_order_relaxed );
+        }
+        iHead.store( 0, std::memory_order_relaxed );
+    }
+
+    TBlockPool( const TBlockPool& ) = delete;
+    TBlockPool& operator=( const TBlockPool& ) = delete;
+
+    /**
+     * @brief Takes the free block.
+     *
+     * @return void* The block, or nullptr if all the blocks are in use.
+     */
+    void*
+    Allocate( ) NOEXCEPT
+    {
+        std::uint64_t head = iHead.load( std::memory_order_acquire );
+        for ( ;; )
+        {
+            const std::uint32_t index = IndexOf( head );
+            if ( index == kNil )
+            {
+                return nullptr;
+            }
+            const std::uint32_t next = iNext[ index ].load( std::memory_order_relaxed );
+            if ( iHead.compare_exchange_weak( head,
+                                              MakeHead( head, next ),
+                                              std::memory_order_acquire,
+                                              std::memory_order_acquire ) )
+            {
+                iAvailable.fetch_sub( 1, std::memory_order_relaxed );
+                return iStorage + static_cast< size_t >( index ) * kBlockSize;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the block taken by Allocate() to the pool.
+     */
+    void
+    Deallocate( void* aBlock ) NOEXCEPT
+    {
+        assert( Owns( aBlock ) );
+
+        const auto index = static_cast< std::uint32_t >(
+            ( static_cast< std::uint8_t* >( aBlock ) - iStorage ) / kBlockSize );
+        std::uint64_t head = iHead.load( std::memory_order_relaxed );
+        do
+        {
+            iNext[ index ].store( IndexOf( head ), std::memory_order_relaxed );
+        } while ( !iHead.compare_exchange_weak(
+            head, MakeHead( head, index ), std::memory_order_release, std::memory_order_relaxed ) );
+        iAvailable.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    /// @brief Checks if the pointer refers to the block of the pool.
+    bool
+    Owns( const void* aPointer ) const NOEXCEPT
+    {
+        const auto* pointer = static_cast< const std::uint8_t* >( aPointer );
+        return pointer >= iStorage && pointer < iStorage + sizeof( iStorage )
+               && static_cast< size_t >( pointer - iStorage ) % kBlockSize == 0;
+    }
+
+    /// @brief Returns the count of the free blocks. Approximate while the pool is in use.
+    size_t
+    Available( ) const NOEXCEPT
+    {
+        return iAvailable.load( std::memory_order_relaxed );
+    }
+
+private:
+    static constexpr std::uint32_t kNil = 0xFFFFFFFFu;
+
+    static constexpr std::uint32_t
+    IndexOf( std::uint64_t aHead ) NOEXCEPT
+    {
+        return static_cast< std::uint32_t >( aHead );
+    }
+
+    static constexpr std::uint64_t
+    MakeHead( std::uint64_t aPreviousHead, std::uint32_t aIndex ) NOEXCEPT
+    {
+        return ( ( ( aPreviousHead >> 32 ) + 1 ) << 32 ) | aIndex;
+    }
+
+    alignas( taAlignment ) std::uint8_t iStorage[ kBlockSize * taBlockCount ];
+    std::atomic< std::uint32_t > iNext[ taBlockCount ];
+    alignas( KCacheLineSize ) std::atomic< std::uint64_t > iHead;
+    std::atomic< size_t > iAvailable{ taBlockCount };
+};
+
+#if defined( ABSTRACT_PLATFORM_HAS_PMR )
+/**
+ * @brief The std::pmr::memory_resource allocating from the CArena. The deallocation is a no-op,
+ * the memory is reclaimed by the arena Reset() or Rewind(). The requests the arena cannot
+ * satisfy are forwarded to the upstream resource, which throws std::bad_alloc by default.
+ */
+class CArenaResource : public std::pmr::memory_resource
+{
+public:
+    explicit CArenaResource(
+        CArena& aArena,
+        std::pmr::memory_resource* aUpstream = std::pmr::null_memory_resource( ) )
+        : iArena{ aArena }
+        , iUpstream{ aUpstream }
+    {
+    }
+
+private:
+    void*
+    do_allocate( size_t aBytes, size_t aAlignment ) override
+    {
+        void* memory = iArena.Allocate( aBytes, aAlignment );
+        return memory != nullptr ? memory : iUpstream->allocate( aBytes, aAlignment );
+    }
+
+    void
+    do_deallocate( void* aPointer, size_t aBytes, size_t aAlignment ) override
+    {
+        if ( !iArena.Owns( aPointer ) )
+        {
+            iUpstream->deallocate( aPointer, aBytes, aAlignment );
+        }
+    }
+
+    bool
+    do_is_equal( const std::pmr::memory_resource& aOther ) const noexcept override
+    {
+        return this == &aOther;
+    }
+
+    CArena& iArena;
+    std::pmr::memory_resource* const iUpstream;
+};
+
+/**
+ * @brief The std::pmr::memory_resource allocating from the TBlockPool. The requests that do not
+ * fit the block (size or alignment) or arrive when the pool is exhausted are forwarded to the
+ * upstream resource, which throws std::bad_alloc by default.
+ */
+template < typename taPool >
+class TPoolResource : public std::pmr::memory_resource
+{
+public:
+    explicit TPoolResource(
+        taPool& aPool, std::pmr::memory_resource* aUpstream = std::pmr::null_memory_resource( ) )
+        : iPool{ aPool }
+        , iUpstream{ aUpstream }
+    {
+    }
+
+private:
+    void*
+    do_allocate( size_t aBytes, size_t aAlignment ) override
+    {
+        if ( aBytes <= taPool::kBlockSize && aAlignment <= taPool::kAlignment )
+        {
+            void* block = iPool.Allocate( );
+            if ( block != nullptr )
+            {
+                return block;
+            }
+        }
+        return iUpstream->allocate( aBytes, aAlignment );
+    }
+
+    void
+    do_deallocate( void* aPointer, size_t aBytes, size_t aAlignment ) override
+    {
+        if ( iPool.Owns( aPointer ) )
+        {
+            iPool.Deallocate( aPointer );
+        }
+        else
+        {
+            iUpstream->deallocate( aPointer, aBytes, aAlignment );
+        }
+    }
+
+    bool
+    do_is_equal( const std::pmr::memory_resource& aOther ) const noexcept override
+    {
+        return this == &aOther;
+    }
+
+    taPool& iPool;
+    std::pmr::memory_resource* const iUpstream;
+};
+#endif
+
+}  // namespace AbstractPlatform
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace AbstractPlatform
+{
+/**
+ * @brief The single-use countdown: the waiting threads are released once the counter reaches 0.
+ */
+class CLatch
+{
+public:
+    explicit CLatch( size_t aCount )
+        : iCount{ aCount }
+    {
+    }
+
+    CLatch( const CLatch& ) = delete;
+    CLatch& operator=( const CLatch& ) = delete;
+
+    /**
+     * @brief Decrements the counter, releasing the waiting threads when it reaches 0.
+     */
+    void
+    CountDown( ) NOEXCEPT
+    {
+        std::lock_guard< std::mutex > lock{ iMutex };
+        if ( iCount > 0 && --iCount == 0 )
+        {
+            iReleased.notify_all( );
+        }
+    }
+
+    /**
+     * @brief Blocks until the counter reaches 0.
+     */
+    void
+    Wait( ) NOEXCEPT
+    {
+        std::unique_lock< std::mutex > lock{ iMutex };
+        iReleased.wait( lock, [ this ]( ) { return iCount == 0; } );
+    }
+
+private:
+    std::mutex iMutex;
+    std::condition_variable iReleased;
+    size_t iCount;
+};
+
+/**
+ * @brief The reusable barrier: every participant blocks in ArriveAndWait() until all the
+ * participants have arrived, then all of them are released and the barrier starts over.
+ */
+class CBarrier
+{
+public:
+    explicit CBarrier( size_t aParticipants )
+        : iParticipants{ aParticipants }
+    {
+    }
+
+    CBarrier( const CBarrier& ) = delete;
+    CBarrier& operator=( const CBarrier& ) = delete;
+
+    /**
+     * @brief Blocks until all the participants have arrived.
+     *
+     * @return true For exactly one participant of every phase (the last to arrive), which may be
+     * used to elect the participant doing the per-phase work.
+     */
+    bool
+    ArriveAndWait( ) NOEXCEPT
+    {
+        std::unique_lock< std::mutex > lock{ iMutex };
+        const size_t phase = iPhase;
+        if ( ++iArrived == iParticipants )
+        {
+            iArrived = 0;
+            ++iPhase;
+            iReleased.notify_all( );
+            return true;
+        }
+        iReleased.wait( lock, [ this, phase ]( ) { return iPhase != phase; } );
+        return false;
+    }
+
+private:
+    std::mutex iMutex;
+    std::condition_variable iReleased;
+    const size_t iParticipants;
+    size_t iArrived = 0;
+    size_t iPhase = 0;
+};
+
+}  // namespace AbstractPlatform
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
+
 namespace AbstractPlatform
 {
 
@@ -30,4 +33,66 @@ CheckBit( taValue aValue, size_t aBitIndex )
 {
     return static_cast< bool >( ( aValue >> aBitIndex ) & taValue{ 1 } );
 }
+
+/**
+ * @brief Returns the count of the set bits of the unsigned value.
+ */
+template < typename taValue >
+static constexpr inline size_t
+PopCount( taValue aValue )
+{
+    static_assert( std::is_unsigned< taValue >::value, "taValue has to be unsigned" );
+#if defined( __GNUC__ )
+    if constexpr ( sizeof( taValue ) <= sizeof( unsigned int ) )
+    {
+        return static_cast< size_t >( __builtin_popcount( aValue ) );
+    }
+    else if constexpr ( sizeof( taValue ) <= sizeof( unsigned long ) )
+    {
+        return static_cast< size_t >( __builtin_popcountl( aValue ) );
+    }
+    else
+    {
+        return static_cast< size_t >( __builtin_popcountll( aValue ) );
+    }
+#else
+    size_t count = 0;
+    for ( ; aValue != 0; aValue &= static_cast< taValue >( aValue - 1 ) )
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Returns the index of the lowest set bit of the unsigned value. The value must not be 0.
+ */
+template < typename taValue >
+static constexpr inline size_t
+CountTrailingZeros( taValue aValue )
+{
+    static_assert( std::is_unsigned< taValue >::value, "taValue has to be unsigned" );
+#if defined( __GNUC__ )
+    if constexpr ( sizeof( taValue ) <= sizeof( unsigned int ) )
+    {
+        return static_cast< size_t >( __builtin_ctz( aValue ) );
+    }
+    else if constexpr ( sizeof( taValue ) <= sizeof( unsigned long ) )
+    {
+        return static_cast< size_t >( __builtin_ctzl( aValue ) );
+    }
+    else
+    {
+        return static_cast< size_t >( __builtin_ctzll( aValue ) );
+    }
+#else
+    size_t count = 0;
+    for ( ; ( aValue & taValue{ 1 } ) == 0; aValue >>= 1 )
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
 }  // namespace AbstractPlatform
\ No newline at end of file
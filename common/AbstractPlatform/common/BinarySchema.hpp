@@ -0,0 +1,290 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/TypeBinaryRepresentation.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace AbstractPlatform
+{
+/**
+ * @brief The scalar field of the binary record.
+ *
+ * @tparam taValue The trivially copyable scalar type of the field (integral, enumeration or
+ * floating point).
+ * @tparam taEndianness The byte order of the field in the record.
+ */
+template < typename taValue, Endianness taEndianness = Endianness::Little >
+struct TSchemaField
+{
+    static_assert( std::is_arithmetic< taValue >::value || std::is_enum< taValue >::value,
+                   "taValue has to be an arithmetic or enumeration type" );
+
+    using TValue = taValue;
+    static constexpr size_t kSize = sizeof( taValue );
+
+    static inline TValue
+    Read( const std::uint8_t* aData ) NOEXCEPT
+    {
+        TValue value;
+        std::memcpy( &value, aData, kSize );
+        return EndiannessConverter< Endianness::Native, taEndianness >::Convert( value );
+    }
+
+    static inline void
+    Write( std::uint8_t* aData, TValue aValue ) NOEXCEPT
+    {
+        const TValue value
+            = EndiannessConverter< taEndianness, Endianness::Native >::Convert( aValue );
+        std::memcpy( aData, &value, kSize );
+    }
+};
+
+/**
+ * @brief The raw byte array field of the binary record (e.g. the identifier or the payload).
+ * Read returns the pointer to the bytes in the record.
+ */
+template < size_t taSize >
+struct TSchemaBytes
+{
+    using TValue = const std::uint8_t*;
+    static constexpr size_t kSize = taSize;
+
+    static constexpr inline TValue
+    Read( const std::uint8_t* aData ) NOEXCEPT
+    {
+        return aData;
+    }
+
+    static inline void
+    Write( std::uint8_t* aData, TValue aValue ) NOEXCEPT
+    {
+        std::memcpy( aData, aValue, kSize );
+    }
+};
+
+/**
+ * @brief The bytes of the binary record with no value (reserved fields, alignment). The writer
+ * fills them with zeroes.
+ */
+template < size_t taSize >
+struct TSchemaPadding
+{
+    static constexpr size_t kSize = taSize;
+};
+
+namespace Detail
+{
+template < size_t taIndex, typename taField, typename... taFields >
+struct TSchemaFieldAt
+{
+    using TField = typename TSchemaFieldAt< taIndex - 1, taFields... >::TField;
+    static constexpr size_t kOffset
+        = taField::kSize + TSchemaFieldAt< taIndex - 1, taFields... >::kOffset;
+};
+
+template < typename taField, typename... taFields >
+struct TSchemaFieldAt< 0, taField, taFields... >
+{
+    using TField = taField;
+    static constexpr size_t kOffset = 0;
+};
+
+template < typename taField >
+struct TIsSchemaPadding : std::false_type
+{
+};
+
+template < size_t taSize >
+struct TIsSchemaPadding< TSchemaPadding< taSize > > : std::true_type
+{
+};
+}  // namespace Detail
+
+/**
+ * @brief The compile-time layout of the packed binary record: the fields follow each other
+ * without gaps in the declaration order.
+ *
+ * The CView reads the fields straight from the record bytes and the CWriter encodes them
+ * straight into the caller buffer. Both are created by the functions checking the buffer length
+ * once per record, so the field accessors do no checks. The field offsets are compile-time
+ * constants.
+ *
+ * Example:
+ * @code
+ * using TFrame = TRecordSchema< TSchemaField< std::uint16_t, Endianness::Big >,
+ *                               TSchemaPadding< 2 >,
+ *                               TSchemaField< float > >;
+ * enum { kSequence = 0, kTemperature = 2 };
+ *
+ * TFrame::CView frame;
+ * if ( TFrame::View( buffer, length, frame ) )
+ * {
+ *     const float temperature = frame.Get< kTemperature >( );
+ * }
+ * @endcode
+ *
+ * @tparam taFields The fields: TSchemaField, TSchemaBytes or TSchemaPadding.
+ */
+template < typename... taFields >
+class TRecordSchema
+{
+public:
+    static_assert( sizeof...( taFields ) > 0, "The record has to have fields" );
+
+    /// @brief The record size in bytes.
+    static constexpr size_t kSize = ( taFields::kSize + ... );
+    static constexpr size_t kFieldCount = sizeof...( taFields );
+    static_assert( kSize > 0, "The record has to occupy at least one byte" );
+
+    template < size_t taIndex >
+    using TField = typename Detail::TSchemaFieldAt< taIndex, taFields... >::TField;
+
+    template < size_t taIndex >
+    static constexpr size_t kOffset = Detail::TSchemaFieldAt< taIndex, taFields... >::kOffset;
+
+    /// @brief The read-only view of the record bytes.
+    class CView
+    {
+    public:
+        CView( ) = default;
+
+        template < size_t taIndex >
+        typename TField< taIndex >::TValue
+        Get( ) const NOEXCEPT
+        {
+            static_assert( !Detail::TIsSchemaPadding< TField< taIndex > >::value,
+                           "The padding has no value" );
+            return TField< taIndex >::Read( iData + kOffset< taIndex > );
+        }
+
+        const std::uint8_t*
+        Data( ) const NOEXCEPT
+        {
+            return iData;
+        }
+
+    private:
+        friend class TRecordSchema;
+
+        explicit CView( const std::uint8_t* aData )
+            : iData{ aData }
+        {
+        }
+
+        const std::uint8_t* iData = nullptr;
+    };
+
+    /// @brief The encoder of the record into the caller buffer.
+    class CWriter
+    {
+    public:
+        CWriter( ) = default;
+
+        template < size_t taIndex >
+        CWriter&
+        Set( typename TField< taIndex >::TValue aValue ) NOEXCEPT
+        {
+            static_assert( !Detail::TIsSchemaPadding< TField< taIndex > >::value,
+                           "The padding has no value" );
+            TField< taIndex >::Write( iData + kOffset< taIndex >, aValue );
+            return *this;
+        }
+
+        std::uint8_t*
+        Data( ) const NOEXCEPT
+        {
+            return iData;
+        }
+
+    private:
+        friend class TRecordSchema;
+
+        explicit CWriter( std::uint8_t* aData )
+            : iData{ aData }
+        {
+        }
+
+        std::uint8_t* iData = nullptr;
+    };
+
+    /**
+     * @brief Creates the view of the record located at the start of the buffer.
+     *
+     * @return true If the buffer holds the whole record, otherwise - false
+     */
+    static inline bool
+    View( const std::uint8_t* aBuffer, size_t aLength, CView& aView ) NOEXCEPT
+    {
+        if ( aBuffer == nullptr || aLength < kSize )
+        {
+            return false;
+        }
+        aView = CView{ aBuffer };
+        return true;
+    }
+
+    /**
+     * @brief Creates the view of the record aIndex of the buffer holding the array of records.
+     *
+     * @return true If the buffer holds the whole record, otherwise - false
+     */
+    static inline bool
+    ViewAt( const std::uint8_t* aBuffer, size_t aLength, size_t aIndex, CView& aView ) NOEXCEPT
+    {
+        if ( aIndex >= Count( aLength ) )
+        {
+            return false;
+        }
+        return View( aBuffer + aIndex * kSize, kSize, aView );
+    }
+
+    /**
+     * @brief Returns the count of the whole records the buffer of aLength bytes holds.
+     */
+    static constexpr size_t
+    Count( size_t aLength ) NOEXCEPT
+    {
+        return aLength / kSize;
+    }
+
+    /**
+     * @brief Creates the writer of the record at the start of the buffer and zeroes the padding.
+     *
+     * @return true If the buffer has room for the whole record, otherwise - false
+     */
+    static inline bool
+    Writer( std::uint8_t* aBuffer, size_t aLength, CWriter& aWriter ) NOEXCEPT
+    {
+        if ( aBuffer == nullptr || aLength < kSize )
+        {
+            return false;
+        }
+        ClearPadding( aBuffer, std::make_index_sequence< kFieldCount >{ } );
+        aWriter = CWriter{ aBuffer };
+        return true;
+    }
+
+private:
+    template < size_t... taIndices >
+    static inline void
+    ClearPadding( std::uint8_t* aBuffer, std::index_sequence< taIndices... > ) NOEXCEPT
+    {
+        ( ClearPaddingAt< taIndices >( aBuffer ), ... );
+    }
+
+    template < size_t taIndex >
+    static inline void
+    ClearPaddingAt( std::uint8_t* aBuffer ) NOEXCEPT
+    {
+        if constexpr ( Detail::TIsSchemaPadding< TField< taIndex > >::value )
+        {
+            std::memset( aBuffer + kOffset< taIndex >, 0, TField< taIndex >::kSize );
+        }
+    }
+};
+
+}  // namespace AbstractPlatform
@@ -0,0 +1,474 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/BinaryOperations.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace AbstractPlatform
+{
+/// @brief The machine word the bit arrays are stored in.
+using TBitWord = std::uintptr_t;
+
+/// @brief The count of the bits of the TBitWord.
+static constexpr size_t KBitWordBits = 8 * sizeof( TBitWord );
+
+/// @brief Returns the count of the words holding aBitCount bits.
+static constexpr inline size_t
+BitWordCount( size_t aBitCount )
+{
+    return ( aBitCount + KBitWordBits - 1 ) / KBitWordBits;
+}
+
+/**
+ * @brief The operations of the bit arrays working on whole words.
+ *
+ * The bit i is the bit ( i % KBitWordBits ) of the word ( i / KBitWordBits ). The bits of the
+ * last word past the array size are kept clear. The word loops have no dependencies between the
+ * iterations, so the compiler vectorises them for the large arrays.
+ *
+ * @tparam taDerived The array type providing Words() and Size().
+ */
+template < typename taDerived >
+class TBitArrayBase
+{
+public:
+    /// @brief Returns the count of the words holding the bits.
+    size_t
+    WordCount( ) const NOEXCEPT
+    {
+        return BitWordCount( Size( ) );
+    }
+
+    bool
+    Test( size_t aIndex ) const NOEXCEPT
+    {
+        assert( aIndex < Size( ) );
+        return CheckBit( Words( )[ aIndex / KBitWordBits ], aIndex % KBitWordBits );
+    }
+
+    taDerived&
+    Set( size_t aIndex ) NOEXCEPT
+    {
+        assert( aIndex < Size( ) );
+        auto& word = Words( )[ aIndex / KBitWordBits ];
+        word = SetBit( word, aIndex % KBitWordBits );
+        return Self( );
+    }
+
+    taDerived&
+    Clear( size_t aIndex ) NOEXCEPT
+    {
+        assert( aIndex < Size( ) );
+        auto& word = Words( )[ aIndex / KBitWordBits ];
+        word = ClearBit( word, aIndex % KBitWordBits );
+        return Self( );
+    }
+
+    taDerived&
+    Toggle( size_t aIndex ) NOEXCEPT
+    {
+        assert( aIndex < Size( ) );
+        auto& word = Words( )[ aIndex / KBitWordBits ];
+        word = ToggleBit( word, aIndex % KBitWordBits );
+        return Self( );
+    }
+
+    /**
+     * @brief Sets aCount bits starting from aFirst.
+     */
+    taDerived&
+    SetRange( size_t aFirst, size_t aCount ) NOEXCEPT
+    {
+        ForRange( aFirst, aCount, []( TBitWord& aWord, TBitWord aMask ) { aWord |= aMask; } );
+        return Self( );
+    }
+
+    /**
+     * @brief Clears aCount bits starting from aFirst.
+     */
+    taDerived&
+    ClearRange( size_t aFirst, size_t aCount ) NOEXCEPT
+    {
+        ForRange( aFirst, aCount, []( TBitWord& aWord, TBitWord aMask ) { aWord &= ~aMask; } );
+        return Self( );
+    }
+
+    taDerived&
+    SetAll( ) NOEXCEPT
+    {
+        TBitWord* words = Words( );
+        for ( size_t index = 0; index < WordCount( ); ++index )
+        {
+            words[ index ] = ~TBitWord{ 0 };
+        }
+        ClearTail( );
+        return Self( );
+    }
+
+    taDerived&
+    ClearAll( ) NOEXCEPT
+    {
+        TBitWord* words = Words( );
+        for ( size_t index = 0; index < WordCount( ); ++index )
+        {
+            words[ index ] = 0;
+        }
+        return Self( );
+    }
+
+    /// @brief Returns the count of the set bits.
+    size_t
+    Count( ) const NOEXCEPT
+    {
+        const TBitWord* words = Words( );
+        size_t count = 0;
+        for ( size_t index = 0; index < WordCount( ); ++index )
+        {
+            count += PopCount( words[ index ] );
+        }
+        return count;
+    }
+
+    bool
+    Any( ) const NOEXCEPT
+    {
+        return FindFirstSet( ) != Size( );
+    }
+
+    bool
+    None( ) const NOEXCEPT
+    {
+        return !Any( );
+    }
+
+    /**
+     * @brief Returns the index of the first set bit, Size() if there is none.
+     */
+    size_t
+    FindFirstSet( ) const NOEXCEPT
+    {
+        return FindNextSet( 0 );
+    }
+
+    /**
+     * @brief Returns the index of the first set bit at or after aFrom, Size() if there is none.
+     */
+    size_t
+    FindNextSet( size_t aFrom ) const NOEXCEPT
+    {
+        if ( aFrom >= Size( ) )
+        {
+            return Size( );
+        }
+        const TBitWord* words = Words( );
+        size_t index = aFrom / KBitWordBits;
+        TBitWord word = words[ index ] & ( ~TBitWord{ 0 } << ( aFrom % KBitWordBits ) );
+        while ( word == 0 )
+        {
+            if ( ++index == WordCount( ) )
+            {
+                return Size( );
+            }
+            word = words[ index ];
+        }
+        return index * KBitWordBits + CountTrailingZeros( word );
+    }
+
+    /// @brief this &= aOther. The bits past the end of the shorter aOther are cleared.
+    template < typename taOther >
+    taDerived&
+    And( const TBitArrayBase< taOther >& aOther ) NOEXCEPT
+    {
+        Combine( aOther, []( TBitWord aLeft, TBitWord aRight ) { return aLeft & aRight; } );
+        TBitWord* words = Words( );
+        for ( size_t index = aOther.WordCount( ); index < WordCount( ); ++index )
+        {
+            words[ index ] = 0;
+        }
+        return Self( );
+    }
+
+    /// @brief this |= aOther over the common words.
+    template < typename taOther >
+    taDerived&
+    Or( const TBitArrayBase< taOther >& aOther ) NOEXCEPT
+    {
+        return Combine( aOther, []( TBitWord aLeft, TBitWord aRight ) { return aLeft | aRight; } );
+    }
+
+    /// @brief this ^= aOther over the common words.
+    template < typename taOther >
+    taDerived&
+    Xor( const TBitArrayBase< taOther >& aOther ) NOEXCEPT
+    {
+        return Combine( aOther, []( TBitWord aLeft, TBitWord aRight ) { return aLeft ^ aRight; } );
+    }
+
+    /// @brief this &= ~aOther over the common words.
+    template < typename taOther >
+    taDerived&
+    AndNot( const TBitArrayBase< taOther >& aOther ) NOEXCEPT
+    {
+        return Combine( aOther,
+                        []( TBitWord aLeft, TBitWord aRight ) { return aLeft & ~aRight; } );
+    }
+
+    /**
+     * @brief Moves every bit i to i + aShift. The bits shifted past the end are lost, the
+     * vacated bits are cleared.
+     */
+    taDerived&
+    ShiftUp( size_t aShift ) NOEXCEPT
+    {
+        if ( aShift >= Size( ) )
+        {
+            return ClearAll( );
+        }
+        TBitWord* words = Words( );
+        const size_t wordShift = aShift / KBitWordBits;
+        const size_t bitShift = aShift % KBitWordBits;
+        for ( size_t index = WordCount( ); index-- > wordShift; )
+        {
+            const size_t source = index - wordShift;
+            TBitWord word = words[ source ] << bitShift;
+            if ( bitShift != 0 && source > 0 )
+            {
+                word |= words[ source - 1 ] >> ( KBitWordBits - bitShift );
+            }
+            words[ index ] = word;
+        }
+        for ( size_t index = 0; index < wordShift; ++index )
+        {
+            words[ index ] = 0;
+        }
+        ClearTail( );
+        return Self( );
+    }
+
+    /**
+     * @brief Moves every bit i to i - aShift. The bits shifted below 0 are lost, the vacated
+     * bits are cleared.
+     */
+    taDerived&
+    ShiftDown( size_t aShift ) NOEXCEPT
+    {
+        if ( aShift >= Size( ) )
+        {
+            return ClearAll( );
+        }
+        TBitWord* words = Words( );
+        const size_t wordCount = WordCount( );
+        const size_t wordShift = aShift / KBitWordBits;
+        const size_t bitShift = aShift % KBitWordBits;
+        for ( size_t index = 0; index + wordShift < wordCount; ++index )
+        {
+            const size_t source = index + wordShift;
+            TBitWord word = words[ source ] >> bitShift;
+            if ( bitShift != 0 && source + 1 < wordCount )
+            {
+                word |= words[ source + 1 ] << ( KBitWordBits - bitShift );
+            }
+            words[ index ] = word;
+        }
+        for ( size_t index = wordCount - wordShift; index < wordCount; ++index )
+        {
+            words[ index ] = 0;
+        }
+        return Self( );
+    }
+
+    template < typename taOther >
+    bool
+    operator==( const TBitArrayBase< taOther >& aOther ) const NOEXCEPT
+    {
+        if ( Size( ) != aOther.Size( ) )
+        {
+            return false;
+        }
+        const TBitWord* words = Words( );
+        const TBitWord* otherWords = aOther.Words( );
+        for ( size_t index = 0; index < WordCount( ); ++index )
+        {
+            if ( words[ index ] != otherWords[ index ] )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template < typename taOther >
+    bool
+    operator!=( const TBitArrayBase< taOther >& aOther ) const NOEXCEPT
+    {
+        return !( *this == aOther );
+    }
+
+    size_t
+    Size( ) const NOEXCEPT
+    {
+        return static_cast< const taDerived& >( *this ).Size( );
+    }
+
+    TBitWord*
+    Words( ) NOEXCEPT
+    {
+        return static_cast< taDerived& >( *this ).Words( );
+    }
+
+    const TBitWord*
+    Words( ) const NOEXCEPT
+    {
+        return static_cast< const taDerived& >( *this ).Words( );
+    }
+
+private:
+    taDerived&
+    Self( ) NOEXCEPT
+    {
+        return static_cast< taDerived& >( *this );
+    }
+
+    static constexpr TBitWord
+    LowMask( size_t aBitCount ) NOEXCEPT
+    {
+        return aBitCount >= KBitWordBits ? ~TBitWord{ 0 }
+                                         : ( TBitWord{ 1 } << aBitCount ) - TBitWord{ 1 };
+    }
+
+    void
+    ClearTail( ) NOEXCEPT
+    {
+        const size_t tailBits = Size( ) % KBitWordBits;
+        if ( tailBits != 0 )
+        {
+            Words( )[ WordCount( ) - 1 ] &= LowMask( tailBits );
+        }
+    }
+
+    template < typename taApply >
+    void
+    ForRange( size_t aFirst, size_t aCount, taApply aApply ) NOEXCEPT
+    {
+        assert( aFirst <= Size( ) && aCount <= Size( ) - aFirst );
+        if ( aCount == 0 )
+        {
+            return;
+        }
+        TBitWord* words = Words( );
+        const size_t end = aFirst + aCount;
+        const size_t firstWord = aFirst / KBitWordBits;
+        const size_t lastWord = ( end - 1 ) / KBitWordBits;
+        const size_t firstBit = aFirst % KBitWordBits;
+        if ( firstWord == lastWord )
+        {
+            aApply( words[ firstWord ], LowMask( aCount ) << firstBit );
+            return;
+        }
+        aApply( words[ firstWord ], ~TBitWord{ 0 } << firstBit );
+        for ( size_t index = firstWord + 1; index < lastWord; ++index )
+        {
+            aApply( words[ index ], ~TBitWord{ 0 } );
+        }
+        aApply( words[ lastWord ], LowMask( end - lastWord * KBitWordBits ) );
+    }
+
+    template < typename taOther, typename taOperation >
+    taDerived&
+    Combine( const TBitArrayBase< taOther >& aOther, taOperation aOperation ) NOEXCEPT
+    {
+        TBitWord* words = Words( );
+        const TBitWord* otherWords = aOther.Words( );
+        const size_t wordCount
+            = WordCount( ) < aOther.WordCount( ) ? WordCount( ) : aOther.WordCount( );
+        for ( size_t index = 0; index < wordCount; ++index )
+        {
+            words[ index ] = aOperation( words[ index ], otherWords[ index ] );
+        }
+        ClearTail( );
+        return Self( );
+    }
+};
+
+/**
+ * @brief The bit array over the caller-provided words, e.g. the dirty map of the framebuffer
+ * kept in the static memory. The caller keeps the bits past aBitCount in the last word clear.
+ */
+class CBitSpan : public TBitArrayBase< CBitSpan >
+{
+public:
+    CBitSpan( TBitWord* aWords, size_t aBitCount )
+        : iWords{ aWords }
+        , iSize{ aBitCount }
+    {
+    }
+
+    size_t
+    Size( ) const NOEXCEPT
+    {
+        return iSize;
+    }
+
+    TBitWord*
+    Words( ) NOEXCEPT
+    {
+        return iWords;
+    }
+
+    const TBitWord*
+    Words( ) const NOEXCEPT
+    {
+        return iWords;
+    }
+
+private:
+    TBitWord* iWords;
+    size_t iSize;
+};
+
+/**
+ * @brief The bit array of the compile-time size. All the bits are clear on the construction.
+ *
+ * @tparam taBitCount The count of the bits.
+ */
+template < size_t taBitCount >
+class TBitArray : public TBitArrayBase< TBitArray< taBitCount > >
+{
+public:
+    static_assert( taBitCount > 0, "taBitCount has to be positive" );
+
+    static constexpr size_t kWordCount = BitWordCount( taBitCount );
+
+    static constexpr size_t
+    Size( ) NOEXCEPT
+    {
+        return taBitCount;
+    }
+
+    TBitWord*
+    Words( ) NOEXCEPT
+    {
+        return iWords;
+    }
+
+    const TBitWord*
+    Words( ) const NOEXCEPT
+    {
+        return iWords;
+    }
+
+    /// @brief Returns the span over the array words.
+    CBitSpan
+    Span( ) NOEXCEPT
+    {
+        return CBitSpan{ iWords, taBitCount };
+    }
+
+private:
+    TBitWord iWords[ kWordCount ] = { };
+};
+
+}  // namespace AbstractPlatform
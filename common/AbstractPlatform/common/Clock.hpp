@@ -0,0 +1,74 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace AbstractPlatform
+{
+/// @brief The time point or the duration, expressed in nanoseconds.
+using TNanoseconds = std::uint64_t;
+
+/**
+ * @brief The monotonic clock backed by the std::chrono::steady_clock.
+ *
+ * Every component expecting a clock accepts any class providing the same Now() member, so the
+ * platform timer or the virtual time of a simulator may be used instead. The wall clocks the
+ * caller can wait on also provide SleepUntil() (see KClockCanSleep); the virtual clocks do not,
+ * as their time does not pass while the caller sleeps.
+ */
+struct CSteadyClock
+{
+    /**
+     * @brief Returns the current monotonic time.
+     *
+     * @return TNanoseconds The time elapsed since an unspecified epoch.
+     */
+    inline TNanoseconds
+    Now( ) const NOEXCEPT
+    {
+        return static_cast< TNanoseconds >(
+            std::chrono::duration_cast< std::chrono::nanoseconds >(
+                std::chrono::steady_clock::now( ).time_since_epoch( ) )
+                .count( ) );
+    }
+
+    /**
+     * @brief Blocks the calling thread until Now() reaches the time point.
+     *
+     * @param aTime The time point returned by Now() plus the wait duration.
+     */
+    inline void
+    SleepUntil( TNanoseconds aTime ) const NOEXCEPT
+    {
+        for ( TNanoseconds now = Now( ); now < aTime; now = Now( ) )
+        {
+            std::this_thread::sleep_for( std::chrono::nanoseconds( aTime - now ) );
+        }
+    }
+};
+
+namespace Detail
+{
+template < typename taClock, typename = void >
+struct TClockCanSleep : std::false_type
+{
+};
+
+template < typename taClock >
+struct TClockCanSleep<
+    taClock,
+    std::void_t< decltype( std::declval< const taClock& >( ).SleepUntil( TNanoseconds{ } ) ) > >
+    : std::true_type
+{
+};
+}  // namespace Detail
+
+/// @brief True if the clock provides SleepUntil( TNanoseconds ), i.e. it is a wall clock.
+template < typename taClock >
+inline constexpr bool KClockCanSleep = Detail::TClockCanSleep< taClock >::value;
+}  // namespace AbstractPlatform
@@ -0,0 +1,147 @@
+#pragma once
+#include <AbstractPlatform/common/Platform.hpp>
+
+#include <cstddef>
+
+namespace AbstractPlatform
+{
+/**
+ * The elementary functions usable in the constant expressions, for generating the lookup tables
+ * at build time (see LookupTable.hpp). They are accurate to a few ulp over the ranges the tables
+ * use, but slow: do not call them at run time.
+ */
+
+static constexpr double KPi = 3.14159265358979323846;
+static constexpr double KLn2 = 0.69314718055994530942;
+
+/**
+ * @brief Returns the square root of the non-negative value, 0 for the negative one.
+ */
+constexpr double
+ConstexprSqrt( double aValue ) NOEXCEPT
+{
+    if ( !( aValue > 0 ) )
+    {
+        return 0;
+    }
+
+    double root = aValue > 1 ? aValue : 1;
+    for ( size_t iteration = 0; iteration < 128; ++iteration )
+    {
+        const double next = 0.5 * ( root + aValue / root );
+        if ( next >= root )
+        {
+            break;
+        }
+        root = next;
+    }
+    return root;
+}
+
+/**
+ * @brief Returns the sine of the angle in radians.
+ */
+constexpr double
+ConstexprSin( double aRadians ) NOEXCEPT
+{
+    // Reduce to [-pi, pi] and sum the Taylor series.
+    const double turns = aRadians / ( 2 * KPi );
+    const long long nearestTurn
+        = static_cast< long long >( turns < 0 ? turns - 0.5 : turns + 0.5 );
+    const double x = aRadians - 2 * KPi * static_cast< double >( nearestTurn );
+
+    double term = x;
+    double sum = x;
+    for ( int n = 1; n < 30; ++n )
+    {
+        term *= -x * x / ( ( 2 * n ) * ( 2 * n + 1 ) );
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief Returns the cosine of the angle in radians.
+ */
+constexpr double
+ConstexprCos( double aRadians ) NOEXCEPT
+{
+    return ConstexprSin( aRadians + KPi / 2 );
+}
+
+/**
+ * @brief Returns e raised to the power.
+ */
+constexpr double
+ConstexprExp( double aPower ) NOEXCEPT
+{
+    // e^x = 2^k * e^r with |r| <= ln2 / 2.
+    const double twos = aPower / KLn2;
+    const long long k = static_cast< long long >( twos < 0 ? twos - 0.5 : twos + 0.5 );
+    const double r = aPower - static_cast< double >( k ) * KLn2;
+
+    double term = 1;
+    double sum = 1;
+    for ( int n = 1; n < 25; ++n )
+    {
+        term *= r / n;
+        sum += term;
+    }
+
+    const double base = k < 0 ? 0.5 : 2.0;
+    for ( long long i = 0; i < ( k < 0 ? -k : k ); ++i )
+    {
+        sum *= base;
+    }
+    return sum;
+}
+
+/**
+ * @brief Returns the natural logarithm of the positive value, 0 for the non-positive one.
+ */
+constexpr double
+ConstexprLog( double aValue ) NOEXCEPT
+{
+    if ( !( aValue > 0 ) )
+    {
+        return 0;
+    }
+
+    // ln(x) = e * ln2 + ln(m) with m in [1, 2), ln(m) = 2 * atanh((m - 1) / (m + 1)).
+    int exponent = 0;
+    double mantissa = aValue;
+    while ( mantissa >= 2 )
+    {
+        mantissa /= 2;
+        ++exponent;
+    }
+    while ( mantissa < 1 )
+    {
+        mantissa *= 2;
+        --exponent;
+    }
+
+    const double y = ( mantissa - 1 ) / ( mantissa + 1 );
+    double power = y;
+    double sum = 0;
+    for ( int n = 1; n < 80; n += 2 )
+    {
+        sum += power / n;
+        power *= y * y;
+    }
+    return exponent * KLn2 + 2 * sum;
+}
+
+/**
+ * @brief Returns the non-negative base raised to the power.
+ */
+constexpr double
+ConstexprPow( double aBase, double aPower ) NOEXCEPT
+{
+    if ( !( aBase > 0 ) )
+    {
+        return aPower == 0 ? 1 : 0;
+    }
+    return ConstexprExp( aPower * ConstexprLog( aBase ) );
+}
+}  // namespace AbstractPlatform
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace AbstractPlatform
+{
+namespace Detail
+{
+template < typename taValue, taValue taPolynomial, bool taReflected >
+struct TCrcTableBuilder
+{
+    using TValue = taValue;
+    static constexpr size_t kWidth = 8 * sizeof( TValue );
+    static constexpr size_t kSlices = 4;
+    using TTable = std::array< TValue, 256 >;
+
+    static constexpr TValue
+    Reflect( TValue aValue ) NOEXCEPT
+    {
+        TValue reflected = 0;
+        for ( size_t bit = 0; bit < kWidth; ++bit )
+        {
+            reflected = static_cast< TValue >( ( reflected << 1 ) | ( ( aValue >> bit ) & 1u ) );
+        }
+        return reflected;
+    }
+
+    static constexpr std::array< TTable, kSlices >
+    MakeTables( ) NOEXCEPT
+    {
+        std::array< TTable, kSlices > tables{ };
+        constexpr TValue kTopBit = static_cast< TValue >( TValue{ 1 } << ( kWidth - 1 ) );
+        constexpr TValue kReflectedPolynomial = Reflect( taPolynomial );
+
+        for ( size_t index = 0; index < 256; ++index )
+        {
+            TValue value = 0;
+            if ( taReflected )
+            {
+                value = static_cast< TValue >( index );
+                for ( int bit = 0; bit < 8; ++bit )
+                {
+                    value = static_cast< TValue >( ( value & 1u )
+                                                       ? ( value >> 1 ) ^ kReflectedPolynomial
+                                                       : value >> 1 );
+                }
+            }
+            else
+            {
+                value = static_cast< TValue >( static_cast< TValue >( index ) << ( kWidth - 8 ) );
+                for ( int bit = 0; bit < 8; ++bit )
+                {
+                    value = static_cast< TValue >( ( value & kTopBit )
+                                                       ? static_cast< TValue >( value << 1 )
+                                                             ^ taPolynomial
+                                                       : value << 1 );
+                }
+            }
+            tables[ 0 ][ index ] = value;
+        }
+
+        // The table k holds the register value after the byte followed by k zero bytes.
+        for ( size_t slice = 1; slice < kSlices; ++slice )
+        {
+            for ( size_t index = 0; index < 256; ++index )
+            {
+                const TValue previous = tables[ slice - 1 ][ index ];
+                tables[ slice ][ index ] = Shift( tables[ 0 ], previous );
+            }
+        }
+        return tables;
+    }
+
+    /// @brief Feeds the zero byte into the register.
+    static constexpr TValue
+    Shift( const TTable& aTable, TValue aRegister ) NOEXCEPT
+    {
+        if ( taReflected )
+        {
+            return static_cast< TValue >( ( kWidth > 8 ? aRegister >> 8 : 0 )
+                                          ^ aTable[ aRegister & 0xFFu ] );
+        }
+        return static_cast< TValue >( ( kWidth > 8 ? aRegister << 8 : 0 )
+                                      ^ aTable[ ( aRegister >> ( kWidth - 8 ) ) & 0xFFu ] );
+    }
+
+};
+
+/// @brief The slicing-by-4 lookup tables of the CRC, computed at compile time.
+template < typename taValue, taValue taPolynomial, bool taReflected >
+struct TCrcTables : public TCrcTableBuilder< taValue, taPolynomial, taReflected >
+{
+    using TBuilder = TCrcTableBuilder< taValue, taPolynomial, taReflected >;
+    static constexpr std::array< typename TBuilder::TTable, TBuilder::kSlices > kTables
+        = TBuilder::MakeTables( );
+};
+}  // namespace Detail
+
+/**
+ * @brief The table-driven CRC of up to 32 bits, defined by the Rocksoft model parameters.
+ *
+ * The data is processed 4 bytes at a time with the slicing-by-4 tables (4 table lookups and no
+ * data-dependent shifts per 4 bytes) and the tail byte by byte. The tables are computed at
+ * compile time.
+ *
+ * @tparam taValue The unsigned type of the CRC width (std::uint8_t, std::uint16_t or
+ * std::uint32_t).
+ * @tparam taPolynomial The polynomial in the normal (MSB-first) representation.
+ * @tparam taInitial The initial register value.
+ * @tparam taReflected Whether the data bytes and the result are reflected (LSB-first CRC).
+ * @tparam taFinalXor The value the result is XOR-ed with.
+ */
+template < typename taValue,
+           taValue taPolynomial,
+           taValue taInitial,
+           bool taReflected,
+           taValue taFinalXor = 0 >
+class TCrc
+{
+public:
+    static_assert( std::is_unsigned< taValue >::value && sizeof( taValue ) <= 4,
+                   "taValue has to be an unsigned type of up to 32 bits" );
+
+    using TValue = taValue;
+
+    /**
+     * @brief Computes the CRC of the data.
+     */
+    static TValue
+    Compute( const std::uint8_t* aData, size_t aLength ) NOEXCEPT
+    {
+        return Finalize( Update( Initial( ), aData, aLength ) );
+    }
+
+    /// @brief Returns the register value the computation starts with.
+    static constexpr TValue
+    Initial( ) NOEXCEPT
+    {
+        return taReflected ? Reflect( taInitial ) : taInitial;
+    }
+
+    /**
+     * @brief Continues the computation of the CRC register over the next part of the data.
+     */
+    static TValue
+    Update( TValue aRegister, const std::uint8_t* aData, size_t aLength ) NOEXCEPT
+    {
+        for ( ; aLength >= kSlices; aData += kSlices, aLength -= kSlices )
+        {
+            std::uint8_t block[ kSlices ] = { aData[ 0 ], aData[ 1 ], aData[ 2 ], aData[ 3 ] };
+            for ( size_t byte = 0; byte < sizeof( TValue ); ++byte )
+            {
+                block[ byte ] ^= static_cast< std::uint8_t >(
+                    taReflected ? aRegister >> ( 8 * byte )
+                                : aRegister >> ( kWidth - 8 - 8 * byte ) );
+            }
+            aRegister = static_cast< TValue >(
+                TTables::kTables[ 3 ][ block[ 0 ] ] ^ TTables::kTables[ 2 ][ block[ 1 ] ]
+                ^ TTables::kTables[ 1 ][ block[ 2 ] ] ^ TTables::kTables[ 0 ][ block[ 3 ] ] );
+        }
+        for ( ; aLength > 0; ++aData, --aLength )
+        {
+            aRegister = UpdateByte( aRegister, *aData );
+        }
+        return aRegister;
+    }
+
+    /// @brief Converts the register value into the CRC.
+    static constexpr TValue
+    Finalize( TValue aRegister ) NOEXCEPT
+    {
+        return static_cast< TValue >( aRegister ^ taFinalXor );
+    }
+
+    /**
+     * @brief Computes the CRC at compile time. Slow, intended for the constant data.
+     */
+    static constexpr TValue
+    ComputeConstexpr( const std::uint8_t* aData, size_t aLength ) NOEXCEPT
+    {
+        TValue crcRegister = Initial( );
+        for ( size_t index = 0; index < aLength; ++index )
+        {
+            crcRegister = UpdateByte( crcRegister, aData[ index ] );
+        }
+        return Finalize( crcRegister );
+    }
+
+private:
+    using TTables = Detail::TCrcTables< taValue, taPolynomial, taReflected >;
+    static constexpr size_t kWidth = TTables::kWidth;
+    static constexpr size_t kSlices = TTables::kSlices;
+
+    static constexpr TValue
+    Reflect( TValue aValue ) NOEXCEPT
+    {
+        return TTables::Reflect( aValue );
+    }
+
+    static constexpr TValue
+    UpdateByte( TValue aRegister, std::uint8_t aByte ) NOEXCEPT
+    {
+        if ( taReflected )
+        {
+            return TTables::Shift( TTables::kTables[ 0 ],
+                                   static_cast< TValue >( aRegister ^ aByte ) );
+        }
+        return TTables::Shift(
+            TTables::kTables[ 0 ],
+            static_cast< TValue >( aRegister ^ ( TValue{ aByte } << ( kWidth - 8 ) ) ) );
+    }
+};
+
+/// @brief The SMBus packet error code: CRC-8, polynomial x^8 + x^2 + x + 1.
+using TCrc8Smbus = TCrc< std::uint8_t, 0x07, 0x00, false >;
+
+/// @brief The CRC-8 of the Sensirion sensors (SHT, SGP, SCD, ...).
+using TCrc8Sensirion = TCrc< std::uint8_t, 0x31, 0xFF, false >;
+
+/// @brief The CRC-16/CCITT-FALSE.
+using TCrc16CcittFalse = TCrc< std::uint16_t, 0x1021, 0xFFFF, false >;
+
+/// @brief The CRC-16/MODBUS.
+using TCrc16Modbus = TCrc< std::uint16_t, 0x8005, 0xFFFF, true >;
+
+}  // namespace AbstractPlatform
@@ -8,6 +8,8 @@ static constexpr TErrorCode KOk = 0;
 static constexpr TErrorCode KGenericError = -1;
 static constexpr TErrorCode KInvalidArgumentError = -2;
 static constexpr TErrorCode KInvalidVendor = -3;
+static constexpr TErrorCode KIncompleteTransferError = -4;
+static constexpr TErrorCode KChecksumError = -5;
 
 #define RETURN_ON_ERROR( aErrorCode )      \
     if ( auto errorCode = ( aErrorCode ) ) \
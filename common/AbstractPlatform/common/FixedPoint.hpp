@@ -0,0 +1,604 @@
+#pragma once
+#include <AbstractPlatform/common/Platform.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace AbstractPlatform
+{
+/// @brief The rounding of the fractional bits dropped by the fixed-point operations.
+enum class TFixedRounding : std::uint8_t
+{
+    Floor,
+    TowardZero,
+    Nearest,
+    NearestEven
+};
+
+namespace Detail
+{
+template < size_t taBits >
+struct TFixedStorage
+{
+    static_assert( taBits <= 64, "The fixed-point value does not fit into 64 bits" );
+    using TRaw = std::conditional_t<
+        taBits <= 8,
+        std::int8_t,
+        std::conditional_t< taBits <= 16,
+                            std::int16_t,
+                            std::conditional_t< taBits <= 32, std::int32_t, std::int64_t > > >;
+};
+
+// The wide type holds the product of two raw values. The 8-bit and 16-bit values use 32-bit
+// arithmetic to keep the bulk loops in the narrow SIMD lanes.
+template < typename taRaw >
+struct TFixedWide
+{
+    using TWide = std::conditional_t< sizeof( taRaw ) <= 2, std::int32_t, std::int64_t >;
+};
+
+template <>
+struct TFixedWide< std::int64_t >
+{
+#ifdef __SIZEOF_INT128__
+    using TWide = __int128;
+#else
+    using TWide = void;
+#endif
+};
+
+// The accumulator of the dot product. The 8-bit and 16-bit products are summed in 64 bits, the
+// 32-bit and 64-bit ones in 128 bits where available.
+template < typename taRaw >
+struct TFixedAccumulator
+{
+#ifdef __SIZEOF_INT128__
+    using TAccumulator = std::conditional_t< sizeof( taRaw ) <= 2, std::int64_t, __int128 >;
+#else
+    using TAccumulator = std::int64_t;
+#endif
+};
+
+/**
+ * @brief Adds the values clamping the sum to the range of taWide.
+ */
+template < typename taWide >
+constexpr taWide
+SaturatingAdd( taWide aLeft, taWide aRight ) NOEXCEPT
+{
+    // Built of the shifts, as std::numeric_limits does not cover __int128 in the strict modes.
+    constexpr taWide kHalf = taWide{ 1 } << ( sizeof( taWide ) * 8 - 2 );
+    constexpr taWide kMax = kHalf - 1 + kHalf;
+    constexpr taWide kMin = -kMax - 1;
+    if ( aRight > 0 && aLeft > kMax - aRight )
+    {
+        return kMax;
+    }
+    if ( aRight < 0 && aLeft < kMin - aRight )
+    {
+        return kMin;
+    }
+    return aLeft + aRight;
+}
+
+/**
+ * @brief Constructs the fixed-point value of the raw representation held by any wider type,
+ * saturating.
+ */
+template < typename taFixed, typename taWide >
+constexpr taFixed
+SaturateRaw( taWide aWide ) NOEXCEPT
+{
+    using TRaw = typename taFixed::TRaw;
+    return taFixed::FromRaw( static_cast< TRaw >( aWide < taWide{ taFixed::kRawMin }
+                                                      ? taFixed::kRawMin
+                                                  : aWide > taWide{ taFixed::kRawMax }
+                                                      ? taFixed::kRawMax
+                                                      : aWide ) );
+}
+
+/**
+ * @brief Shifts the value right by aShift bits rounding the dropped bits.
+ */
+template < TFixedRounding taRounding, typename taWide >
+constexpr taWide
+RoundingShiftRight( taWide aValue, size_t aShift ) NOEXCEPT
+{
+    if ( aShift == 0 )
+    {
+        return aValue;
+    }
+
+    const taWide floor = aValue >> aShift;
+    const taWide remainder = aValue & ( ( taWide{ 1 } << aShift ) - 1 );
+    const taWide half = taWide{ 1 } << ( aShift - 1 );
+    switch ( taRounding )
+    {
+    case TFixedRounding::Floor:
+        return floor;
+    case TFixedRounding::TowardZero:
+        return floor + ( aValue < 0 && remainder != 0 );
+    case TFixedRounding::Nearest:
+        return floor + ( remainder >= half );
+    case TFixedRounding::NearestEven:
+    default:
+        return floor + ( remainder > half || ( remainder == half && ( floor & 1 ) != 0 ) );
+    }
+}
+
+/**
+ * @brief Divides aNumerator by the not zero aDenominator rounding the quotient.
+ */
+template < TFixedRounding taRounding, typename taWide >
+constexpr taWide
+RoundingDivide( taWide aNumerator, taWide aDenominator ) NOEXCEPT
+{
+    const taWide quotient = aNumerator / aDenominator;
+    const taWide remainder = aNumerator % aDenominator;
+    if ( remainder == 0 )
+    {
+        return quotient;
+    }
+
+    const bool negative = ( aNumerator < 0 ) != ( aDenominator < 0 );
+    const taWide step = negative ? -1 : 1;
+    const taWide twiceRemainder = remainder < 0 ? -2 * remainder : 2 * remainder;
+    const taWide denominator = aDenominator < 0 ? -aDenominator : aDenominator;
+    switch ( taRounding )
+    {
+    case TFixedRounding::Floor:
+        return negative ? quotient - 1 : quotient;
+    case TFixedRounding::TowardZero:
+        return quotient;
+    case TFixedRounding::Nearest:
+        // The half rounds up, toward the positive infinity, as in RoundingShiftRight().
+        if ( twiceRemainder > denominator || ( twiceRemainder == denominator && !negative ) )
+        {
+            return quotient + step;
+        }
+        return quotient;
+    case TFixedRounding::NearestEven:
+    default:
+        if ( twiceRemainder > denominator
+             || ( twiceRemainder == denominator && ( quotient & 1 ) != 0 ) )
+        {
+            return quotient + step;
+        }
+        return quotient;
+    }
+}
+}  // namespace Detail
+
+/**
+ * @brief The signed fixed-point number in the Q taIntegerBits.taFractionBits format: a sign bit,
+ * taIntegerBits integer bits and taFractionBits fraction bits stored in the smallest integer
+ * type holding them.
+ *
+ * The arithmetic is constexpr and saturating: the results out of the format range are clamped
+ * to Min() and Max() instead of wrapping around. The multiplication and the division round to
+ * the nearest by default, other roundings are available through Multiply() and Divide().
+ *
+ * @tparam taIntegerBits The count of the integer bits, excluding the sign bit.
+ * @tparam taFractionBits The count of the fraction bits.
+ */
+template < size_t taIntegerBits, size_t taFractionBits >
+class TFixed
+{
+public:
+    static constexpr size_t kIntegerBits = taIntegerBits;
+    static constexpr size_t kFractionBits = taFractionBits;
+    static constexpr size_t kBits = 1 + taIntegerBits + taFractionBits;
+
+    using TRaw = typename Detail::TFixedStorage< kBits >::TRaw;
+    using TWide = typename Detail::TFixedWide< TRaw >::TWide;
+    static_assert( !std::is_void< TWide >::value,
+                   "The 64-bit fixed-point values require the 128-bit integers" );
+    static_assert( taFractionBits < 63, "Too many fraction bits" );
+
+    static constexpr TRaw kRawMax
+        = static_cast< TRaw >( ( TWide{ 1 } << ( taIntegerBits + taFractionBits ) ) - 1 );
+    static constexpr TRaw kRawMin = static_cast< TRaw >( -kRawMax - 1 );
+    static constexpr TRaw kRawOne = taIntegerBits > 0 ? TRaw{ 1 } << taFractionBits : kRawMax;
+
+    constexpr TFixed( ) NOEXCEPT = default;
+
+    /**
+     * @brief Constructs the value of the raw representation, value * 2^taFractionBits.
+     */
+    static constexpr TFixed
+    FromRaw( TRaw aRaw ) NOEXCEPT
+    {
+        TFixed value;
+        value.iRaw = aRaw;
+        return value;
+    }
+
+    /**
+     * @brief Constructs the value of the wide raw representation, saturating.
+     */
+    static constexpr TFixed
+    FromWide( TWide aWide ) NOEXCEPT
+    {
+        return FromRaw( static_cast< TRaw >( aWide < kRawMin   ? kRawMin
+                                             : aWide > kRawMax ? kRawMax
+                                                               : aWide ) );
+    }
+
+    template < typename taInteger >
+    static constexpr TFixed
+    FromInteger( taInteger aInteger ) NOEXCEPT
+    {
+        static_assert( std::is_integral< taInteger >::value, "taInteger has to be integral" );
+        // The range is checked before the conversion, as the integer may not fit into TWide.
+        constexpr std::uintmax_t kLimit = std::uintmax_t{ 1 } << taIntegerBits;
+        if constexpr ( std::is_signed< taInteger >::value )
+        {
+            // -( aInteger + 1 ) does not overflow for the minimum of taInteger.
+            if ( aInteger < 0 && static_cast< std::uintmax_t >( -( aInteger + 1 ) ) >= kLimit )
+            {
+                return Min( );
+            }
+        }
+        if ( aInteger > 0 && static_cast< std::uintmax_t >( aInteger ) >= kLimit )
+        {
+            return Max( );
+        }
+        return FromWide( static_cast< TWide >( aInteger ) * ( TWide{ 1 } << taFractionBits ) );
+    }
+
+    /**
+     * @brief Converts the floating point value rounding to the nearest and saturating. Intended
+     * for the constant expressions on the targets without FPU.
+     */
+    static constexpr TFixed
+    FromFloat( double aValue ) NOEXCEPT
+    {
+        const double scaled = aValue * kScale;
+        if ( !( scaled < static_cast< double >( kRawMax ) ) )
+        {
+            return Max( );
+        }
+        if ( !( scaled > static_cast< double >( kRawMin ) ) )
+        {
+            return Min( );
+        }
+        return FromRaw( static_cast< TRaw >( scaled < 0 ? scaled - 0.5 : scaled + 0.5 ) );
+    }
+
+    static constexpr TFixed
+    Min( ) NOEXCEPT
+    {
+        return FromRaw( kRawMin );
+    }
+
+    static constexpr TFixed
+    Max( ) NOEXCEPT
+    {
+        return FromRaw( kRawMax );
+    }
+
+    /// @brief The smallest positive value, 2^-taFractionBits.
+    static constexpr TFixed
+    Epsilon( ) NOEXCEPT
+    {
+        return FromRaw( 1 );
+    }
+
+    /// @brief One, or Max() if the format has no integer bits.
+    static constexpr TFixed
+    One( ) NOEXCEPT
+    {
+        return FromRaw( kRawOne );
+    }
+
+    constexpr TRaw
+    Raw( ) const NOEXCEPT
+    {
+        return iRaw;
+    }
+
+    /**
+     * @brief Returns the integer part rounded with taRounding.
+     */
+    template < TFixedRounding taRounding = TFixedRounding::Floor >
+    constexpr TWide
+    ToInteger( ) const NOEXCEPT
+    {
+        return Detail::RoundingShiftRight< taRounding >( TWide{ iRaw }, taFractionBits );
+    }
+
+    constexpr double
+    ToFloat( ) const NOEXCEPT
+    {
+        return static_cast< double >( iRaw ) / kScale;
+    }
+
+    constexpr TFixed
+    operator-( ) const NOEXCEPT
+    {
+        return FromWide( -TWide{ iRaw } );
+    }
+
+    constexpr TFixed&
+    operator+=( TFixed aOther ) NOEXCEPT
+    {
+        return *this = FromWide( TWide{ iRaw } + aOther.iRaw );
+    }
+
+    constexpr TFixed&
+    operator-=( TFixed aOther ) NOEXCEPT
+    {
+        return *this = FromWide( TWide{ iRaw } - aOther.iRaw );
+    }
+
+    constexpr TFixed&
+    operator*=( TFixed aOther ) NOEXCEPT
+    {
+        return *this = Multiply( *this, aOther );
+    }
+
+    constexpr TFixed&
+    operator/=( TFixed aOther ) NOEXCEPT
+    {
+        return *this = Divide( *this, aOther );
+    }
+
+    friend constexpr TFixed
+    operator+( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return aLeft += aRight;
+    }
+
+    friend constexpr TFixed
+    operator-( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return aLeft -= aRight;
+    }
+
+    friend constexpr TFixed
+    operator*( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return Multiply( aLeft, aRight );
+    }
+
+    friend constexpr TFixed
+    operator/( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return Divide( aLeft, aRight );
+    }
+
+    /**
+     * @brief Multiplies the values rounding the product with taRounding and saturating.
+     */
+    template < TFixedRounding taRounding = TFixedRounding::Nearest >
+    static constexpr TFixed
+    Multiply( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return FromWide( Detail::RoundingShiftRight< taRounding >(
+            TWide{ aLeft.iRaw } * aRight.iRaw, taFractionBits ) );
+    }
+
+    /**
+     * @brief Divides the values rounding the quotient with taRounding and saturating. The
+     * division by zero saturates to Max() or Min() by the sign of the dividend.
+     */
+    template < TFixedRounding taRounding = TFixedRounding::Nearest >
+    static constexpr TFixed
+    Divide( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        if ( aRight.iRaw == 0 )
+        {
+            return aLeft.iRaw < 0 ? Min( ) : Max( );
+        }
+        return FromWide( Detail::RoundingDivide< taRounding >(
+            TWide{ aLeft.iRaw } * ( TWide{ 1 } << taFractionBits ), TWide{ aRight.iRaw } ) );
+    }
+
+    friend constexpr TFixed
+    Abs( TFixed aValue ) NOEXCEPT
+    {
+        return aValue.iRaw < 0 ? -aValue : aValue;
+    }
+
+    friend constexpr bool
+    operator==( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return aLeft.iRaw == aRight.iRaw;
+    }
+
+    friend constexpr bool
+    operator!=( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return aLeft.iRaw != aRight.iRaw;
+    }
+
+    friend constexpr bool
+    operator<( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return aLeft.iRaw < aRight.iRaw;
+    }
+
+    friend constexpr bool
+    operator<=( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return aLeft.iRaw <= aRight.iRaw;
+    }
+
+    friend constexpr bool
+    operator>( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return aLeft.iRaw > aRight.iRaw;
+    }
+
+    friend constexpr bool
+    operator>=( TFixed aLeft, TFixed aRight ) NOEXCEPT
+    {
+        return aLeft.iRaw >= aRight.iRaw;
+    }
+
+private:
+    static constexpr double kScale = static_cast< double >( std::uint64_t{ 1 } << taFractionBits );
+
+    TRaw iRaw = 0;
+};
+
+/// @brief Q0.15, the 16-bit signed fraction.
+using TQ15 = TFixed< 0, 15 >;
+/// @brief Q0.31, the 32-bit signed fraction.
+using TQ31 = TFixed< 0, 31 >;
+/// @brief Q7.8, the 16-bit value with the 1/256 resolution.
+using TQ7_8 = TFixed< 7, 8 >;
+/// @brief Q15.16, the 32-bit value with the 1/65536 resolution.
+using TQ15_16 = TFixed< 15, 16 >;
+
+/**
+ * @brief Converts the fixed-point value to another format rounding the dropped fraction bits
+ * with taRounding and saturating.
+ */
+template < typename taTo,
+           TFixedRounding taRounding = TFixedRounding::Nearest,
+           size_t taIntegerBits,
+           size_t taFractionBits >
+constexpr taTo
+FixedCast( TFixed< taIntegerBits, taFractionBits > aValue ) NOEXCEPT
+{
+    using TFrom = TFixed< taIntegerBits, taFractionBits >;
+    using TWide = std::conditional_t< ( sizeof( typename taTo::TWide )
+                                        > sizeof( typename TFrom::TWide ) ),
+                                      typename taTo::TWide, typename TFrom::TWide >;
+    const TWide raw = aValue.Raw( );
+    if constexpr ( taTo::kFractionBits >= taFractionBits )
+    {
+        // Saturate before the shift to keep it in the wide range.
+        constexpr size_t kShift = taTo::kFractionBits - taFractionBits;
+        constexpr TWide kLimit = TWide{ taTo::kRawMax } >> kShift;
+        if ( raw > kLimit )
+        {
+            return taTo::Max( );
+        }
+        if ( raw < -kLimit - 1 )
+        {
+            return taTo::Min( );
+        }
+        return taTo::FromWide(
+            static_cast< typename taTo::TWide >( raw * ( TWide{ 1 } << kShift ) ) );
+    }
+    else
+    {
+        // Saturate before the conversion, as the shifted value may not fit into taTo::TWide.
+        const TWide shifted = Detail::RoundingShiftRight< taRounding >(
+            raw, taFractionBits - taTo::kFractionBits );
+        return Detail::SaturateRaw< taTo >( shifted );
+    }
+}
+
+/**
+ * @brief Adds the arrays element-wise with saturation, aResult[ i ] = aLeft[ i ] + aRight[ i ].
+ *
+ * The loops of the bulk operations are branchless over the raw values, so the compiler
+ * vectorizes them into the saturating SIMD instructions where available. aResult may alias
+ * aLeft or aRight.
+ */
+template < size_t taIntegerBits, size_t taFractionBits >
+void
+FixedAdd( const TFixed< taIntegerBits, taFractionBits >* aLeft,
+          const TFixed< taIntegerBits, taFractionBits >* aRight,
+          TFixed< taIntegerBits, taFractionBits >* aResult,
+          size_t aCount ) NOEXCEPT
+{
+    using TValue = TFixed< taIntegerBits, taFractionBits >;
+    for ( size_t i = 0; i < aCount; ++i )
+    {
+        aResult[ i ] = TValue::FromWide( typename TValue::TWide{ aLeft[ i ].Raw( ) }
+                                         + aRight[ i ].Raw( ) );
+    }
+}
+
+/**
+ * @brief Multiplies the arrays element-wise with saturation, aResult[ i ] = aLeft[ i ] *
+ * aRight[ i ]. aResult may alias aLeft or aRight.
+ */
+template < TFixedRounding taRounding = TFixedRounding::Nearest,
+           size_t taIntegerBits,
+           size_t taFractionBits >
+void
+FixedMultiply( const TFixed< taIntegerBits, taFractionBits >* aLeft,
+               const TFixed< taIntegerBits, taFractionBits >* aRight,
+               TFixed< taIntegerBits, taFractionBits >* aResult,
+               size_t aCount ) NOEXCEPT
+{
+    using TValue = TFixed< taIntegerBits, taFractionBits >;
+    for ( size_t i = 0; i < aCount; ++i )
+    {
+        aResult[ i ] = TValue::template Multiply< taRounding >( aLeft[ i ], aRight[ i ] );
+    }
+}
+
+/**
+ * @brief Multiplies and accumulates the arrays element-wise with saturation,
+ * aAccumulator[ i ] += aLeft[ i ] * aRight[ i ], rounding once per element.
+ */
+template < TFixedRounding taRounding = TFixedRounding::Nearest,
+           size_t taIntegerBits,
+           size_t taFractionBits >
+void
+FixedMultiplyAccumulate( TFixed< taIntegerBits, taFractionBits >* aAccumulator,
+                         const TFixed< taIntegerBits, taFractionBits >* aLeft,
+                         const TFixed< taIntegerBits, taFractionBits >* aRight,
+                         size_t aCount ) NOEXCEPT
+{
+    using TValue = TFixed< taIntegerBits, taFractionBits >;
+    using TWide = typename TValue::TWide;
+    for ( size_t i = 0; i < aCount; ++i )
+    {
+        const TWide accumulator = aAccumulator[ i ].Raw( );
+        const TWide product = TWide{ aLeft[ i ].Raw( ) } * aRight[ i ].Raw( )
+                              + accumulator * ( TWide{ 1 } << taFractionBits );
+        aAccumulator[ i ] = TValue::FromWide(
+            Detail::RoundingShiftRight< taRounding >( product, taFractionBits ) );
+    }
+}
+
+/**
+ * @brief Returns the dot product of the arrays, accumulated at the full product precision and
+ * rounded and saturated once at the end.
+ *
+ * The 8-bit and 16-bit values are accumulated in 64 bits, holding 2^33 products of the 16-bit
+ * extremes, and the 32-bit values in 128 bits, holding 2^65 products. The 64-bit values (and the
+ * 32-bit ones without the 128-bit integers) saturate the accumulator at every step instead, so
+ * the result of the sums overflowing the accumulator depends on the order of the products.
+ */
+template < TFixedRounding taRounding = TFixedRounding::Nearest,
+           size_t taIntegerBits,
+           size_t taFractionBits >
+TFixed< taIntegerBits, taFractionBits >
+FixedDotProduct( const TFixed< taIntegerBits, taFractionBits >* aLeft,
+                 const TFixed< taIntegerBits, taFractionBits >* aRight,
+                 size_t aCount ) NOEXCEPT
+{
+    using TValue = TFixed< taIntegerBits, taFractionBits >;
+    using TRaw = typename TValue::TRaw;
+    using TAccumulator = typename Detail::TFixedAccumulator< TRaw >::TAccumulator;
+    // A product takes up to 2 * bits - 1 bits, so the accumulator of twice the raw width
+    // overflows after two products of the extremes.
+    constexpr bool kSaturate = sizeof( TAccumulator ) <= 2 * sizeof( TRaw );
+
+    TAccumulator sum = 0;
+    for ( size_t i = 0; i < aCount; ++i )
+    {
+        const TAccumulator product = TAccumulator{ aLeft[ i ].Raw( ) } * aRight[ i ].Raw( );
+        if constexpr ( kSaturate )
+        {
+            sum = Detail::SaturatingAdd( sum, product );
+        }
+        else
+        {
+            sum += product;
+        }
+    }
+    return Detail::SaturateRaw< TValue >(
+        Detail::RoundingShiftRight< taRounding >( sum, taFractionBits ) );
+}
+}  // namespace AbstractPlatform
@@ -0,0 +1,231 @@
+#pragma once
+#include <AbstractPlatform/common/Platform.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace AbstractPlatform
+{
+/// @brief The default storage capacity of TInplaceFunction: four pointers.
+static constexpr size_t KInplaceFunctionCapacity = 4 * sizeof( void* );
+
+template < typename taSignature,
+           size_t taCapacity = KInplaceFunctionCapacity,
+           size_t taAlignment = alignof( std::max_align_t ) >
+class TInplaceFunction;
+
+/**
+ * @brief The move-only callable wrapper storing the callable in place, the heap-free and
+ * exception-free replacement of std::function for the completion handlers.
+ *
+ * The callable larger than taCapacity or aligned stricter than taAlignment is rejected at compile
+ * time. Trivially copyable callables (function pointers, lambdas capturing pointers and scalars)
+ * are moved with memcpy and need no destructor call, so the only indirection on the hot path is
+ * the call itself.
+ *
+ * @tparam taResult The return type.
+ * @tparam taArguments The argument types.
+ * @tparam taCapacity The storage size in bytes.
+ * @tparam taAlignment The storage alignment.
+ */
+template < typename taResult, typename... taArguments, size_t taCapacity, size_t taAlignment >
+class TInplaceFunction< taResult( taArguments... ), taCapacity, taAlignment >
+{
+    template < typename taFunction >
+    using TEnableIfCallable = std::enable_if_t<
+        !std::is_same< std::decay_t< taFunction >, TInplaceFunction >::value
+        && !std::is_same< std::decay_t< taFunction >, std::nullptr_t >::value
+        && std::is_invocable_r< taResult, std::decay_t< taFunction >&, taArguments... >::value >;
+
+public:
+    static constexpr size_t kCapacity = taCapacity;
+
+    TInplaceFunction( ) NOEXCEPT = default;
+
+    TInplaceFunction( std::nullptr_t ) NOEXCEPT
+    {
+    }
+
+    template < typename taFunction, typename = TEnableIfCallable< taFunction > >
+    TInplaceFunction( taFunction&& aFunction ) NOEXCEPT
+    {
+        Construct< std::decay_t< taFunction > >( std::forward< taFunction >( aFunction ) );
+    }
+
+    TInplaceFunction( TInplaceFunction&& aOther ) NOEXCEPT
+    {
+        MoveFrom( aOther );
+    }
+
+    TInplaceFunction&
+    operator=( TInplaceFunction&& aOther ) NOEXCEPT
+    {
+        if ( this != &aOther )
+        {
+            Reset( );
+            MoveFrom( aOther );
+        }
+        return *this;
+    }
+
+    TInplaceFunction&
+    operator=( std::nullptr_t ) NOEXCEPT
+    {
+        Reset( );
+        return *this;
+    }
+
+    template < typename taFunction, typename = TEnableIfCallable< taFunction > >
+    TInplaceFunction&
+    operator=( taFunction&& aFunction ) NOEXCEPT
+    {
+        Reset( );
+        Construct< std::decay_t< taFunction > >( std::forward< taFunction >( aFunction ) );
+        return *this;
+    }
+
+    TInplaceFunction( const TInplaceFunction& ) = delete;
+    TInplaceFunction& operator=( const TInplaceFunction& ) = delete;
+
+    ~TInplaceFunction( )
+    {
+        Reset( );
+    }
+
+    /**
+     * @brief Constructs the callable of type taFunction in place from aArguments, replacing the
+     * current one.
+     */
+    template < typename taFunction, typename... taConstructorArguments >
+    void
+    Emplace( taConstructorArguments&&... aArguments ) NOEXCEPT
+    {
+        Reset( );
+        Construct< taFunction >( std::forward< taConstructorArguments >( aArguments )... );
+    }
+
+    /**
+     * @brief Destroys the callable, leaving the function empty.
+     */
+    void
+    Reset( ) NOEXCEPT
+    {
+        if ( iManage != nullptr )
+        {
+            iManage( TOperation::Destroy, iStorage, nullptr );
+        }
+        iInvoke = nullptr;
+        iManage = nullptr;
+    }
+
+    constexpr explicit operator bool( ) const NOEXCEPT
+    {
+        return iInvoke != nullptr;
+    }
+
+    constexpr bool
+    operator==( std::nullptr_t ) const NOEXCEPT
+    {
+        return iInvoke == nullptr;
+    }
+
+    constexpr bool
+    operator!=( std::nullptr_t ) const NOEXCEPT
+    {
+        return iInvoke != nullptr;
+    }
+
+    /**
+     * @brief Calls the callable. The function must not be empty.
+     */
+    taResult
+    operator( )( taArguments... aArguments ) const
+    {
+        assert( iInvoke != nullptr );
+        return iInvoke( iStorage, std::forward< taArguments >( aArguments )... );
+    }
+
+private:
+    enum class TOperation
+    {
+        Move,
+        Destroy
+    };
+
+    // Scalars are passed to the invoker by value to keep them in registers.
+    template < typename taArgument >
+    using TPass
+        = std::conditional_t< std::is_scalar< taArgument >::value, taArgument, taArgument&& >;
+
+    using TInvoke = taResult ( * )( void* aStorage, TPass< taArguments >... aArguments );
+    using TManage = void ( * )( TOperation aOperation, void* aStorage, void* aSource );
+
+    template < typename taFunction >
+    static taResult
+    Invoke( void* aStorage, TPass< taArguments >... aArguments )
+    {
+        return static_cast< taResult >( ( *static_cast< taFunction* >( aStorage ) )(
+            std::forward< taArguments >( aArguments )... ) );
+    }
+
+    template < typename taFunction >
+    static void
+    Manage( TOperation aOperation, void* aStorage, void* aSource ) NOEXCEPT
+    {
+        if ( aOperation == TOperation::Move )
+        {
+            auto& source = *static_cast< taFunction* >( aSource );
+            new ( aStorage ) taFunction( std::move( source ) );
+            source.~taFunction( );
+        }
+        else
+        {
+            static_cast< taFunction* >( aStorage )->~taFunction( );
+        }
+    }
+
+    template < typename taFunction, typename... taConstructorArguments >
+    void
+    Construct( taConstructorArguments&&... aArguments ) NOEXCEPT
+    {
+        static_assert( sizeof( taFunction ) <= taCapacity,
+                       "The callable does not fit into the TInplaceFunction storage" );
+        static_assert( taAlignment % alignof( taFunction ) == 0,
+                       "The callable alignment exceeds the TInplaceFunction storage alignment" );
+        static_assert( std::is_nothrow_move_constructible< taFunction >::value,
+                       "The callable must be nothrow move constructible" );
+
+        new ( iStorage ) taFunction( std::forward< taConstructorArguments >( aArguments )... );
+        iInvoke = &Invoke< taFunction >;
+        if constexpr ( !std::is_trivially_copyable< taFunction >::value )
+        {
+            iManage = &Manage< taFunction >;
+        }
+    }
+
+    void
+    MoveFrom( TInplaceFunction& aOther ) NOEXCEPT
+    {
+        if ( aOther.iManage != nullptr )
+        {
+            aOther.iManage( TOperation::Move, iStorage, aOther.iStorage );
+        }
+        else if ( aOther.iInvoke != nullptr )
+        {
+            std::memcpy( iStorage, aOther.iStorage, taCapacity );
+        }
+        iInvoke = aOther.iInvoke;
+        iManage = aOther.iManage;
+        aOther.iInvoke = nullptr;
+        aOther.iManage = nullptr;
+    }
+
+    TInvoke iInvoke = nullptr;
+    TManage iManage = nullptr;
+    alignas( taAlignment ) mutable unsigned char iStorage[ taCapacity ];
+};
+}  // namespace AbstractPlatform
@@ -0,0 +1,236 @@
+#pragma once
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/ConstexprMath.hpp>
+#include <AbstractPlatform/common/FixedPoint.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace AbstractPlatform
+{
+/**
+ * @brief Builds the table of taSize entries, table[ i ] = aGenerator( i ). Used in the constant
+ * expressions to generate the tables at build time.
+ */
+template < typename taValue, size_t taSize, typename taGenerator >
+constexpr std::array< taValue, taSize >
+MakeLookupTable( taGenerator aGenerator ) NOEXCEPT
+{
+    std::array< taValue, taSize > table{ };
+    for ( size_t index = 0; index < taSize; ++index )
+    {
+        table[ index ] = aGenerator( index );
+    }
+    return table;
+}
+
+/**
+ * @brief The lookup table generated at build time and placed in the read-only memory.
+ *
+ * The generator provides the entry type, the size and the constexpr generating function:
+ *
+ *     struct TSquares
+ *     {
+ *         using TValue = std::uint16_t;
+ *         static constexpr size_t kSize = 256;
+ *         static constexpr TValue Generate( size_t aIndex ) { return aIndex * aIndex; }
+ *     };
+ *     const auto square = TLookupTable< TSquares >::kEntries[ 12 ];
+ *
+ * @tparam taGenerator The table generator.
+ */
+template < typename taGenerator >
+struct TLookupTable
+{
+    using TValue = typename taGenerator::TValue;
+    static constexpr size_t kSize = taGenerator::kSize;
+
+    static constexpr std::array< TValue, kSize > kEntries = MakeLookupTable< TValue, kSize >(
+        []( size_t aIndex ) { return taGenerator::Generate( aIndex ); } );
+};
+
+namespace Detail
+{
+template < typename taValue >
+struct TLookupArithmetic
+{
+    using TWide = std::int64_t;
+
+    static constexpr TWide
+    ToWide( taValue aValue ) NOEXCEPT
+    {
+        return static_cast< TWide >( aValue );
+    }
+
+    static constexpr taValue
+    FromWide( TWide aWide ) NOEXCEPT
+    {
+        return static_cast< taValue >( aWide );
+    }
+};
+
+template < size_t taIntegerBits, size_t taFractionBits >
+struct TLookupArithmetic< TFixed< taIntegerBits, taFractionBits > >
+{
+    using TFixedValue = TFixed< taIntegerBits, taFractionBits >;
+    using TWide = typename TFixedValue::TWide;
+
+    static constexpr TWide
+    ToWide( TFixedValue aValue ) NOEXCEPT
+    {
+        return aValue.Raw( );
+    }
+
+    static constexpr TFixedValue
+    FromWide( TWide aWide ) NOEXCEPT
+    {
+        return TFixedValue::FromWide( aWide );
+    }
+};
+}  // namespace Detail
+
+/**
+ * @brief Looks up the table at the fractional position, interpolating linearly between the
+ * neighbouring entries.
+ *
+ * @tparam taFractionBits The count of the fraction bits of aPosition.
+ * @param aTable The table of integer or TFixed entries.
+ * @param aPosition The position in the table, index * 2^taFractionBits. The position must be
+ * below ( taSize - 1 ) * 2^taFractionBits, i.e. the last entry is only interpolated toward.
+ * @return The interpolated entry, rounded to the nearest.
+ */
+template < size_t taFractionBits, typename taValue, size_t taSize >
+constexpr taValue
+InterpolateLookup( const std::array< taValue, taSize >& aTable, std::uint32_t aPosition ) NOEXCEPT
+{
+    using TArithmetic = Detail::TLookupArithmetic< taValue >;
+    using TWide = typename TArithmetic::TWide;
+
+    const size_t index = aPosition >> taFractionBits;
+    const TWide fraction = aPosition & ( ( std::uint32_t{ 1 } << taFractionBits ) - 1 );
+    const TWide low = TArithmetic::ToWide( aTable[ index ] );
+    const TWide high = TArithmetic::ToWide( aTable[ index + 1 ] );
+    return TArithmetic::FromWide( low
+                                  + Detail::RoundingShiftRight< TFixedRounding::Nearest >(
+                                      ( high - low ) * fraction, taFractionBits ) );
+}
+
+/// @brief The binary angle: the full turn is 2^16, so the angle arithmetic wraps around freely.
+using TBinaryAngle = std::uint16_t;
+
+/**
+ * @brief The sine table of 256 steps per turn with the guard entry for the interpolation.
+ */
+struct TSineTableGenerator
+{
+    using TValue = TQ15;
+    static constexpr size_t kSize = 257;
+
+    static constexpr TValue
+    Generate( size_t aIndex ) NOEXCEPT
+    {
+        return TQ15::FromFloat( ConstexprSin( 2 * KPi * static_cast< double >( aIndex ) / 256 ) );
+    }
+};
+
+using TSineTable = TLookupTable< TSineTableGenerator >;
+
+/**
+ * @brief Returns the sine of the binary angle, interpolated from TSineTable. The absolute error
+ * is below 1.2e-4.
+ */
+constexpr TQ15
+SineLookup( TBinaryAngle aAngle ) NOEXCEPT
+{
+    return InterpolateLookup< 8 >( TSineTable::kEntries, aAngle );
+}
+
+/**
+ * @brief Returns the cosine of the binary angle, interpolated from TSineTable.
+ */
+constexpr TQ15
+CosineLookup( TBinaryAngle aAngle ) NOEXCEPT
+{
+    return SineLookup( static_cast< TBinaryAngle >( aAngle + 0x4000u ) );
+}
+
+/**
+ * @brief The 8-bit gamma correction table, out = 255 * ( in / 255 )^gamma, with the gamma of
+ * taNumerator / taDenominator.
+ */
+template < std::uint32_t taNumerator, std::uint32_t taDenominator >
+struct TGammaTableGenerator
+{
+    using TValue = std::uint8_t;
+    static constexpr size_t kSize = 256;
+
+    static constexpr TValue
+    Generate( size_t aIndex ) NOEXCEPT
+    {
+        const double corrected
+            = 255.0
+              * ConstexprPow( static_cast< double >( aIndex ) / 255.0,
+                              static_cast< double >( taNumerator ) / taDenominator );
+        return static_cast< TValue >( corrected + 0.5 );
+    }
+};
+
+/// @brief The gamma table of taNumerator / taDenominator, 2.2 by default.
+template < std::uint32_t taNumerator = 22, std::uint32_t taDenominator = 10 >
+using TGammaTable = TLookupTable< TGammaTableGenerator< taNumerator, taDenominator > >;
+
+/**
+ * @brief The square root table, 256 * sqrt( i ), with the guard entry for the interpolation.
+ */
+struct TSqrtTableGenerator
+{
+    using TValue = std::uint16_t;
+    static constexpr size_t kSize = 257;
+
+    static constexpr TValue
+    Generate( size_t aIndex ) NOEXCEPT
+    {
+        return static_cast< TValue >( 256 * ConstexprSqrt( static_cast< double >( aIndex ) )
+                                      + 0.5 );
+    }
+};
+
+using TSqrtTable = TLookupTable< TSqrtTableGenerator >;
+
+/**
+ * @brief Returns the square root of the value rounded to the integer, interpolated from
+ * TSqrtTable. The error is below 0.5 plus the relative error of 5e-4.
+ */
+constexpr std::uint16_t
+SqrtLookup( std::uint32_t aValue ) NOEXCEPT
+{
+    if ( aValue == 0 )
+    {
+        return 0;
+    }
+
+    // Normalize the value by an even shift into [2^14, 2^16), the table indices [64, 256),
+    // where the interpolation is accurate: sqrt( value ) = sqrt( normalized ) * 2^shift.
+    int shift = 0;
+    std::uint32_t normalized = aValue;
+    for ( ; normalized >= ( 1u << 16 ); normalized >>= 2 )
+    {
+        ++shift;
+    }
+    for ( ; normalized < ( 1u << 14 ); normalized <<= 2 )
+    {
+        --shift;
+    }
+
+    // The table holds 16 * sqrt( normalized ).
+    const std::uint32_t root = InterpolateLookup< 8 >( TSqrtTable::kEntries, normalized );
+    if ( shift >= 4 )
+    {
+        const std::uint32_t scaled = root << ( shift - 4 );
+        return static_cast< std::uint16_t >( scaled > 0xFFFFu ? 0xFFFFu : scaled );
+    }
+    return static_cast< std::uint16_t >( ( root + ( 1u << ( 3 - shift ) ) ) >> ( 4 - shift ) );
+}
+}  // namespace AbstractPlatform
@@ -2,9 +2,14 @@
 #include <AbstractPlatform/common/Platform.hpp>
 #include <cstring>
 #include <cassert>
+#include <cstddef>
 
 namespace AbstractPlatform
 {
+/// @brief The assumed size of the CPU cache line, used to keep the data written by different
+/// threads on separate lines.
+static constexpr size_t KCacheLineSize = 64;
+
 template < typename DestinationBufferType, typename taScalarType >
 DestinationBufferType*
 ScalarTypeCopy( DestinationBufferType* aDestinationBuffer, taScalarType aSourceValue )
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Memory.hpp>
+
+#include <atomic>
+
+namespace AbstractPlatform
+{
+/// @brief The hook the elements of the TMpscQueue derive from.
+struct TMpscNode
+{
+    std::atomic< TMpscNode* > iNext{ nullptr };
+};
+
+/**
+ * @brief The intrusive unbounded lock-free multi-producer single-consumer queue (the D. Vyukov
+ * algorithm).
+ *
+ * Push() may be called from any thread and is wait-free: a single atomic exchange. Pop() may
+ * only be called from a single consumer thread at a time. The queue does not own the elements:
+ * an element has to stay alive and must not be pushed again until it is popped.
+ *
+ * @tparam taNode The element type derived from TMpscNode.
+ */
+template < typename taNode >
+class TMpscQueue
+{
+public:
+    TMpscQueue( )
+        : iHead{ &iStub }
+        , iTail{ &iStub }
+    {
+    }
+
+    TMpscQueue( const TMpscQueue& ) = delete;
+    TMpscQueue& operator=( const TMpscQueue& ) = delete;
+
+    /**
+     * @brief Appends the element. Producer side.
+     */
+    void
+    Push( taNode& aNode ) NOEXCEPT
+    {
+        Push( static_cast< TMpscNode* >( &aNode ) );
+    }
+
+    /**
+     * @brief Takes the oldest element. Consumer side.
+     *
+     * @return taNode* The element, or nullptr if the queue is empty or the element being pushed
+     * is not linked yet.
+     */
+    taNode*
+    Pop( ) NOEXCEPT
+    {
+        TMpscNode* tail = iTail;
+        TMpscNode* next = tail->iNext.load( std::memory_order_acquire );
+        if ( tail == &iStub )
+        {
+            if ( next == nullptr )
+            {
+                return nullptr;
+            }
+            iTail = next;
+            tail = next;
+            next = next->iNext.load( std::memory_order_acquire );
+        }
+
+        if ( next == nullptr )
+        {
+            if ( tail != iHead.load( std::memory_order_acquire ) )
+            {
+                return nullptr;
+            }
+            // The last element is taken: put the stub behind it to keep the queue non-empty.
+            Push( &iStub );
+            next = tail->iNext.load( std::memory_order_acquire );
+            if ( next == nullptr )
+            {
+                return nullptr;
+            }
+        }
+
+        iTail = next;
+        return static_cast< taNode* >( tail );
+    }
+
+private:
+    void
+    Push( TMpscNode* aNode ) NOEXCEPT
+    {
+        aNode->iNext.store( nullptr, std::memory_order_relaxed );
+        TMpscNode* previous = iHead.exchange( aNode, std::memory_order_acq_rel );
+        previous->iNext.store( aNode, std::memory_order_release );
+    }
+
+    alignas( KCacheLineSize ) std::atomic< TMpscNode* > iHead;
+    alignas( KCacheLineSize ) TMpscNode* iTail;
+    TMpscNode iStub;
+};
+
+}  // namespace AbstractPlatform
@@ -0,0 +1,788 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) && !defined( PROFILING_CLOCK_GETTIME )
+#include <x86intrin.h>
+#define ABSTRACT_PLATFORM_PROFILING_TSC 1
+#endif
+
+namespace AbstractPlatform
+{
+#ifdef PROFILING
+static constexpr bool KProfilingEnabled = true;
+#else
+static constexpr bool KProfilingEnabled = false;
+#endif
+
+enum class TProfileSiteKind : std::uint8_t
+{
+    /// @brief The duration of the scope, see CProfileScope.
+    Timer,
+    /// @brief The monotonic sum, e.g. the count of the transferred bytes.
+    Counter,
+    /// @brief The last set value, e.g. the queue depth.
+    Gauge
+};
+
+/// @brief The aggregated statistics of the timer site.
+struct TProfileTimerStatistics
+{
+    const char* iName = nullptr;
+    std::uint64_t iCount = 0;
+    TNanoseconds iTotal = 0;
+    TNanoseconds iMax = 0;
+    /// @brief The percentiles, the upper bounds of the histogram buckets.
+    TNanoseconds iP50 = 0;
+    TNanoseconds iP90 = 0;
+    TNanoseconds iP99 = 0;
+};
+
+namespace Detail
+{
+/**
+ * @brief The log-linear histogram layout: the values below kSubBuckets have own buckets, every
+ * further power of two range is split into kSubBuckets equal buckets, so the relative error
+ * stays below 1 / kSubBuckets.
+ */
+struct TLogLinearHistogram
+{
+    static constexpr size_t kSubBucketBits = 2;
+    static constexpr size_t kSubBuckets = size_t{ 1 } << kSubBucketBits;
+    /// @brief The values of 2^kMaxExponent and above go to the last bucket (~18 minutes in ns).
+    static constexpr size_t kMaxExponent = 40;
+    static constexpr size_t kBuckets = ( kMaxExponent - kSubBucketBits + 2 ) * kSubBuckets;
+
+    static inline size_t
+    BucketOf( std::uint64_t aValue ) NOEXCEPT
+    {
+        if ( aValue < kSubBuckets )
+        {
+            return static_cast< size_t >( aValue );
+        }
+#if defined( __GNUC__ )
+        const size_t exponent = 63 - static_cast< size_t >( __builtin_clzll( aValue ) );
+#else
+        size_t exponent = 0;
+        for ( std::uint64_t value = aValue >> 1; value != 0; value >>= 1 )
+        {
+            ++exponent;
+        }
+#endif
+        if ( exponent > kMaxExponent )
+        {
+            return kBuckets - 1;
+        }
+        const size_t shift = exponent - kSubBucketBits;
+        const size_t mantissa = static_cast< size_t >( aValue >> shift ) & ( kSubBuckets - 1 );
+        return ( exponent - kSubBucketBits + 1 ) * kSubBuckets + mantissa;
+    }
+
+    static constexpr std::uint64_t
+    LowerBound( size_t aBucket ) NOEXCEPT
+    {
+        if ( aBucket < kSubBuckets )
+        {
+            return aBucket;
+        }
+        const size_t exponent = aBucket / kSubBuckets + kSubBucketBits - 1;
+        const std::uint64_t mantissa = aBucket % kSubBuckets;
+        return ( kSubBuckets + mantissa ) << ( exponent - kSubBucketBits );
+    }
+};
+
+struct TProfileTimerCell
+{
+    std::atomic< std::uint64_t > iCount{ 0 };
+    std::atomic< std::uint64_t > iTotal{ 0 };
+    std::atomic< std::uint64_t > iMax{ 0 };
+    std::atomic< std::uint32_t > iBuckets[ TLogLinearHistogram::kBuckets ] = { };
+};
+
+/**
+ * @brief The storage of the thread. Written by the owner thread only, with the plain relaxed
+ * load and store instead of the read-modify-write, and read by the snapshots.
+ */
+template < size_t taMaxTimers, size_t taMaxCounters >
+struct TProfileThreadBlock
+{
+    TProfileTimerCell iTimers[ taMaxTimers ];
+    std::atomic< std::uint64_t > iCounters[ taMaxCounters ] = { };
+    std::atomic< bool > iInUse{ true };
+    TProfileThreadBlock* iNext = nullptr;
+};
+
+template < typename taValue >
+inline void
+AddOwned( std::atomic< taValue >& aValue, taValue aDelta ) NOEXCEPT
+{
+    aValue.store( aValue.load( std::memory_order_relaxed ) + aDelta, std::memory_order_relaxed );
+}
+
+/// @brief Returns the ticks of the profiling clock: the TSC on x86, the monotonic clock else.
+inline std::uint64_t
+ProfileTicks( ) NOEXCEPT
+{
+#if defined( ABSTRACT_PLATFORM_PROFILING_TSC )
+    return __rdtsc( );
+#else
+    return CSteadyClock{ }.Now( );
+#endif
+}
+
+/**
+ * @brief Measures the length of the profiling clock tick. The TSC is assumed to be invariant
+ * (constant rate across the frequency changes and the cores), as on all x86 CPUs of the last
+ * decade.
+ *
+ * @note Busy-waits for about 2 ms against the steady clock on x86, returns at once elsewhere.
+ */
+inline double
+MeasureNanosecondsPerProfileTick( ) NOEXCEPT
+{
+#if defined( ABSTRACT_PLATFORM_PROFILING_TSC )
+    constexpr TNanoseconds kCalibrationPeriod = 2000000;
+    const CSteadyClock clock;
+    const TNanoseconds startTime = clock.Now( );
+    const std::uint64_t startTicks = ProfileTicks( );
+    TNanoseconds time = startTime;
+    while ( time - startTime < kCalibrationPeriod )
+    {
+        time = clock.Now( );
+    }
+    const std::uint64_t ticks = ProfileTicks( ) - startTicks;
+    return ticks > 0 ? static_cast< double >( time - startTime ) / static_cast< double >( ticks )
+                     : 1.0;
+#else
+    return 1.0;
+#endif
+}
+
+/// @brief Appends the formatted text to the buffer, counting the length even past its end.
+class CProfileTextWriter
+{
+public:
+    CProfileTextWriter( char* aBuffer, size_t aLength )
+        : iBuffer{ aBuffer }
+        , iLength{ aLength }
+    {
+        if ( iLength > 0 )
+        {
+            iBuffer[ 0 ] = '\0';
+        }
+    }
+
+    template < typename... taArguments >
+    void
+    Append( const char* aFormat, taArguments... aArguments ) NOEXCEPT
+    {
+        const size_t space = iPosition < iLength ? iLength - iPosition : 0;
+        const int written = std::snprintf(
+            space > 0 ? iBuffer + iPosition : nullptr, space, aFormat, aArguments... );
+        if ( written > 0 )
+        {
+            iPosition += static_cast< size_t >( written );
+        }
+    }
+
+    size_t
+    Length( ) const NOEXCEPT
+    {
+        return iPosition;
+    }
+
+private:
+    char* iBuffer;
+    size_t iLength;
+    size_t iPosition = 0;
+};
+}  // namespace Detail
+
+class CProfileSite;
+
+/**
+ * @brief The process-wide registry and storage of the profiling sites.
+ *
+ * Every thread records into its own storage block, so the recording takes no locks and no
+ * read-modify-write operations; the snapshots (TimerStatistics(), WriteText(), WriteJson())
+ * merge the blocks of all the threads and may be taken concurrently with the recording. The
+ * block of the exited thread is kept with its data and reused by the next new thread.
+ *
+ * The profiler is created by the first Instance() call, which calibrates the TSC by busy-waiting
+ * for about 2 ms. The first profiled scope makes that call unless the program has made it
+ * already, so the real-time programs call Instance() once at start-up, before their time
+ * critical threads run. After that a scope costs two clock reads and a few relaxed stores; see
+ * ProfilingBenchmark for the measured cost against the 20 ns budget.
+ */
+class CProfiler
+{
+public:
+    static constexpr size_t kMaxTimers = 64;
+    static constexpr size_t kMaxCounters = 64;
+    static constexpr size_t kMaxGauges = 64;
+    static constexpr size_t kInvalidIndex = ~size_t{ 0 };
+
+    /// @brief Returns the profiler, creating and calibrating it on the first call.
+    static CProfiler&
+    Instance( ) NOEXCEPT
+    {
+        static CProfiler profiler;
+        return profiler;
+    }
+
+    CProfiler( const CProfiler& ) = delete;
+    CProfiler& operator=( const CProfiler& ) = delete;
+
+    /**
+     * @brief Registers the site.
+     *
+     * @return size_t The site index within its kind, kInvalidIndex if there is no room.
+     */
+    inline size_t Register( CProfileSite& aSite ) NOEXCEPT;
+
+    /// @brief Records the duration measured in the profiling clock ticks.
+    void
+    RecordTicks( size_t aTimerIndex, std::uint64_t aTicks ) NOEXCEPT
+    {
+        RecordDuration( aTimerIndex,
+                        static_cast< TNanoseconds >( static_cast< double >( aTicks )
+                                                     * iNanosecondsPerTick ) );
+    }
+
+    void
+    RecordDuration( size_t aTimerIndex, TNanoseconds aDuration ) NOEXCEPT
+    {
+        if ( aTimerIndex >= kMaxTimers )
+        {
+            return;
+        }
+        auto& cell = ThreadBlock( ).iTimers[ aTimerIndex ];
+        Detail::AddOwned( cell.iCount, std::uint64_t{ 1 } );
+        Detail::AddOwned( cell.iTotal, aDuration );
+        if ( aDuration > cell.iMax.load( std::memory_order_relaxed ) )
+        {
+            cell.iMax.store( aDuration, std::memory_order_relaxed );
+        }
+        Detail::AddOwned( cell.iBuckets[ Detail::TLogLinearHistogram::BucketOf( aDuration ) ],
+                          std::uint32_t{ 1 } );
+    }
+
+    void
+    AddCount( size_t aCounterIndex, std::uint64_t aDelta ) NOEXCEPT
+    {
+        if ( aCounterIndex < kMaxCounters )
+        {
+            Detail::AddOwned( ThreadBlock( ).iCounters[ aCounterIndex ], aDelta );
+        }
+    }
+
+    size_t
+    TimerCount( ) const NOEXCEPT
+    {
+        return Count( iTimerCount, kMaxTimers );
+    }
+
+    size_t
+    CounterCount( ) const NOEXCEPT
+    {
+        return Count( iCounterCount, kMaxCounters );
+    }
+
+    size_t
+    GaugeCount( ) const NOEXCEPT
+    {
+        return Count( iGaugeCount, kMaxGauges );
+    }
+
+    /**
+     * @brief Merges the statistics of the timer over all the threads.
+     *
+     * @return true If the timer is registered, otherwise - false
+     */
+    inline bool TimerStatistics( size_t aTimerIndex,
+                                 TProfileTimerStatistics& aStatistics ) const NOEXCEPT;
+
+    /// @brief Returns the counter name, nullptr if the counter is not registered.
+    inline const char* CounterName( size_t aCounterIndex ) const NOEXCEPT;
+
+    /// @brief Returns the counter sum over all the threads.
+    std::uint64_t
+    CounterValue( size_t aCounterIndex ) const NOEXCEPT
+    {
+        std::uint64_t value = 0;
+        for ( auto* block = iBlocks.load( std::memory_order_acquire ); block != nullptr;
+              block = block->iNext )
+        {
+            value += block->iCounters[ aCounterIndex ].load( std::memory_order_relaxed );
+        }
+        return value;
+    }
+
+    /// @brief Returns the gauge site, nullptr if the gauge is not registered.
+    const CProfileSite*
+    Gauge( size_t aGaugeIndex ) const NOEXCEPT
+    {
+        if ( aGaugeIndex >= GaugeCount( ) )
+        {
+            return nullptr;
+        }
+        return iGauges[ aGaugeIndex ].load( std::memory_order_acquire );
+    }
+
+    /**
+     * @brief Writes the statistics of all the sites as the text, one site per line. Like
+     * snprintf(), the output is truncated to the buffer length and terminated with 0.
+     *
+     * @return size_t The length of the complete text, excluding the terminating 0.
+     */
+    inline size_t WriteText( char* aBuffer, size_t aLength ) const NOEXCEPT;
+
+    /**
+     * @brief Writes the statistics of all the sites as the JSON object with the "timers",
+     * "counters" and "gauges" arrays. The site names are written as is, so they must not need
+     * escaping. The output is truncated like in WriteText().
+     *
+     * @return size_t The length of the complete text, excluding the terminating 0.
+     */
+    inline size_t WriteJson( char* aBuffer, size_t aLength ) const NOEXCEPT;
+
+    /**
+     * @brief Clears the recorded data. The data recorded concurrently may be partially lost.
+     */
+    inline void Reset( ) NOEXCEPT;
+
+private:
+    using TThreadBlock = Detail::TProfileThreadBlock< kMaxTimers, kMaxCounters >;
+
+    /// @brief Releases the block of the thread on the thread exit.
+    struct TThreadBinding
+    {
+        ~TThreadBinding( )
+        {
+            if ( iBlock != nullptr )
+            {
+                iBlock->iInUse.store( false, std::memory_order_release );
+            }
+        }
+
+        TThreadBlock* iBlock = nullptr;
+    };
+
+    CProfiler( )
+        : iNanosecondsPerTick{ Detail::MeasureNanosecondsPerProfileTick( ) }
+    {
+    }
+
+    static size_t
+    Count( const std::atomic< size_t >& aCount, size_t aMax ) NOEXCEPT
+    {
+        const size_t count = aCount.load( std::memory_order_acquire );
+        return count < aMax ? count : aMax;
+    }
+
+    TThreadBlock&
+    ThreadBlock( ) NOEXCEPT
+    {
+        static thread_local TThreadBinding binding;
+        if ( binding.iBlock == nullptr )
+        {
+            binding.iBlock = AcquireBlock( );
+        }
+        return *binding.iBlock;
+    }
+
+    TThreadBlock*
+    AcquireBlock( ) NOEXCEPT
+    {
+        for ( auto* block = iBlocks.load( std::memory_order_acquire ); block != nullptr;
+              block = block->iNext )
+        {
+            bool inUse = false;
+            if ( block->iInUse.compare_exchange_strong(
+                     inUse, true, std::memory_order_acquire, std::memory_order_relaxed ) )
+            {
+                return block;
+            }
+        }
+
+        // The blocks are never freed: the snapshots may walk the list at any time.
+        auto* block = new TThreadBlock;
+        block->iNext = iBlocks.load( std::memory_order_relaxed );
+        while ( !iBlocks.compare_exchange_weak(
+            block->iNext, block, std::memory_order_release, std::memory_order_relaxed ) )
+        {
+        }
+        return block;
+    }
+
+    template < typename taSite >
+    static size_t
+    Add( std::atomic< taSite* >* aSites,
+         std::atomic< size_t >& aCount,
+         size_t aMax,
+         taSite& aSite ) NOEXCEPT
+    {
+        const size_t index = aCount.fetch_add( 1, std::memory_order_relaxed );
+        if ( index >= aMax )
+        {
+            return kInvalidIndex;
+        }
+        aSites[ index ].store( &aSite, std::memory_order_release );
+        return index;
+    }
+
+    const double iNanosecondsPerTick;
+    std::atomic< TThreadBlock* > iBlocks{ nullptr };
+    std::atomic< CProfileSite* > iTimers[ kMaxTimers ] = { };
+    std::atomic< CProfileSite* > iCounters[ kMaxCounters ] = { };
+    std::atomic< CProfileSite* > iGauges[ kMaxGauges ] = { };
+    std::atomic< size_t > iTimerCount{ 0 };
+    std::atomic< size_t > iCounterCount{ 0 };
+    std::atomic< size_t > iGaugeCount{ 0 };
+};
+
+/**
+ * @brief The named profiling site: the timer, the counter or the gauge. The sites are intended
+ * to be the function-local statics created by the PROFILE_* macros, they register themselves
+ * in the CProfiler on the construction and must live until the program exit.
+ */
+class CProfileSite
+{
+public:
+    CProfileSite( const char* aName, TProfileSiteKind aKind ) NOEXCEPT
+        : iName{ aName }
+        , iKind{ aKind }
+        , iIndex{ CProfiler::Instance( ).Register( *this ) }
+    {
+    }
+
+    CProfileSite( const CProfileSite& ) = delete;
+    CProfileSite& operator=( const CProfileSite& ) = delete;
+
+    const char*
+    Name( ) const NOEXCEPT
+    {
+        return iName;
+    }
+
+    TProfileSiteKind
+    Kind( ) const NOEXCEPT
+    {
+        return iKind;
+    }
+
+    /// @brief Returns the site index within its kind, CProfiler::kInvalidIndex if the
+    /// registry is full.
+    size_t
+    Index( ) const NOEXCEPT
+    {
+        return iIndex;
+    }
+
+    /// @brief Adds to the counter.
+    void
+    Add( std::uint64_t aDelta ) const NOEXCEPT
+    {
+        CProfiler::Instance( ).AddCount( iIndex, aDelta );
+    }
+
+    /// @brief Sets the gauge value.
+    void
+    Set( std::int64_t aValue ) NOEXCEPT
+    {
+        iGaugeValue.store( aValue, std::memory_order_relaxed );
+    }
+
+    std::int64_t
+    GaugeValue( ) const NOEXCEPT
+    {
+        return iGaugeValue.load( std::memory_order_relaxed );
+    }
+
+private:
+    const char* const iName;
+    const TProfileSiteKind iKind;
+    const size_t iIndex;
+    std::atomic< std::int64_t > iGaugeValue{ 0 };
+};
+
+/**
+ * @brief Records the duration of the scope into the timer site.
+ */
+class CProfileScope
+{
+public:
+    explicit CProfileScope( const CProfileSite& aSite ) NOEXCEPT
+        : iIndex{ aSite.Index( ) }
+        , iStart{ Detail::ProfileTicks( ) }
+    {
+    }
+
+    CProfileScope( const CProfileScope& ) = delete;
+    CProfileScope& operator=( const CProfileScope& ) = delete;
+
+    ~CProfileScope( )
+    {
+        CProfiler::Instance( ).RecordTicks( iIndex, Detail::ProfileTicks( ) - iStart );
+    }
+
+private:
+    const size_t iIndex;
+    const std::uint64_t iStart;
+};
+
+inline size_t
+CProfiler::Register( CProfileSite& aSite ) NOEXCEPT
+{
+    switch ( aSite.Kind( ) )
+    {
+    case TProfileSiteKind::Timer:
+        return Add( iTimers, iTimerCount, kMaxTimers, aSite );
+    case TProfileSiteKind::Counter:
+        return Add( iCounters, iCounterCount, kMaxCounters, aSite );
+    case TProfileSiteKind::Gauge:
+        return Add( iGauges, iGaugeCount, kMaxGauges, aSite );
+    }
+    return kInvalidIndex;
+}
+
+inline bool
+CProfiler::TimerStatistics( size_t aTimerIndex,
+                            TProfileTimerStatistics& aStatistics ) const NOEXCEPT
+{
+    const CProfileSite* site
+        = aTimerIndex < TimerCount( ) ? iTimers[ aTimerIndex ].load( std::memory_order_acquire )
+                                      : nullptr;
+    if ( site == nullptr )
+    {
+        return false;
+    }
+
+    using THistogram = Detail::TLogLinearHistogram;
+    std::uint64_t buckets[ THistogram::kBuckets ] = { };
+    aStatistics = TProfileTimerStatistics{ };
+    aStatistics.iName = site->Name( );
+    for ( auto* block = iBlocks.load( std::memory_order_acquire ); block != nullptr;
+          block = block->iNext )
+    {
+        const auto& cell = block->iTimers[ aTimerIndex ];
+        aStatistics.iCount += cell.iCount.load( std::memory_order_relaxed );
+        aStatistics.iTotal += cell.iTotal.load( std::memory_order_relaxed );
+        const TNanoseconds max = cell.iMax.load( std::memory_order_relaxed );
+        aStatistics.iMax = max > aStatistics.iMax ? max : aStatistics.iMax;
+        for ( size_t bucket = 0; bucket < THistogram::kBuckets; ++bucket )
+        {
+            buckets[ bucket ] += cell.iBuckets[ bucket ].load( std::memory_order_relaxed );
+        }
+    }
+
+    std::uint64_t histogramCount = 0;
+    for ( const auto count : buckets )
+    {
+        histogramCount += count;
+    }
+    const auto percentile = [ & ]( std::uint64_t aPermille ) {
+        const std::uint64_t rank = ( histogramCount * aPermille + 999 ) / 1000;
+        std::uint64_t seen = 0;
+        for ( size_t bucket = 0; bucket < THistogram::kBuckets; ++bucket )
+        {
+            seen += buckets[ bucket ];
+            if ( seen >= rank && seen > 0 )
+            {
+                const TNanoseconds upper = bucket + 1 < THistogram::kBuckets
+                                               ? THistogram::LowerBound( bucket + 1 ) - 1
+                                               : aStatistics.iMax;
+                return upper < aStatistics.iMax ? upper : aStatistics.iMax;
+            }
+        }
+        return TNanoseconds{ 0 };
+    };
+    aStatistics.iP50 = percentile( 500 );
+    aStatistics.iP90 = percentile( 900 );
+    aStatistics.iP99 = percentile( 990 );
+    return true;
+}
+
+inline const char*
+CProfiler::CounterName( size_t aCounterIndex ) const NOEXCEPT
+{
+    const CProfileSite* site
+        = aCounterIndex < CounterCount( )
+              ? iCounters[ aCounterIndex ].load( std::memory_order_acquire )
+              : nullptr;
+    return site != nullptr ? site->Name( ) : nullptr;
+}
+
+inline size_t
+CProfiler::WriteText( char* aBuffer, size_t aLength ) const NOEXCEPT
+{
+    Detail::CProfileTextWriter writer{ aBuffer, aLength };
+    TProfileTimerStatistics statistics;
+    for ( size_t index = 0; index < TimerCount( ); ++index )
+    {
+        if ( TimerStatistics( index, statistics ) )
+        {
+            writer.Append( "timer %s count=%llu total_ns=%llu mean_ns=%llu p50_ns=%llu "
+                           "p90_ns=%llu p99_ns=%llu max_ns=%llu\n",
+                           statistics.iName,
+                           static_cast< unsigned long long >( statistics.iCount ),
+                           static_cast< unsigned long long >( statistics.iTotal ),
+                           static_cast< unsigned long long >(
+                               statistics.iCount > 0 ? statistics.iTotal / statistics.iCount
+                                                     : 0 ),
+                           static_cast< unsigned long long >( statistics.iP50 ),
+                           static_cast< unsigned long long >( statistics.iP90 ),
+                           static_cast< unsigned long long >( statistics.iP99 ),
+                           static_cast< unsigned long long >( statistics.iMax ) );
+        }
+    }
+    for ( size_t index = 0; index < CounterCount( ); ++index )
+    {
+        if ( const char* name = CounterName( index ) )
+        {
+            writer.Append( "counter %s value=%llu\n",
+                           name,
+                           static_cast< unsigned long long >( CounterValue( index ) ) );
+        }
+    }
+    for ( size_t index = 0; index < GaugeCount( ); ++index )
+    {
+        if ( const CProfileSite* gauge = Gauge( index ) )
+        {
+            writer.Append( "gauge %s value=%lld\n",
+                           gauge->Name( ),
+                           static_cast< long long >( gauge->GaugeValue( ) ) );
+        }
+    }
+    return writer.Length( );
+}
+
+inline size_t
+CProfiler::WriteJson( char* aBuffer, size_t aLength ) const NOEXCEPT
+{
+    Detail::CProfileTextWriter writer{ aBuffer, aLength };
+    TProfileTimerStatistics statistics;
+    const char* separator = "";
+    writer.Append( "{\"timers\":[" );
+    for ( size_t index = 0; index < TimerCount( ); ++index )
+    {
+        if ( TimerStatistics( index, statistics ) )
+        {
+            writer.Append( "%s{\"name\":\"%s\",\"count\":%llu,\"total_ns\":%llu,"
+                           "\"p50_ns\":%llu,\"p90_ns\":%llu,\"p99_ns\":%llu,\"max_ns\":%llu}",
+                           separator,
+                           statistics.iName,
+                           static_cast< unsigned long long >( statistics.iCount ),
+                           static_cast< unsigned long long >( statistics.iTotal ),
+                           static_cast< unsigned long long >( statistics.iP50 ),
+                           static_cast< unsigned long long >( statistics.iP90 ),
+                           static_cast< unsigned long long >( statistics.iP99 ),
+                           static_cast< unsigned long long >( statistics.iMax ) );
+            separator = ",";
+        }
+    }
+    separator = "";
+    writer.Append( "],\"counters\":[" );
+    for ( size_t index = 0; index < CounterCount( ); ++index )
+    {
+        if ( const char* name = CounterName( index ) )
+        {
+            writer.Append( "%s{\"name\":\"%s\",\"value\":%llu}",
+                           separator,
+                           name,
+                           static_cast< unsigned long long >( CounterValue( index ) ) );
+            separator = ",";
+        }
+    }
+    separator = "";
+    writer.Append( "],\"gauges\":[" );
+    for ( size_t index = 0; index < GaugeCount( ); ++index )
+    {
+        if ( const CProfileSite* gauge = Gauge( index ) )
+        {
+            writer.Append( "%s{\"name\":\"%s\",\"value\":%lld}",
+                           separator,
+                           gauge->Name( ),
+                           static_cast< long long >( gauge->GaugeValue( ) ) );
+            separator = ",";
+        }
+    }
+    writer.Append( "]}" );
+    return writer.Length( );
+}
+
+inline void
+CProfiler::Reset( ) NOEXCEPT
+{
+    for ( auto* block = iBlocks.load( std::memory_order_acquire ); block != nullptr;
+          block = block->iNext )
+    {
+        for ( auto& cell : block->iTimers )
+        {
+            cell.iCount.store( 0, std::memory_order_relaxed );
+            cell.iTotal.store( 0, std::memory_order_relaxed );
+            cell.iMax.store( 0, std::memory_order_relaxed );
+            for ( auto& bucket : cell.iBuckets )
+            {
+                bucket.store( 0, std::memory_order_relaxed );
+            }
+        }
+        for ( auto& counter : block->iCounters )
+        {
+            counter.store( 0, std::memory_order_relaxed );
+        }
+    }
+    for ( size_t index = 0; index < GaugeCount( ); ++index )
+    {
+        if ( auto* gauge = iGauges[ index ].load( std::memory_order_acquire ) )
+        {
+            gauge->Set( 0 );
+        }
+    }
+}
+
+}  // namespace AbstractPlatform
+
+#define ABSTRACT_PLATFORM_PROFILE_CONCAT_IMPL( aLeft, aRight ) aLeft##aRight
+#define ABSTRACT_PLATFORM_PROFILE_CONCAT( aLeft, aRight )                                         \
+    ABSTRACT_PLATFORM_PROFILE_CONCAT_IMPL( aLeft, aRight )
+
+#ifdef PROFILING
+/// @brief Records the duration of the enclosing scope into the timer aName.
+#define PROFILE_SCOPE( aName )                                                                     \
+    static ::AbstractPlatform::CProfileSite ABSTRACT_PLATFORM_PROFILE_CONCAT( profileSite,        \
+                                                                             __LINE__ ){          \
+        aName, ::AbstractPlatform::TProfileSiteKind::Timer };                                      \
+    const ::AbstractPlatform::CProfileScope ABSTRACT_PLATFORM_PROFILE_CONCAT( profileScope,        \
+                                                                             __LINE__ ){          \
+        ABSTRACT_PLATFORM_PROFILE_CONCAT( profileSite, __LINE__ ) }
+
+/// @brief Adds aDelta to the counter aName.
+#define PROFILE_COUNT( aName, aDelta )                                                             \
+    do                                                                                             \
+    {                                                                                              \
+        static ::AbstractPlatform::CProfileSite profileSite{                                      \
+            aName, ::AbstractPlatform::TProfileSiteKind::Counter };                                \
+        profileSite.Add( static_cast< std::uint64_t >( aDelta ) );                                 \
+    } while ( false )
+
+/// @brief Sets the gauge aName to aValue.
+#define PROFILE_GAUGE( aName, aValue )                                                             \
+    do                                                                                             \
+    {                                                                                              \
+        static ::AbstractPlatform::CProfileSite profileSite{                                      \
+            aName, ::AbstractPlatform::TProfileSiteKind::Gauge };                                  \
+        profileSite.Set( static_cast< std::int64_t >( aValue ) );                                  \
+    } while ( false )
+#else
+// The arguments are not evaluated.
+#define PROFILE_SCOPE( aName ) static_cast< void >( 0 )
+#define PROFILE_COUNT( aName, aDelta ) static_cast< void >( 0 )
+#define PROFILE_GAUGE( aName, aValue ) static_cast< void >( 0 )
+#endif
@@ -0,0 +1,441 @@
+#pragma once
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/ErrorCode.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace AbstractPlatform
+{
+/**
+ * @brief The category of the error codes. Lets the error carry its origin and a description
+ * when the error category payloads are enabled (see TDefaultResultError).
+ */
+struct TErrorCategory
+{
+    const char* iName;
+    const char* ( *iDescribe )( TErrorCode aCode );
+};
+
+/**
+ * @brief Describes the platform-wide error codes declared in ErrorCode.hpp.
+ */
+inline const char*
+DescribePlatformError( TErrorCode aCode ) NOEXCEPT
+{
+    switch ( aCode )
+    {
+    case KOk:
+        return "Ok";
+    case KInvalidArgumentError:
+        return "Invalid argument";
+    case KInvalidVendor:
+        return "Invalid vendor";
+    case KIncompleteTransferError:
+        return "Incomplete transfer";
+    case KChecksumError:
+        return "Checksum mismatch";
+    case KGenericError:
+    default:
+        return "Internal error";
+    }
+}
+
+inline constexpr TErrorCategory KPlatformErrorCategory{ "platform", &DescribePlatformError };
+
+/**
+ * @brief The error code together with its category.
+ *
+ * Converts implicitly from TErrorCode with the platform category, so the code written against
+ * the plain error codes does not change when the category payloads are enabled.
+ */
+struct TCategorizedError
+{
+    constexpr TCategorizedError( ) NOEXCEPT = default;
+
+    constexpr TCategorizedError( TErrorCode aCode,
+                                 const TErrorCategory& aCategory
+                                 = KPlatformErrorCategory ) NOEXCEPT
+        : iCode{ aCode }
+        , iCategory{ &aCategory }
+    {
+    }
+
+    const char*
+    Describe( ) const NOEXCEPT
+    {
+        return iCategory->iDescribe( iCode );
+    }
+
+    constexpr bool
+    operator==( const TCategorizedError& aOther ) const NOEXCEPT
+    {
+        return iCode == aOther.iCode && iCategory == aOther.iCategory;
+    }
+
+    constexpr bool
+    operator!=( const TCategorizedError& aOther ) const NOEXCEPT
+    {
+        return !( *this == aOther );
+    }
+
+    TErrorCode iCode = KOk;
+    const TErrorCategory* iCategory = &KPlatformErrorCategory;
+};
+
+/**
+ * @brief Returns the plain error code of the error. KOk denotes no error.
+ *
+ * Custom error types used with TResult provide the overload in their namespace.
+ */
+constexpr TErrorCode
+ErrorCodeOf( TErrorCode aError ) NOEXCEPT
+{
+    return aError;
+}
+
+constexpr TErrorCode
+ErrorCodeOf( const TCategorizedError& aError ) NOEXCEPT
+{
+    return aError.iCode;
+}
+
+/**
+ * @brief The error type of TResult by default: the plain TErrorCode, or TCategorizedError if
+ * RESULT_ERROR_CATEGORY is defined (CMake option USE_RESULT_ERROR_CATEGORY).
+ */
+#ifdef RESULT_ERROR_CATEGORY
+using TDefaultResultError = TCategorizedError;
+#else
+using TDefaultResultError = TErrorCode;
+#endif
+
+/**
+ * @brief The failure to construct the TResult from. See Failure().
+ */
+template < typename taError >
+struct TFailure
+{
+    taError iError;
+};
+
+/**
+ * @brief Wraps the error to return it as the failed TResult.
+ */
+template < typename taError >
+constexpr TFailure< taError >
+Failure( taError aError ) NOEXCEPT
+{
+    return TFailure< taError >{ aError };
+}
+
+template < typename taValue, typename taError = TDefaultResultError >
+class TResult;
+
+namespace Detail
+{
+template < typename taResult >
+struct TIsResult : std::false_type
+{
+};
+
+template < typename taValue, typename taError >
+struct TIsResult< TResult< taValue, taError > > : std::true_type
+{
+};
+
+template < typename taError >
+constexpr void
+CheckResultError( const taError& aError ) NOEXCEPT
+{
+    static_assert( std::is_trivially_copyable< taError >::value,
+                   "The error type must be trivially copyable" );
+    static_assert( std::is_same< decltype( ErrorCodeOf( aError ) ), TErrorCode >::value,
+                   "The error type must provide ErrorCodeOf()" );
+    static_cast< void >( aError );
+}
+}  // namespace Detail
+
+/**
+ * @brief The value or the error, an expected-like return type replacing the int error codes and
+ * the out parameters.
+ *
+ * The value and the error are stored side by side and the result holds the value if
+ * ErrorCodeOf( Error() ) is KOk. Both types are trivially copyable, so a TResult of the register
+ * sized value and TErrorCode fits in the return registers and costs the same as returning the
+ * raw int. A default constructed error is the success, hence Failure( KOk ) is not an error.
+ *
+ * @tparam taValue The value type. Trivially copyable and default constructible.
+ * @tparam taError The error type. TDefaultResultError by default.
+ */
+template < typename taValue, typename taError >
+class TResult
+{
+    static_assert( std::is_trivially_copyable< taValue >::value
+                       && std::is_default_constructible< taValue >::value,
+                   "The value type must be trivially copyable and default constructible" );
+
+public:
+    using TValue = taValue;
+    using TError = taError;
+
+    constexpr TResult( const taValue& aValue ) NOEXCEPT
+        : iValue{ aValue }
+        , iError{ }
+    {
+    }
+
+    template < typename taOtherError >
+    constexpr TResult( TFailure< taOtherError > aFailure ) NOEXCEPT
+        : iValue{ }
+        , iError{ aFailure.iError }
+    {
+        Detail::CheckResultError( iError );
+    }
+
+    constexpr bool
+    HasValue( ) const NOEXCEPT
+    {
+        return ErrorCodeOf( iError ) == KOk;
+    }
+
+    constexpr explicit operator bool( ) const NOEXCEPT
+    {
+        return HasValue( );
+    }
+
+    /**
+     * @brief Returns the value. Valid only if HasValue().
+     */
+    constexpr const taValue&
+    Value( ) const NOEXCEPT
+    {
+        return iValue;
+    }
+
+    constexpr const taValue&
+    operator*( ) const NOEXCEPT
+    {
+        return iValue;
+    }
+
+    constexpr const taError&
+    Error( ) const NOEXCEPT
+    {
+        return iError;
+    }
+
+    constexpr taValue
+    ValueOr( const taValue& aDefault ) const NOEXCEPT
+    {
+        return HasValue( ) ? iValue : aDefault;
+    }
+
+    /**
+     * @brief Calls aFunction( Value() ) returning the TResult with the same error type, or
+     * propagates the error.
+     */
+    template < typename taFunction >
+    constexpr auto
+    AndThen( taFunction&& aFunction ) const
+    {
+        using TNext = std::decay_t< decltype( aFunction( iValue ) ) >;
+        static_assert( Detail::TIsResult< TNext >::value, "The function must return TResult" );
+        if ( !HasValue( ) )
+        {
+            return TNext{ Failure( iError ) };
+        }
+        return aFunction( iValue );
+    }
+
+    /**
+     * @brief Maps the value with aFunction( Value() ), or propagates the error.
+     */
+    template < typename taFunction >
+    constexpr auto
+    Transform( taFunction&& aFunction ) const
+    {
+        using TMapped = std::decay_t< decltype( aFunction( iValue ) ) >;
+        using TNext = TResult< TMapped, taError >;
+        if ( !HasValue( ) )
+        {
+            return TNext{ Failure( iError ) };
+        }
+        if constexpr ( std::is_void< TMapped >::value )
+        {
+            aFunction( iValue );
+            return TNext{ };
+        }
+        else
+        {
+            return TNext{ aFunction( iValue ) };
+        }
+    }
+
+    /**
+     * @brief Calls aFunction( Error() ) returning the TResult with the same value type to recover
+     * from the error, or passes the value through.
+     */
+    template < typename taFunction >
+    constexpr TResult
+    OrElse( taFunction&& aFunction ) const
+    {
+        return HasValue( ) ? *this : TResult{ aFunction( iError ) };
+    }
+
+    /**
+     * @brief Maps the error with aFunction( Error() ), or passes the value through.
+     */
+    template < typename taFunction >
+    constexpr auto
+    TransformError( taFunction&& aFunction ) const
+    {
+        using TNext = TResult< taValue, std::decay_t< decltype( aFunction( iError ) ) > >;
+        return HasValue( ) ? TNext{ iValue } : TNext{ Failure( aFunction( iError ) ) };
+    }
+
+#ifdef __EXCEPTIONS
+    /**
+     * @brief Returns the value or throws the exception matching the error code (see
+     * ThrowOnError()).
+     */
+    taValue
+    ValueOrThrow( ) const
+    {
+        ThrowOnError( ErrorCodeOf( iError ) );
+        return iValue;
+    }
+#endif
+
+private:
+    taValue iValue;
+    taError iError;
+};
+
+/**
+ * @brief The success or the error, the replacement of the plain TErrorCode return value. Holds
+ * nothing but the error, so TResult< void > is exactly as large as TErrorCode.
+ */
+template < typename taError >
+class TResult< void, taError >
+{
+public:
+    using TValue = void;
+    using TError = taError;
+
+    constexpr TResult( ) NOEXCEPT = default;
+
+    template < typename taOtherError >
+    constexpr TResult( TFailure< taOtherError > aFailure ) NOEXCEPT
+        : iError{ aFailure.iError }
+    {
+        Detail::CheckResultError( iError );
+    }
+
+    constexpr bool
+    HasValue( ) const NOEXCEPT
+    {
+        return ErrorCodeOf( iError ) == KOk;
+    }
+
+    constexpr explicit operator bool( ) const NOEXCEPT
+    {
+        return HasValue( );
+    }
+
+    constexpr const taError&
+    Error( ) const NOEXCEPT
+    {
+        return iError;
+    }
+
+    template < typename taFunction >
+    constexpr auto
+    AndThen( taFunction&& aFunction ) const
+    {
+        using TNext = std::decay_t< decltype( aFunction( ) ) >;
+        static_assert( Detail::TIsResult< TNext >::value, "The function must return TResult" );
+        if ( !HasValue( ) )
+        {
+            return TNext{ Failure( iError ) };
+        }
+        return aFunction( );
+    }
+
+    template < typename taFunction >
+    constexpr auto
+    Transform( taFunction&& aFunction ) const
+    {
+        using TMapped = std::decay_t< decltype( aFunction( ) ) >;
+        using TNext = TResult< TMapped, taError >;
+        if ( !HasValue( ) )
+        {
+            return TNext{ Failure( iError ) };
+        }
+        if constexpr ( std::is_void< TMapped >::value )
+        {
+            aFunction( );
+            return TNext{ };
+        }
+        else
+        {
+            return TNext{ aFunction( ) };
+        }
+    }
+
+    template < typename taFunction >
+    constexpr TResult
+    OrElse( taFunction&& aFunction ) const
+    {
+        return HasValue( ) ? *this : TResult{ aFunction( iError ) };
+    }
+
+    template < typename taFunction >
+    constexpr auto
+    TransformError( taFunction&& aFunction ) const
+    {
+        using TNext = TResult< void, std::decay_t< decltype( aFunction( iError ) ) > >;
+        return HasValue( ) ? TNext{ } : TNext{ Failure( aFunction( iError ) ) };
+    }
+
+#ifdef __EXCEPTIONS
+    void
+    ValueOrThrow( ) const
+    {
+        ThrowOnError( ErrorCodeOf( iError ) );
+    }
+#endif
+
+private:
+    taError iError{ };
+};
+
+/**
+ * @brief Converts the legacy error code to TResult< void >.
+ */
+constexpr TResult< void >
+ToResult( TErrorCode aErrorCode ) NOEXCEPT
+{
+    return aErrorCode == KOk ? TResult< void >{ } : TResult< void >{ Failure( aErrorCode ) };
+}
+
+/**
+ * @brief Converts the result to the legacy error code.
+ */
+template < typename taValue, typename taError >
+constexpr TErrorCode
+ToErrorCode( const TResult< taValue, taError >& aResult ) NOEXCEPT
+{
+    return ErrorCodeOf( aResult.Error( ) );
+}
+
+/**
+ * @brief The TResult counterpart of RETURN_ON_ERROR: returns the error of the failed result
+ * from the enclosing function returning TResult.
+ */
+#define RETURN_IF_FAILED( aResult )                                     \
+    if ( const auto& failedResult = ( aResult ); !failedResult )        \
+    {                                                                   \
+        return ::AbstractPlatform::Failure( failedResult.Error( ) );    \
+    }
+}  // namespace AbstractPlatform
@@ -0,0 +1,459 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Memory.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace AbstractPlatform
+{
+/**
+ * @brief The contiguous part of the ring storage reserved for the zero-copy write or read.
+ */
+template < typename taValue >
+struct TRingRegion
+{
+    taValue* iData = nullptr;
+    size_t iCount = 0;
+    /// @brief The ring position of the first element.
+    size_t iPosition = 0;
+};
+
+/**
+ * @brief The lock-free single-producer single-consumer ring buffer.
+ *
+ * Push() may only be called from a single producer thread and Pop() from a single consumer
+ * thread at a time. The elements are copied in and out, so the consumer takes them in bulk
+ * with a single pair of atomic operations. Each side keeps its index together with the cached
+ * copy of the other side index on its own cache line and reloads the other index only when the
+ * cached one shows the ring full (empty), so the lines do not bounce on every operation.
+ *
+ * ReserveWrite()/CommitWrite() and ReserveRead()/CommitRead() give the direct access to the
+ * ring storage, e.g. to read the bus straight into the ring.
+ *
+ * @tparam taValue The trivially copyable element type.
+ * @tparam taCapacity The count of the elements. Has to be a power of 2.
+ */
+template < typename taValue, size_t taCapacity >
+class TSpscRing
+{
+public:
+    static_assert( taCapacity > 0 && ( taCapacity & ( taCapacity - 1 ) ) == 0,
+                   "taCapacity has to be a power of 2" );
+    static_assert( std::is_trivially_copyable< taValue >::value,
+                   "taValue has to be trivially copyable" );
+
+    static constexpr size_t
+    Capacity( ) NOEXCEPT
+    {
+        return taCapacity;
+    }
+
+    /**
+     * @brief Appends the element. Producer side.
+     *
+     * @return true If operation succeed, false if the ring is full.
+     */
+    bool
+    Push( const taValue& aValue ) NOEXCEPT
+    {
+        return Push( &aValue, 1 ) == 1;
+    }
+
+    /**
+     * @brief Appends as many elements as there is free space for. Producer side.
+     *
+     * @return size_t The count of the appended elements.
+     */
+    size_t
+    Push( const taValue* aValues, size_t aCount ) NOEXCEPT
+    {
+        const size_t tail = iTail.load( std::memory_order_relaxed );
+        const size_t count = Min( aCount, Writable( tail, aCount ) );
+        const size_t offset = tail & kMask;
+        const size_t first = Min( count, taCapacity - offset );
+        std::copy( aValues, aValues + first, iElements + offset );
+        std::copy( aValues + first, aValues + count, iElements );
+        iTail.store( tail + count, std::memory_order_release );
+        return count;
+    }
+
+    /**
+     * @brief Takes the oldest element. Consumer side.
+     *
+     * @return true If operation succeed, false if the ring is empty.
+     */
+    bool
+    Pop( taValue& aValue ) NOEXCEPT
+    {
+        return Pop( &aValue, 1 ) == 1;
+    }
+
+    /**
+     * @brief Takes up to aCount oldest elements. Consumer side.
+     *
+     * @return size_t The count of the taken elements.
+     */
+    size_t
+    Pop( taValue* aValues, size_t aCount ) NOEXCEPT
+    {
+        const size_t head = iHead.load( std::memory_order_relaxed );
+        const size_t count = Min( aCount, Readable( head, aCount ) );
+        const size_t offset = head & kMask;
+        const size_t first = Min( count, taCapacity - offset );
+        std::copy( iElements + offset, iElements + offset + first, aValues );
+        std::copy( iElements, iElements + ( count - first ), aValues + first );
+        iHead.store( head + count, std::memory_order_release );
+        return count;
+    }
+
+    /**
+     * @brief Reserves up to aMaxCount free elements following each other in the storage.
+     * Producer side. The region is shorter than requested if the ring is nearly full or the
+     * free space wraps around the end of the storage.
+     *
+     * @return TRingRegion< taValue > The region to fill, empty if the ring is full.
+     */
+    TRingRegion< taValue >
+    ReserveWrite( size_t aMaxCount ) NOEXCEPT
+    {
+        const size_t tail = iTail.load( std::memory_order_relaxed );
+        const size_t offset = tail & kMask;
+        const size_t count
+            = Min( Min( aMaxCount, taCapacity - offset ), Writable( tail, aMaxCount ) );
+        return { iElements + offset, count, tail };
+    }
+
+    /**
+     * @brief Publishes the region filled by the producer. The iCount of the region may be
+     * lowered to publish only its first elements.
+     */
+    void
+    CommitWrite( const TRingRegion< taValue >& aRegion ) NOEXCEPT
+    {
+        assert( aRegion.iPosition == iTail.load( std::memory_order_relaxed ) );
+        iTail.store( aRegion.iPosition + aRegion.iCount, std::memory_order_release );
+    }
+
+    /**
+     * @brief Reserves up to aMaxCount oldest elements following each other in the storage.
+     * Consumer side.
+     *
+     * @return TRingRegion< taValue > The region to read, empty if the ring is empty.
+     */
+    TRingRegion< taValue >
+    ReserveRead( size_t aMaxCount ) NOEXCEPT
+    {
+        const size_t head = iHead.load( std::memory_order_relaxed );
+        const size_t offset = head & kMask;
+        const size_t count
+            = Min( Min( aMaxCount, taCapacity - offset ), Readable( head, aMaxCount ) );
+        return { iElements + offset, count, head };
+    }
+
+    /**
+     * @brief Releases the region read by the consumer. The iCount of the region may be lowered
+     * to release only its first elements.
+     */
+    void
+    CommitRead( const TRingRegion< taValue >& aRegion ) NOEXCEPT
+    {
+        assert( aRegion.iPosition == iHead.load( std::memory_order_relaxed ) );
+        iHead.store( aRegion.iPosition + aRegion.iCount, std::memory_order_release );
+    }
+
+    /**
+     * @brief Returns the count of the stored elements. Exact only when called from the producer
+     * or the consumer thread while the other side is idle.
+     */
+    size_t
+    Size( ) const NOEXCEPT
+    {
+        return iTail.load( std::memory_order_acquire ) - iHead.load( std::memory_order_acquire );
+    }
+
+    bool
+    IsEmpty( ) const NOEXCEPT
+    {
+        return Size( ) == 0;
+    }
+
+private:
+    static constexpr size_t kMask = taCapacity - 1;
+
+    static constexpr size_t
+    Min( size_t aLeft, size_t aRight ) NOEXCEPT
+    {
+        return aLeft < aRight ? aLeft : aRight;
+    }
+
+    /// @brief Returns the count of the free elements, up to aWanted if possible. Producer side.
+    size_t
+    Writable( size_t aTail, size_t aWanted ) NOEXCEPT
+    {
+        size_t free = taCapacity - ( aTail - iCachedHead );
+        if ( free < aWanted )
+        {
+            iCachedHead = iHead.load( std::memory_order_acquire );
+            free = taCapacity - ( aTail - iCachedHead );
+        }
+        return free;
+    }
+
+    /// @brief Returns the count of the stored elements, up to aWanted if possible. Consumer side.
+    size_t
+    Readable( size_t aHead, size_t aWanted ) NOEXCEPT
+    {
+        size_t stored = iCachedTail - aHead;
+        if ( stored < aWanted )
+        {
+            iCachedTail = iTail.load( std::memory_order_acquire );
+            stored = iCachedTail - aHead;
+        }
+        return stored;
+    }
+
+    // The consumer line.
+    alignas( KCacheLineSize ) std::atomic< size_t > iHead{ 0 };
+    size_t iCachedTail = 0;
+    // The producer line.
+    alignas( KCacheLineSize ) std::atomic< size_t > iTail{ 0 };
+    size_t iCachedHead = 0;
+    alignas( KCacheLineSize ) taValue iElements[ taCapacity ];
+};
+
+/**
+ * @brief The lock-free bounded multi-producer multi-consumer ring buffer (the D. Vyukov
+ * algorithm).
+ *
+ * Every element has the sequence number telling which lap of the ring it belongs to and whether
+ * it is free or filled, so a producer (consumer) takes the position with a single
+ * compare-and-swap and publishes the element with a single store, without waiting for the other
+ * producers (consumers). The producer and the consumer positions are on separate cache lines.
+ *
+ * ReserveWrite()/ReserveRead() take several positions following each other at once. The region
+ * has to be committed whole, the other threads skip nothing but wait at the reserved elements
+ * until they are committed.
+ *
+ * @tparam taValue The trivially copyable element type.
+ * @tparam taCapacity The count of the elements. Has to be a power of 2.
+ */
+template < typename taValue, size_t taCapacity >
+class TMpmcRing
+{
+public:
+    static_assert( taCapacity > 1 && ( taCapacity & ( taCapacity - 1 ) ) == 0,
+                   "taCapacity has to be a power of 2 greater than 1" );
+    static_assert( std::is_trivially_copyable< taValue >::value,
+                   "taValue has to be trivially copyable" );
+
+    TMpmcRing( )
+    {
+        for ( size_t index = 0; index < taCapacity; ++index )
+        {
+            iSequences[ index ].store( index, std::memory_order_relaxed );
+        }
+    }
+
+    TMpmcRing( const TMpmcRing& ) = delete;
+    TMpmcRing& operator=( const TMpmcRing& ) = delete;
+
+    static constexpr size_t
+    Capacity( ) NOEXCEPT
+    {
+        return taCapacity;
+    }
+
+    /**
+     * @brief Appends the element. May be called from any thread.
+     *
+     * @return true If operation succeed, false if the ring is full.
+     */
+    bool
+    Push( const taValue& aValue ) NOEXCEPT
+    {
+        return Push( &aValue, 1 ) == 1;
+    }
+
+    /**
+     * @brief Appends as many elements as there is free space for. May be called from any thread.
+     * The elements may interleave with the elements of the other producers.
+     *
+     * @return size_t The count of the appended elements.
+     */
+    size_t
+    Push( const taValue* aValues, size_t aCount ) NOEXCEPT
+    {
+        size_t pushed = 0;
+        while ( pushed < aCount )
+        {
+            const auto region = ReserveWrite( aCount - pushed );
+            if ( region.iCount == 0 )
+            {
+                break;
+            }
+            std::copy( aValues + pushed, aValues + pushed + region.iCount, region.iData );
+            CommitWrite( region );
+            pushed += region.iCount;
+        }
+        return pushed;
+    }
+
+    /**
+     * @brief Takes the oldest element. May be called from any thread.
+     *
+     * @return true If operation succeed, false if the ring is empty.
+     */
+    bool
+    Pop( taValue& aValue ) NOEXCEPT
+    {
+        return Pop( &aValue, 1 ) == 1;
+    }
+
+    /**
+     * @brief Takes up to aCount oldest elements. May be called from any thread.
+     *
+     * @return size_t The count of the taken elements.
+     */
+    size_t
+    Pop( taValue* aValues, size_t aCount ) NOEXCEPT
+    {
+        size_t popped = 0;
+        while ( popped < aCount )
+        {
+            const auto region = ReserveRead( aCount - popped );
+            if ( region.iCount == 0 )
+            {
+                break;
+            }
+            std::copy( region.iData, region.iData + region.iCount, aValues + popped );
+            CommitRead( region );
+            popped += region.iCount;
+        }
+        return popped;
+    }
+
+    /**
+     * @brief Reserves up to aMaxCount free elements following each other in the storage.
+     *
+     * @return TRingRegion< taValue > The region to fill, empty if the ring is full.
+     */
+    TRingRegion< taValue >
+    ReserveWrite( size_t aMaxCount ) NOEXCEPT
+    {
+        return Reserve( iEnqueuePosition, 0, aMaxCount );
+    }
+
+    /**
+     * @brief Publishes the whole reserved region to the consumers.
+     */
+    void
+    CommitWrite( const TRingRegion< taValue >& aRegion ) NOEXCEPT
+    {
+        Commit( aRegion, 1 );
+    }
+
+    /**
+     * @brief Reserves up to aMaxCount oldest elements following each other in the storage.
+     *
+     * @return TRingRegion< taValue > The region to read, empty if the ring is empty.
+     */
+    TRingRegion< taValue >
+    ReserveRead( size_t aMaxCount ) NOEXCEPT
+    {
+        return Reserve( iDequeuePosition, 1, aMaxCount );
+    }
+
+    /**
+     * @brief Returns the whole reserved region to the producers.
+     */
+    void
+    CommitRead( const TRingRegion< taValue >& aRegion ) NOEXCEPT
+    {
+        Commit( aRegion, taCapacity );
+    }
+
+    /**
+     * @brief Returns the count of the stored elements. Approximate while the ring is in use.
+     */
+    size_t
+    Size( ) const NOEXCEPT
+    {
+        const size_t dequeue = iDequeuePosition.load( std::memory_order_relaxed );
+        const size_t enqueue = iEnqueuePosition.load( std::memory_order_relaxed );
+        return enqueue > dequeue ? enqueue - dequeue : 0;
+    }
+
+    bool
+    IsEmpty( ) const NOEXCEPT
+    {
+        return Size( ) == 0;
+    }
+
+private:
+    static constexpr size_t kMask = taCapacity - 1;
+
+    /**
+     * @brief Takes the positions whose sequence is the position plus aLag: 0 for the free
+     * elements (the producers), 1 for the filled ones (the consumers).
+     */
+    TRingRegion< taValue >
+    Reserve( std::atomic< size_t >& aPosition, size_t aLag, size_t aMaxCount ) NOEXCEPT
+    {
+        size_t position = aPosition.load( std::memory_order_relaxed );
+        while ( aMaxCount > 0 )
+        {
+            const auto difference = static_cast< std::ptrdiff_t >(
+                iSequences[ position & kMask ].load( std::memory_order_acquire )
+                - ( position + aLag ) );
+            if ( difference < 0 )
+            {
+                // The element of the previous lap is not released yet: full (empty).
+                break;
+            }
+            if ( difference > 0 )
+            {
+                // Another thread has taken the position.
+                position = aPosition.load( std::memory_order_relaxed );
+                continue;
+            }
+
+            const size_t limit = std::min( aMaxCount, taCapacity - ( position & kMask ) );
+            size_t count = 1;
+            while ( count < limit
+                    && iSequences[ ( position + count ) & kMask ].load( std::memory_order_acquire )
+                           == position + count + aLag )
+            {
+                ++count;
+            }
+            if ( aPosition.compare_exchange_weak(
+                     position, position + count, std::memory_order_relaxed ) )
+            {
+                return { iElements + ( position & kMask ), count, position };
+            }
+        }
+        return { nullptr, 0, position };
+    }
+
+    void
+    Commit( const TRingRegion< taValue >& aRegion, size_t aLag ) NOEXCEPT
+    {
+        for ( size_t index = 0; index < aRegion.iCount; ++index )
+        {
+            const size_t position = aRegion.iPosition + index;
+            iSequences[ position & kMask ].store( position + aLag, std::memory_order_release );
+        }
+    }
+
+    alignas( KCacheLineSize ) std::atomic< size_t > iEnqueuePosition{ 0 };
+    alignas( KCacheLineSize ) std::atomic< size_t > iDequeuePosition{ 0 };
+    alignas( KCacheLineSize ) std::atomic< size_t > iSequences[ taCapacity ];
+    alignas( KCacheLineSize ) taValue iElements[ taCapacity ];
+};
+
+}  // namespace AbstractPlatform
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Memory.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace AbstractPlatform
+{
+/**
+ * @brief The single-writer multi-reader latest value channel guarded by a seqlock.
+ *
+ * The writer never waits for the readers: Write() bumps the sequence to odd, copies the value in
+ * and bumps the sequence to even again. A reader copies the value out and retries if the sequence
+ * was odd or changed meanwhile, so it always returns a consistent value, the latest completely
+ * written one. The value is copied through relaxed atomic words, so the concurrent copies are not
+ * a data race.
+ *
+ * Write() may only be called from a single writer thread at a time. The readers of the large
+ * value retry more often under the high write rate; use TDoubleBufferedSnapshot for those.
+ *
+ * @tparam taValue The trivially copyable value type.
+ */
+template < typename taValue >
+class TSnapshot
+{
+    static_assert( std::is_trivially_copyable< taValue >::value,
+                   "The snapshot value must be trivially copyable" );
+
+public:
+    TSnapshot( ) NOEXCEPT
+        : TSnapshot( taValue{ } )
+    {
+    }
+
+    explicit TSnapshot( const taValue& aValue ) NOEXCEPT
+    {
+        StoreWords( aValue );
+    }
+
+    TSnapshot( const TSnapshot& ) = delete;
+    TSnapshot& operator=( const TSnapshot& ) = delete;
+
+    /**
+     * @brief Publishes the value. Writer side, wait-free.
+     */
+    void
+    Write( const taValue& aValue ) NOEXCEPT
+    {
+        const std::uint32_t sequence = iSequence.load( std::memory_order_relaxed );
+        iSequence.store( sequence + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        StoreWords( aValue );
+        iSequence.store( sequence + 2, std::memory_order_release );
+    }
+
+    /**
+     * @brief Makes one attempt to copy the latest value out. Reader side, wait-free.
+     *
+     * @param aValue The value, modified even if the attempt fails.
+     * @return true if aValue is consistent, false if a write interfered.
+     */
+    bool
+    TryRead( taValue& aValue ) const NOEXCEPT
+    {
+        const std::uint32_t sequence = iSequence.load( std::memory_order_acquire );
+        if ( ( sequence & 1u ) != 0 )
+        {
+            return false;
+        }
+        LoadWords( aValue );
+        std::atomic_thread_fence( std::memory_order_acquire );
+        return iSequence.load( std::memory_order_relaxed ) == sequence;
+    }
+
+    /**
+     * @brief Returns the latest value, retrying until no write interferes. Reader side.
+     */
+    taValue
+    Read( ) const NOEXCEPT
+    {
+        taValue value;
+        while ( !TryRead( value ) )
+        {
+            std::this_thread::yield( );
+        }
+        return value;
+    }
+
+    /**
+     * @brief Returns the count of the writes completed or started, to tell whether the value
+     * changed since the previous read.
+     */
+    std::uint32_t
+    Version( ) const NOEXCEPT
+    {
+        return ( iSequence.load( std::memory_order_acquire ) + 1 ) >> 1;
+    }
+
+private:
+    using TWord = std::uintptr_t;
+    static constexpr size_t kWordCount
+        = ( sizeof( taValue ) + sizeof( TWord ) - 1 ) / sizeof( TWord );
+
+    static_assert( std::atomic< TWord >::is_always_lock_free,
+                   "The snapshot requires lock-free word atomics" );
+
+    void
+    StoreWords( const taValue& aValue ) NOEXCEPT
+    {
+        TWord words[ kWordCount ] = { };
+        std::memcpy( words, &aValue, sizeof( taValue ) );
+        for ( size_t index = 0; index < kWordCount; ++index )
+        {
+            iWords[ index ].store( words[ index ], std::memory_order_relaxed );
+        }
+    }
+
+    void
+    LoadWords( taValue& aValue ) const NOEXCEPT
+    {
+        TWord words[ kWordCount ];
+        for ( size_t index = 0; index < kWordCount; ++index )
+        {
+            words[ index ] = iWords[ index ].load( std::memory_order_relaxed );
+        }
+        std::memcpy( &aValue, words, sizeof( taValue ) );
+    }
+
+    alignas( KCacheLineSize ) std::atomic< std::uint32_t > iSequence{ 0 };
+    std::atomic< TWord > iWords[ kWordCount ];
+};
+
+/**
+ * @brief The TSnapshot variant for the large values: the writer fills the slot the readers are
+ * not directed to and then publishes it.
+ *
+ * A reader copying the published slot is only interfered with if the writer completes a whole
+ * write to the other slot and starts the next one into this slot meanwhile, so the long copies
+ * are retried much less often than with TSnapshot, at the cost of twice the memory.
+ *
+ * @tparam taValue The trivially copyable value type.
+ */
+template < typename taValue >
+class TDoubleBufferedSnapshot
+{
+public:
+    TDoubleBufferedSnapshot( ) NOEXCEPT = default;
+
+    explicit TDoubleBufferedSnapshot( const taValue& aValue ) NOEXCEPT
+        : iSlots{ TSnapshot< taValue >{ aValue }, TSnapshot< taValue >{ aValue } }
+    {
+    }
+
+    TDoubleBufferedSnapshot( const TDoubleBufferedSnapshot& ) = delete;
+    TDoubleBufferedSnapshot& operator=( const TDoubleBufferedSnapshot& ) = delete;
+
+    /**
+     * @brief Publishes the value. Writer side, wait-free.
+     */
+    void
+    Write( const taValue& aValue ) NOEXCEPT
+    {
+        const std::uint32_t version = iVersion.load( std::memory_order_relaxed ) + 1;
+        iSlots[ version & 1u ].Write( aValue );
+        iVersion.store( version, std::memory_order_release );
+    }
+
+    /**
+     * @brief Makes one attempt to copy the latest value out. Reader side, wait-free.
+     *
+     * @param aValue The value, modified even if the attempt fails.
+     * @return true if aValue is consistent, false if the writes interfered.
+     */
+    bool
+    TryRead( taValue& aValue ) const NOEXCEPT
+    {
+        return iSlots[ iVersion.load( std::memory_order_acquire ) & 1u ].TryRead( aValue );
+    }
+
+    /**
+     * @brief Returns the latest value, retrying until no write interferes. Reader side.
+     */
+    taValue
+    Read( ) const NOEXCEPT
+    {
+        taValue value;
+        while ( !TryRead( value ) )
+        {
+            std::this_thread::yield( );
+        }
+        return value;
+    }
+
+    /**
+     * @brief Returns the count of the published writes.
+     */
+    std::uint32_t
+    Version( ) const NOEXCEPT
+    {
+        return iVersion.load( std::memory_order_acquire );
+    }
+
+private:
+    alignas( KCacheLineSize ) std::atomic< std::uint32_t > iVersion{ 0 };
+    TSnapshot< taValue > iSlots[ 2 ];
+};
+
+}  // namespace AbstractPlatform
@@ -3,8 +3,18 @@
 #include <AbstractPlatform/common/Platform.hpp>
 
 #include <cstdint>
+#include <cstring>
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <tmmintrin.h>
+#define ABSTRACT_PLATFORM_X86_SIMD
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#define ABSTRACT_PLATFORM_NEON_SIMD
+#endif
 
 namespace AbstractPlatform
 {
@@ -18,17 +28,230 @@ enum class Endianness
 {
     Little,  // a[0] = 0D, a[1] = 0C, ... a[3] = 0A
     Big,     // a[0] = 0A, a[1] = 0B, ... a[3] = 0D
+#if defined( __BYTE_ORDER__ ) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    Native = Big
+#elif ( defined( __BYTE_ORDER__ ) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ) \
+    || defined( _WIN32 )
     Native = Little
+#else
+#error "The native byte order of the target is unknown"
+#endif
+};
+
+namespace Detail
+{
+template < size_t taSize >
+struct TUnsignedOfSize
+{
+};
+
+template <>
+struct TUnsignedOfSize< 1 >
+{
+    using TType = std::uint8_t;
 };
 
+template <>
+struct TUnsignedOfSize< 2 >
+{
+    using TType = std::uint16_t;
+};
+
+template <>
+struct TUnsignedOfSize< 4 >
+{
+    using TType = std::uint32_t;
+};
+
+template <>
+struct TUnsignedOfSize< 8 >
+{
+    using TType = std::uint64_t;
+};
+
+template < typename taUnsigned >
+constexpr taUnsigned
+ByteSwapUnsigned( taUnsigned aValue ) NOEXCEPT
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    if constexpr ( sizeof( taUnsigned ) == 2 )
+    {
+        return __builtin_bswap16( aValue );
+    }
+    else if constexpr ( sizeof( taUnsigned ) == 4 )
+    {
+        return __builtin_bswap32( aValue );
+    }
+    else if constexpr ( sizeof( taUnsigned ) == 8 )
+    {
+        return __builtin_bswap64( aValue );
+    }
+    else
+    {
+        return aValue;
+    }
+#else
+    taUnsigned swapped = 0;
+    for ( size_t byte = 0; byte < sizeof( taUnsigned ); ++byte )
+    {
+        swapped = static_cast< taUnsigned >( ( swapped << 8 )
+                                             | ( ( aValue >> ( 8 * byte ) ) & 0xFF ) );
+    }
+    return swapped;
+#endif
+}
+
+#if defined( ABSTRACT_PLATFORM_X86_SIMD )
+/// @brief Swaps the bytes of the aValueSize-byte values in 16-byte blocks with the SSSE3 pshufb.
+__attribute__( ( target( "ssse3" ) ) ) inline size_t
+ByteSwapBlocksSsse3( const std::uint8_t* aSource,
+                     std::uint8_t* aDestination,
+                     size_t aLength,
+                     size_t aValueSize ) NOEXCEPT
+{
+    const __m128i mask
+        = aValueSize == 2
+              ? _mm_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 )
+              : ( aValueSize == 4
+                      ? _mm_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 )
+                      : _mm_setr_epi8( 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 ) );
+
+    size_t offset = 0;
+    for ( ; offset + 32 <= aLength; offset += 32 )
+    {
+        const __m128i first
+            = _mm_loadu_si128( reinterpret_cast< const __m128i* >( aSource + offset ) );
+        const __m128i second
+            = _mm_loadu_si128( reinterpret_cast< const __m128i* >( aSource + offset + 16 ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( aDestination + offset ),
+                          _mm_shuffle_epi8( first, mask ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( aDestination + offset + 16 ),
+                          _mm_shuffle_epi8( second, mask ) );
+    }
+    for ( ; offset + 16 <= aLength; offset += 16 )
+    {
+        const __m128i block
+            = _mm_loadu_si128( reinterpret_cast< const __m128i* >( aSource + offset ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( aDestination + offset ),
+                          _mm_shuffle_epi8( block, mask ) );
+    }
+    return offset;
+}
+#endif
+
+/**
+ * @brief Swaps the bytes of the aValueSize-byte values (2, 4 or 8) in the SIMD-sized blocks.
+ *
+ * @return size_t The count of the bytes processed, a multiple of the SIMD block size. The rest
+ * is left to the scalar code.
+ */
+inline size_t
+ByteSwapBlocks( const std::uint8_t* aSource,
+                std::uint8_t* aDestination,
+                size_t aLength,
+                size_t aValueSize ) NOEXCEPT
+{
+#if defined( ABSTRACT_PLATFORM_X86_SIMD )
+#if defined( __SSSE3__ )
+    return ByteSwapBlocksSsse3( aSource, aDestination, aLength, aValueSize );
+#else
+    static const bool kHasSsse3 = __builtin_cpu_supports( "ssse3" );
+    return kHasSsse3 ? ByteSwapBlocksSsse3( aSource, aDestination, aLength, aValueSize ) : 0;
+#endif
+#elif defined( ABSTRACT_PLATFORM_NEON_SIMD )
+    size_t offset = 0;
+    for ( ; offset + 16 <= aLength; offset += 16 )
+    {
+        const uint8x16_t block = vld1q_u8( aSource + offset );
+        const uint8x16_t swapped
+            = aValueSize == 2 ? vrev16q_u8( block )
+                              : ( aValueSize == 4 ? vrev32q_u8( block ) : vrev64q_u8( block ) );
+        vst1q_u8( aDestination + offset, swapped );
+    }
+    return offset;
+#else
+    ( void )aSource;
+    ( void )aDestination;
+    ( void )aLength;
+    ( void )aValueSize;
+    return 0;
+#endif
+}
+}  // namespace Detail
+
+/**
+ * @brief Reverses the byte order of the value.
+ *
+ * Integral and enumeration values are swapped with the compiler byte swap intrinsics and the
+ * swap is usable in the constant expressions. Other trivially copyable types (e.g. float) are
+ * swapped through their binary representation.
+ */
 template < typename taT >
 static constexpr taT
 ByteSwap( taT aValue ) NOEXCEPT
 {
-    using TProxyArray = std::uint8_t( & )[ sizeof( taT ) ];
-    auto& byteArray = reinterpret_cast< TProxyArray& >( aValue );
-    std::reverse( std::begin( byteArray ), std::end( byteArray ) );
-    return aValue;
+    if constexpr ( std::is_integral< taT >::value && sizeof( taT ) > 1 )
+    {
+        using TUnsigned = typename std::make_unsigned< taT >::type;
+        return static_cast< taT >(
+            Detail::ByteSwapUnsigned( static_cast< TUnsigned >( aValue ) ) );
+    }
+    else if constexpr ( std::is_enum< taT >::value )
+    {
+        using TUnderlying = typename std::underlying_type< taT >::type;
+        return static_cast< taT >( ByteSwap( static_cast< TUnderlying >( aValue ) ) );
+    }
+    else if constexpr ( sizeof( taT ) == 1 )
+    {
+        return aValue;
+    }
+    else if constexpr ( sizeof( taT ) == 2 || sizeof( taT ) == 4 || sizeof( taT ) == 8 )
+    {
+        using TUnsigned = typename Detail::TUnsignedOfSize< sizeof( taT ) >::TType;
+        TUnsigned bits;
+        std::memcpy( &bits, &aValue, sizeof( bits ) );
+        bits = Detail::ByteSwapUnsigned( bits );
+        std::memcpy( &aValue, &bits, sizeof( bits ) );
+        return aValue;
+    }
+    else
+    {
+        using TProxyArray = std::uint8_t( & )[ sizeof( taT ) ];
+        auto& byteArray = reinterpret_cast< TProxyArray& >( aValue );
+        std::reverse( std::begin( byteArray ), std::end( byteArray ) );
+        return aValue;
+    }
+}
+
+/**
+ * @brief Reverses the byte order of every value of the array.
+ *
+ * The bulk of the array is swapped with the SIMD byte shuffles (SSSE3 pshufb, selected at run
+ * time unless enabled at compile time, or NEON vrev) and the tail value by value.
+ *
+ * @param aSource The source values.
+ * @param aDestination The destination values. May be equal to aSource, must not overlap it
+ * otherwise.
+ * @param aCount The count of the values.
+ */
+template < typename taT >
+void
+ByteSwapN( const taT* aSource, taT* aDestination, size_t aCount ) NOEXCEPT
+{
+    static_assert( std::is_trivially_copyable< taT >::value, "taT has to be trivially copyable" );
+
+    size_t done = 0;
+    if constexpr ( sizeof( taT ) == 2 || sizeof( taT ) == 4 || sizeof( taT ) == 8 )
+    {
+        done = Detail::ByteSwapBlocks( reinterpret_cast< const std::uint8_t* >( aSource ),
+                                       reinterpret_cast< std::uint8_t* >( aDestination ),
+                                       aCount * sizeof( taT ), sizeof( taT ) )
+               / sizeof( taT );
+    }
+    for ( ; done < aCount; ++done )
+    {
+        aDestination[ done ] = ByteSwap( aSource[ done ] );
+    }
 }
 
 template < Endianness taToEndianness = Endianness::Native,
@@ -44,31 +267,170 @@ struct EndiannessConverter
     {
         return std::forward< taValueType >( aSourceValue );
     }
+
+    /**
+     * @brief Converts aCount values from aSource into aDestination.
+     */
+    template < typename taValueType >
+    static inline void
+    ConvertN( const taValueType* aSource, taValueType* aDestination, size_t aCount ) NOEXCEPT
+    {
+        if ( aSource != aDestination && aCount > 0 )
+        {
+            std::memcpy( aDestination, aSource, aCount * sizeof( taValueType ) );
+        }
+    }
+
+    /**
+     * @brief Converts aCount values in place.
+     */
+    template < typename taValueType >
+    static inline void
+    ConvertInPlace( taValueType* /*aValues*/, size_t /*aCount*/ ) NOEXCEPT
+    {
+    }
 };
 
-template <>
-struct EndiannessConverter< Endianness::Big, Endianness::Little >
+/// @brief The converter between the opposite byte orders.
+struct TSwappingEndiannessConverter
 {
-    // The combinations: Endianness::Little -> Endianness::Big and Endianness::Big ->
-    // Endianness::Little;
-
     template < typename taValueType >
-    static inline taValueType
+    static constexpr inline taValueType
     Convert( taValueType aSourceValue ) NOEXCEPT
     {
         return ByteSwap( aSourceValue );
     }
+
+    /**
+     * @brief Converts aCount values from aSource into aDestination.
+     */
+    template < typename taValueType >
+    static inline void
+    ConvertN( const taValueType* aSource, taValueType* aDestination, size_t aCount ) NOEXCEPT
+    {
+        ByteSwapN( aSource, aDestination, aCount );
+    }
+
+    /**
+     * @brief Converts aCount values in place.
+     */
+    template < typename taValueType >
+    static inline void
+    ConvertInPlace( taValueType* aValues, size_t aCount ) NOEXCEPT
+    {
+        ByteSwapN( aValues, aValues, aCount );
+    }
+};
+
+template <>
+struct EndiannessConverter< Endianness::Big, Endianness::Little >
+    : public TSwappingEndiannessConverter
+{
+    // The combinations: Endianness::Little -> Endianness::Big and Endianness::Big ->
+    // Endianness::Little;
 };
 
 template <>
 struct EndiannessConverter< Endianness::Little, Endianness::Big >
+    : public TSwappingEndiannessConverter
 {
-    template < typename taValueType >
-    static inline taValueType
-    Convert( taValueType aSourceValue ) NOEXCEPT
+};
+
+/**
+ * @brief The integer stored in the given byte order, e.g. the field of the structure read
+ * straight from the device or from the file buffer.
+ *
+ * The value is kept as the wire bytes and converted on every access, so the structure built of
+ * the wire integers needs no separate decode pass. The wire integer has no alignment requirement
+ * and no padding.
+ *
+ * @tparam taValue The integral or enumeration type of the value.
+ * @tparam taEndianness The byte order of the stored value.
+ */
+template < typename taValue, Endianness taEndianness >
+class TWireInteger
+{
+public:
+    static_assert( std::is_integral< taValue >::value || std::is_enum< taValue >::value,
+                   "taValue has to be an integral or enumeration type" );
+
+    using TValue = taValue;
+    static constexpr Endianness kEndianness = taEndianness;
+
+    TWireInteger( ) = default;
+
+    constexpr TWireInteger( taValue aValue ) NOEXCEPT
+        : iBytes{ }
     {
-        return ByteSwap( aSourceValue );
+        Set( aValue );
     }
+
+    constexpr TWireInteger&
+    operator=( taValue aValue ) NOEXCEPT
+    {
+        Set( aValue );
+        return *this;
+    }
+
+    constexpr operator taValue( ) const NOEXCEPT
+    {
+        return Get( );
+    }
+
+    /**
+     * @brief Returns the native value.
+     */
+    constexpr taValue
+    Get( ) const NOEXCEPT
+    {
+        TUnsigned value = 0;
+        for ( size_t index = 0; index < sizeof( taValue ); ++index )
+        {
+            value |= static_cast< TUnsigned >( static_cast< TUnsigned >( iBytes[ index ] )
+                                               << ( 8 * Significance( index ) ) );
+        }
+        return static_cast< taValue >( value );
+    }
+
+    /**
+     * @brief Stores the native value in the wire byte order.
+     */
+    constexpr void
+    Set( taValue aValue ) NOEXCEPT
+    {
+        const auto value = static_cast< TUnsigned >( aValue );
+        for ( size_t index = 0; index < sizeof( taValue ); ++index )
+        {
+            iBytes[ index ] = static_cast< std::uint8_t >( value >> ( 8 * Significance( index ) ) );
+        }
+    }
+
+    /**
+     * @brief Returns the wire bytes.
+     */
+    constexpr const std::uint8_t*
+    Bytes( ) const NOEXCEPT
+    {
+        return iBytes;
+    }
+
+private:
+    using TUnsigned = typename Detail::TUnsignedOfSize< sizeof( taValue ) >::TType;
+
+    /// @brief Returns the significance of the wire byte: 0 for the least significant one.
+    static constexpr size_t
+    Significance( size_t aIndex ) NOEXCEPT
+    {
+        return taEndianness == Endianness::Little ? aIndex : sizeof( taValue ) - 1 - aIndex;
+    }
+
+    std::uint8_t iBytes[ sizeof( taValue ) ];
 };
 
-}  // namespace AbstractPlatform
\ No newline at end of file
+template < typename taValue >
+using TBigEndian = TWireInteger< taValue, Endianness::Big >;
+
+template < typename taValue >
+using TLittleEndian = TWireInteger< taValue, Endianness::Little >;
+
+}  // namespace AbstractPlatform
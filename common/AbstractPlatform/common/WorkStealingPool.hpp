@@ -0,0 +1,584 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Memory.hpp>
+#include <AbstractPlatform/common/RingBuffer.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined( __linux__ )
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace AbstractPlatform
+{
+class CTaskGroup;
+class CWorkStealingPool;
+
+/// @brief The unit of work executed by the CWorkStealingPool.
+class IAbstractTask
+{
+public:
+    virtual ~IAbstractTask( ) = default;
+
+    virtual void Execute( ) NOEXCEPT = 0;
+
+private:
+    friend class CTaskGroup;
+    friend class CWorkStealingPool;
+    CTaskGroup* iGroup = nullptr;
+};
+
+/// @brief The task executing the callable.
+template < typename taFunction >
+class TFunctionTask : public IAbstractTask
+{
+public:
+    explicit TFunctionTask( taFunction aFunction )
+        : iFunction{ std::move( aFunction ) }
+    {
+    }
+
+    void
+    Execute( ) NOEXCEPT override
+    {
+        iFunction( );
+    }
+
+private:
+    taFunction iFunction;
+};
+
+/**
+ * @brief Makes the task executing the callable. The task has to stay alive until it is executed.
+ */
+template < typename taFunction >
+TFunctionTask< typename std::decay< taFunction >::type >
+MakeTask( taFunction&& aFunction )
+{
+    return TFunctionTask< typename std::decay< taFunction >::type >{
+        std::forward< taFunction >( aFunction ) };
+}
+
+/**
+ * @brief The set of the tasks run on the pool and waited for together.
+ *
+ * Wait() does not block the thread while the tasks are pending: it executes the pool tasks
+ * meanwhile, so the nested groups (the fork-join recursion) do not starve the pool.
+ */
+class CTaskGroup
+{
+public:
+    explicit CTaskGroup( CWorkStealingPool& aPool )
+        : iPool{ aPool }
+    {
+    }
+
+    CTaskGroup( const CTaskGroup& ) = delete;
+    CTaskGroup& operator=( const CTaskGroup& ) = delete;
+
+    ~CTaskGroup( )
+    {
+        Wait( );
+    }
+
+    /**
+     * @brief Schedules the task. The task has to stay alive until Wait() returns.
+     */
+    inline void Run( IAbstractTask& aTask ) NOEXCEPT;
+
+    /**
+     * @brief Returns once all the tasks of the group are executed.
+     */
+    inline void Wait( ) NOEXCEPT;
+
+private:
+    friend class CWorkStealingPool;
+
+    CWorkStealingPool& iPool;
+    std::atomic< size_t > iPending{ 0 };
+};
+
+/// @brief The configuration of the CWorkStealingPool.
+struct TWorkStealingPoolConfig
+{
+    /// @brief The count of the worker threads, 0 for one per hardware thread.
+    size_t iWorkerCount = 0;
+
+    /// @brief Whether to pin the worker i to the CPU iFirstCpu + i (Linux only, ignored
+    /// elsewhere).
+    bool iPinWorkers = false;
+    size_t iFirstCpu = 0;
+};
+
+namespace Detail
+{
+/**
+ * @brief The bounded Chase-Lev work-stealing deque (the C11 formulation by N. M. Le et al.).
+ *
+ * The owner thread pushes and pops at the bottom, the other threads steal from the top. Only
+ * the pop of the last element and the steals contend on a compare-and-swap.
+ */
+template < typename taValue, size_t taCapacity >
+class TChaseLevDeque
+{
+public:
+    static_assert( taCapacity > 0 && ( taCapacity & ( taCapacity - 1 ) ) == 0,
+                   "taCapacity has to be a power of 2" );
+
+    /**
+     * @brief Appends the element at the bottom. Owner side.
+     *
+     * @return true If operation succeed, false if the deque is full.
+     */
+    bool
+    Push( taValue* aValue ) NOEXCEPT
+    {
+        const std::int64_t bottom = iBottom.load( std::memory_order_relaxed );
+        const std::int64_t top = iTop.load( std::memory_order_acquire );
+        if ( bottom - top >= static_cast< std::int64_t >( taCapacity ) )
+        {
+            return false;
+        }
+        iElements[ bottom & kMask ].store( aValue, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        iBottom.store( bottom + 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    /**
+     * @brief Takes the element from the bottom (the newest one). Owner side.
+     */
+    taValue*
+    Pop( ) NOEXCEPT
+    {
+        const std::int64_t bottom = iBottom.load( std::memory_order_relaxed ) - 1;
+        iBottom.store( bottom, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        std::int64_t top = iTop.load( std::memory_order_relaxed );
+        if ( top > bottom )
+        {
+            iBottom.store( bottom + 1, std::memory_order_relaxed );
+            return nullptr;
+        }
+
+        taValue* value = iElements[ bottom & kMask ].load( std::memory_order_relaxed );
+        if ( top == bottom )
+        {
+            // The last element: race the thieves for it.
+            if ( !iTop.compare_exchange_strong(
+                     top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+            {
+                value = nullptr;
+            }
+            iBottom.store( bottom + 1, std::memory_order_relaxed );
+        }
+        return value;
+    }
+
+    /**
+     * @brief Takes the element from the top (the oldest one). May be called from any thread.
+     *
+     * @return taValue* The element, or nullptr if the deque is empty or the steal lost the race.
+     */
+    taValue*
+    Steal( ) NOEXCEPT
+    {
+        std::int64_t top = iTop.load( std::memory_order_acquire );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        const std::int64_t bottom = iBottom.load( std::memory_order_acquire );
+        if ( top >= bottom )
+        {
+            return nullptr;
+        }
+        taValue* value = iElements[ top & kMask ].load( std::memory_order_relaxed );
+        if ( !iTop.compare_exchange_strong(
+                 top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+        {
+            return nullptr;
+        }
+        return value;
+    }
+
+    /// @brief Returns the count of the elements. Approximate unless called by the owner.
+    size_t
+    Size( ) const NOEXCEPT
+    {
+        const std::int64_t bottom = iBottom.load( std::memory_order_relaxed );
+        const std::int64_t top = iTop.load( std::memory_order_relaxed );
+        return bottom > top ? static_cast< size_t >( bottom - top ) : 0;
+    }
+
+private:
+    static constexpr std::int64_t kMask = static_cast< std::int64_t >( taCapacity - 1 );
+
+    alignas( KCacheLineSize ) std::atomic< std::int64_t > iTop{ 0 };
+    alignas( KCacheLineSize ) std::atomic< std::int64_t > iBottom{ 0 };
+    alignas( KCacheLineSize ) std::atomic< taValue* > iElements[ taCapacity ] = { };
+};
+}  // namespace Detail
+
+/**
+ * @brief The work-stealing executor.
+ *
+ * Every worker owns a Chase-Lev deque: the tasks spawned by a worker are pushed to its deque and
+ * executed newest first (the cache-warm data), the idle workers steal the oldest ones (the
+ * largest pieces of the fork-join recursion) from the random victims. The tasks submitted from
+ * the other threads go through the shared bounded injection queue. The idle workers spin
+ * briefly and then sleep until the new tasks arrive.
+ *
+ * The pool allocates the workers on the construction only, the scheduling does not allocate.
+ */
+class CWorkStealingPool
+{
+public:
+    static constexpr size_t kDequeCapacity = 256;
+    static constexpr size_t kInjectionCapacity = 1024;
+
+    explicit CWorkStealingPool( const TWorkStealingPoolConfig& aConfig = { } )
+    {
+        size_t workerCount = aConfig.iWorkerCount;
+        if ( workerCount == 0 )
+        {
+            workerCount = std::thread::hardware_concurrency( );
+        }
+        workerCount = workerCount > 0 ? workerCount : 1;
+
+        iWorkers.reserve( workerCount );
+        for ( size_t index = 0; index < workerCount; ++index )
+        {
+            iWorkers.emplace_back( new CWorker( index ) );
+        }
+        for ( size_t index = 0; index < workerCount; ++index )
+        {
+            auto& worker = *iWorkers[ index ];
+            worker.iThread = std::thread( [ this, index ]( ) { WorkerLoop( index ); } );
+            if ( aConfig.iPinWorkers )
+            {
+                Pin( worker.iThread, aConfig.iFirstCpu + index );
+            }
+        }
+    }
+
+    CWorkStealingPool( const CWorkStealingPool& ) = delete;
+    CWorkStealingPool& operator=( const CWorkStealingPool& ) = delete;
+
+    /**
+     * @brief Stops the workers. The pool must have no pending tasks.
+     */
+    ~CWorkStealingPool( )
+    {
+        {
+            std::lock_guard< std::mutex > lock{ iSleepMutex };
+            iStop.store( true, std::memory_order_seq_cst );
+        }
+        iWakeUp.notify_all( );
+        for ( auto& worker : iWorkers )
+        {
+            worker->iThread.join( );
+        }
+    }
+
+    size_t
+    WorkerCount( ) const NOEXCEPT
+    {
+        return iWorkers.size( );
+    }
+
+    /**
+     * @brief Executes aFunction( size_t aBegin, size_t aEnd ) over the subranges covering
+     * [aBegin, aEnd) in parallel and waits for the completion.
+     *
+     * The range is split in halves while the splitting worker has no spare tasks in its deque
+     * (the lazy binary splitting), so the ranges are split only as deep as the stealing demands,
+     * but never below aGrain indices.
+     *
+     * @param aGrain The minimal count of the indices of the subrange, 0 to derive it from the
+     * range length and the worker count.
+     */
+    template < typename taFunction >
+    void
+    ParallelFor( size_t aBegin, size_t aEnd, taFunction&& aFunction, size_t aGrain = 0 ) NOEXCEPT
+    {
+        if ( aEnd <= aBegin )
+        {
+            return;
+        }
+        if ( aGrain == 0 )
+        {
+            aGrain = ( aEnd - aBegin ) / ( kChunksPerWorker * WorkerCount( ) );
+            aGrain = aGrain > 0 ? aGrain : 1;
+        }
+        ParallelForRange( aBegin, aEnd, aFunction, aGrain );
+    }
+
+private:
+    friend class CTaskGroup;
+
+    static constexpr size_t kChunksPerWorker = 8;
+    static constexpr size_t kMaxSplitsPerRange = 16;
+    static constexpr int kSpinsBeforeSleep = 64;
+    static constexpr size_t kNoWorker = ~size_t{ 0 };
+
+    struct CWorker
+    {
+        explicit CWorker( size_t aIndex )
+            : iRandom{ static_cast< std::uint32_t >( aIndex * 2654435761u + 1 ) }
+        {
+        }
+
+        Detail::TChaseLevDeque< IAbstractTask, kDequeCapacity > iDeque;
+        std::thread iThread;
+        std::uint32_t iRandom;
+    };
+
+    struct TCurrentWorker
+    {
+        const CWorkStealingPool* iPool = nullptr;
+        size_t iIndex = kNoWorker;
+    };
+
+    static TCurrentWorker&
+    CurrentWorker( ) NOEXCEPT
+    {
+        static thread_local TCurrentWorker currentWorker;
+        return currentWorker;
+    }
+
+    /// @brief Returns the index of the calling worker of this pool, kNoWorker for the others.
+    size_t
+    CurrentWorkerIndex( ) const NOEXCEPT
+    {
+        const auto& current = CurrentWorker( );
+        return current.iPool == this ? current.iIndex : kNoWorker;
+    }
+
+    static void
+    Pin( std::thread& aThread, size_t aCpu ) NOEXCEPT
+    {
+#if defined( __linux__ )
+        cpu_set_t cpus;
+        CPU_ZERO( &cpus );
+        CPU_SET( aCpu % CPU_SETSIZE, &cpus );
+        pthread_setaffinity_np( aThread.native_handle( ), sizeof( cpus ), &cpus );
+#else
+        ( void )aThread;
+        ( void )aCpu;
+#endif
+    }
+
+    void
+    Spawn( IAbstractTask& aTask ) NOEXCEPT
+    {
+        const size_t worker = CurrentWorkerIndex( );
+        iQueued.fetch_add( 1, std::memory_order_seq_cst );
+        const bool queued = worker != kNoWorker ? iWorkers[ worker ]->iDeque.Push( &aTask )
+                                                : iInjection.Push( &aTask );
+        if ( !queued )
+        {
+            iQueued.fetch_sub( 1, std::memory_order_relaxed );
+            Execute( aTask );
+            return;
+        }
+        if ( iSleeping.load( std::memory_order_seq_cst ) > 0 )
+        {
+            {
+                std::lock_guard< std::mutex > lock{ iSleepMutex };
+            }
+            iWakeUp.notify_one( );
+        }
+    }
+
+    void
+    Execute( IAbstractTask& aTask ) NOEXCEPT
+    {
+        CTaskGroup* group = aTask.iGroup;
+        aTask.Execute( );
+        group->iPending.fetch_sub( 1, std::memory_order_release );
+    }
+
+    /**
+     * @brief Takes the task: the own deque first, then the injection queue, then the victims.
+     */
+    IAbstractTask*
+    Take( size_t aWorker ) NOEXCEPT
+    {
+        IAbstractTask* task = nullptr;
+        if ( aWorker != kNoWorker )
+        {
+            task = iWorkers[ aWorker ]->iDeque.Pop( );
+        }
+        if ( task == nullptr )
+        {
+            iInjection.Pop( task );
+        }
+        if ( task == nullptr )
+        {
+            const size_t count = iWorkers.size( );
+            const size_t start = aWorker != kNoWorker ? NextRandom( *iWorkers[ aWorker ] ) : 0;
+            for ( size_t offset = 0; offset < count && task == nullptr; ++offset )
+            {
+                const size_t victim = ( start + offset ) % count;
+                if ( victim != aWorker )
+                {
+                    task = iWorkers[ victim ]->iDeque.Steal( );
+                }
+            }
+        }
+        if ( task != nullptr )
+        {
+            iQueued.fetch_sub( 1, std::memory_order_relaxed );
+        }
+        return task;
+    }
+
+    /**
+     * @brief Executes one pending task on the calling thread.
+     *
+     * @return true If a task was executed.
+     */
+    bool
+    RunOne( ) NOEXCEPT
+    {
+        IAbstractTask* task = Take( CurrentWorkerIndex( ) );
+        if ( task == nullptr )
+        {
+            return false;
+        }
+        Execute( *task );
+        return true;
+    }
+
+    static size_t
+    NextRandom( CWorker& aWorker ) NOEXCEPT
+    {
+        // xorshift32
+        std::uint32_t value = aWorker.iRandom;
+        value ^= value << 13;
+        value ^= value >> 17;
+        value ^= value << 5;
+        aWorker.iRandom = value;
+        return value;
+    }
+
+    void
+    WorkerLoop( size_t aIndex ) NOEXCEPT
+    {
+        CurrentWorker( ) = TCurrentWorker{ this, aIndex };
+        int idleSpins = 0;
+        while ( !iStop.load( std::memory_order_acquire ) )
+        {
+            if ( RunOne( ) )
+            {
+                idleSpins = 0;
+                continue;
+            }
+            if ( ++idleSpins < kSpinsBeforeSleep )
+            {
+                std::this_thread::yield( );
+                continue;
+            }
+
+            // Spawn() increments iQueued before checking iSleeping, so either the worker sees
+            // the task or the spawner sees the sleeper and notifies under the lock.
+            std::unique_lock< std::mutex > lock{ iSleepMutex };
+            iSleeping.fetch_add( 1, std::memory_order_seq_cst );
+            iWakeUp.wait( lock, [ this ]( ) {
+                return iQueued.load( std::memory_order_seq_cst ) > 0
+                       || iStop.load( std::memory_order_relaxed );
+            } );
+            iSleeping.fetch_sub( 1, std::memory_order_relaxed );
+            idleSpins = 0;
+        }
+        CurrentWorker( ) = TCurrentWorker{ };
+    }
+
+    template < typename taFunction >
+    void
+    ParallelForRange( size_t aBegin, size_t aEnd, taFunction& aFunction, size_t aGrain ) NOEXCEPT
+    {
+        class CRangeTask : public IAbstractTask
+        {
+        public:
+            void
+            Execute( ) NOEXCEPT override
+            {
+                iPool->ParallelForRange( iBegin, iEnd, *iFunction, iGrain );
+            }
+
+            CWorkStealingPool* iPool = nullptr;
+            taFunction* iFunction = nullptr;
+            size_t iBegin = 0;
+            size_t iEnd = 0;
+            size_t iGrain = 0;
+        };
+
+        CRangeTask tasks[ kMaxSplitsPerRange ];
+        size_t splits = 0;
+        CTaskGroup group{ *this };
+        const size_t worker = CurrentWorkerIndex( );
+        while ( aEnd - aBegin > aGrain )
+        {
+            const bool hasSpareTasks
+                = worker != kNoWorker && iWorkers[ worker ]->iDeque.Size( ) > 0;
+            if ( hasSpareTasks || splits == kMaxSplitsPerRange )
+            {
+                aFunction( aBegin, aBegin + aGrain );
+                aBegin += aGrain;
+                continue;
+            }
+            const size_t middle = aBegin + ( aEnd - aBegin ) / 2;
+            auto& task = tasks[ splits++ ];
+            task.iPool = this;
+            task.iFunction = &aFunction;
+            task.iBegin = middle;
+            task.iEnd = aEnd;
+            task.iGrain = aGrain;
+            group.Run( task );
+            aEnd = middle;
+        }
+        aFunction( aBegin, aEnd );
+        group.Wait( );
+    }
+
+    std::vector< std::unique_ptr< CWorker > > iWorkers;
+    TMpmcRing< IAbstractTask*, kInjectionCapacity > iInjection;
+
+    alignas( KCacheLineSize ) std::atomic< size_t > iQueued{ 0 };
+    std::atomic< size_t > iSleeping{ 0 };
+    std::atomic< bool > iStop{ false };
+    std::mutex iSleepMutex;
+    std::condition_variable iWakeUp;
+};
+
+inline void
+CTaskGroup::Run( IAbstractTask& aTask ) NOEXCEPT
+{
+    aTask.iGroup = this;
+    iPending.fetch_add( 1, std::memory_order_relaxed );
+    iPool.Spawn( aTask );
+}
+
+inline void
+CTaskGroup::Wait( ) NOEXCEPT
+{
+    while ( iPending.load( std::memory_order_acquire ) != 0 )
+    {
+        if ( !iPool.RunOne( ) )
+        {
+            std::this_thread::yield( );
+        }
+    }
+}
+
+}  // namespace AbstractPlatform
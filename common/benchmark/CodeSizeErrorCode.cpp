@@ -0,0 +1,59 @@
+// The error propagation with the raw error codes, the code size baseline of CodeSizeResult.cpp.
+// Both translation units implement the same driver; compare their sections with the
+// abstract-platform.common_code_size target.
+
+#include <AbstractPlatform/common/ErrorCode.hpp>
+
+#include <cstdint>
+
+using namespace AbstractPlatform;
+namespace
+{
+volatile std::uint8_t gRegisters[ 4 ];
+}  // namespace
+
+__attribute__( ( noinline ) ) TErrorCode
+CodeSizeWriteRegisterCode( std::uint8_t aRegister, std::uint8_t aValue ) NOEXCEPT
+{
+    if ( aRegister >= sizeof( gRegisters ) )
+    {
+        return KInvalidArgumentError;
+    }
+    gRegisters[ aRegister ] = aValue;
+    return KOk;
+}
+
+__attribute__( ( noinline ) ) TErrorCode
+CodeSizeReadRegisterCode( std::uint8_t aRegister, std::uint8_t& aValue ) NOEXCEPT
+{
+    if ( aRegister >= sizeof( gRegisters ) )
+    {
+        return KInvalidArgumentError;
+    }
+    aValue = gRegisters[ aRegister ];
+    return aValue == 0xFF ? KGenericError : KOk;
+}
+
+TErrorCode
+CodeSizeReadTemperatureCode( std::int16_t& aTemperature ) NOEXCEPT
+{
+    TErrorCode result = CodeSizeWriteRegisterCode( 0, 1 );
+    if ( result != KOk )
+    {
+        return result;
+    }
+    std::uint8_t high = 0;
+    result = CodeSizeReadRegisterCode( 1, high );
+    if ( result != KOk )
+    {
+        return result;
+    }
+    std::uint8_t low = 0;
+    result = CodeSizeReadRegisterCode( 2, low );
+    if ( result != KOk )
+    {
+        return result;
+    }
+    aTemperature = static_cast< std::int16_t >( ( high << 8 ) | low );
+    return KOk;
+}
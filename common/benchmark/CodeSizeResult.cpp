@@ -0,0 +1,49 @@
+// The error propagation with TResult, the counterpart of CodeSizeErrorCode.cpp.
+
+#include <AbstractPlatform/common/ErrorCode.hpp>
+#include <AbstractPlatform/common/Result.hpp>
+
+#include <cstdint>
+
+using namespace AbstractPlatform;
+namespace
+{
+volatile std::uint8_t gRegisters[ 4 ];
+}  // namespace
+
+__attribute__( ( noinline ) ) TResult< void >
+CodeSizeWriteRegisterResult( std::uint8_t aRegister, std::uint8_t aValue ) NOEXCEPT
+{
+    if ( aRegister >= sizeof( gRegisters ) )
+    {
+        return Failure( KInvalidArgumentError );
+    }
+    gRegisters[ aRegister ] = aValue;
+    return { };
+}
+
+__attribute__( ( noinline ) ) TResult< std::uint8_t >
+CodeSizeReadRegisterResult( std::uint8_t aRegister ) NOEXCEPT
+{
+    if ( aRegister >= sizeof( gRegisters ) )
+    {
+        return Failure( KInvalidArgumentError );
+    }
+    const std::uint8_t value = gRegisters[ aRegister ];
+    if ( value == 0xFF )
+    {
+        return Failure( KGenericError );
+    }
+    return value;
+}
+
+TResult< std::int16_t >
+CodeSizeReadTemperatureResult( ) NOEXCEPT
+{
+    RETURN_IF_FAILED( CodeSizeWriteRegisterResult( 0, 1 ) );
+    const auto high = CodeSizeReadRegisterResult( 1 );
+    RETURN_IF_FAILED( high );
+    const auto low = CodeSizeReadRegisterResult( 2 );
+    RETURN_IF_FAILED( low );
+    return static_cast< std::int16_t >( ( high.Value( ) << 8 ) | low.Value( ) );
+}
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <AbstractPlatform/common/InplaceFunction.hpp>
+
+#include <cstdint>
+#include <functional>
+
+using namespace AbstractPlatform;
+namespace
+{
+// A completion handler capturing the transfer context: larger than the small buffer of
+// std::function in libstdc++ (two pointers), so std::function allocates.
+struct TTransferContext
+{
+    std::uint8_t* iBuffer;
+    size_t iLength;
+    std::uint8_t iDeviceAddress;
+    int* iResult;
+};
+
+template < typename taFunction >
+void
+Construct( benchmark::State& aState )
+{
+    int result = 0;
+    std::uint8_t buffer[ 4 ] = { };
+    const TTransferContext context{ buffer, sizeof( buffer ), 0x18, &result };
+    for ( auto _ : aState )
+    {
+        taFunction handler{ [ context ]( int aStatus ) { *context.iResult = aStatus; } };
+        benchmark::DoNotOptimize( handler );
+    }
+}
+
+template < typename taFunction >
+void
+Call( benchmark::State& aState )
+{
+    int result = 0;
+    std::uint8_t buffer[ 4 ] = { };
+    const TTransferContext context{ buffer, sizeof( buffer ), 0x18, &result };
+    taFunction handler{ [ context ]( int aStatus ) {
+        return aStatus + context.iDeviceAddress + static_cast< int >( context.iLength );
+    } };
+    benchmark::DoNotOptimize( handler );
+    for ( auto _ : aState )
+    {
+        benchmark::DoNotOptimize( handler( 1 ) );
+    }
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE( Construct, std::function< void( int ) > );
+BENCHMARK_TEMPLATE( Construct, TInplaceFunction< void( int ) > );
+BENCHMARK_TEMPLATE( Call, std::function< int( int ) > );
+BENCHMARK_TEMPLATE( Call, TInplaceFunction< int( int ) > );
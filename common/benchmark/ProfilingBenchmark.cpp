@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <AbstractPlatform/common/Profiling.hpp>
+
+#include <cstdint>
+
+using namespace AbstractPlatform;
+namespace
+{
+// The profiled work, small enough for the scope overhead to dominate.
+__attribute__( ( noinline ) ) std::uint32_t
+Work( std::uint32_t aValue ) NOEXCEPT
+{
+    return aValue * 2654435761u;
+}
+
+void
+Unprofiled( benchmark::State& aState )
+{
+    std::uint32_t value = 0;
+    for ( auto _ : aState )
+    {
+        value = Work( value + 1 );
+        benchmark::DoNotOptimize( value );
+    }
+}
+
+// The clock read, twice per scope. Virtual machines trapping RDTSC make it the dominant cost.
+void
+ProfileClock( benchmark::State& aState )
+{
+    for ( auto _ : aState )
+    {
+        benchmark::DoNotOptimize( Detail::ProfileTicks( ) );
+    }
+}
+
+// The expansion of PROFILE_SCOPE, which compiles to nothing without PROFILING. The time per
+// iteration minus Unprofiled is the cost of the scope, budgeted at 20 ns.
+void
+ProfiledScope( benchmark::State& aState )
+{
+    // Constructed before the loop, which keeps the clock calibration out of the measurement.
+    static CProfileSite site{ "benchmark.scope", TProfileSiteKind::Timer };
+    std::uint32_t value = 0;
+    for ( auto _ : aState )
+    {
+        const CProfileScope scope{ site };
+        value = Work( value + 1 );
+        benchmark::DoNotOptimize( value );
+    }
+    aState.counters[ "ScopesPerSecond" ]
+        = benchmark::Counter( static_cast< double >( aState.iterations( ) ),
+                              benchmark::Counter::kIsRate );
+}
+}  // namespace
+
+BENCHMARK( Unprofiled );
+BENCHMARK( ProfileClock );
+BENCHMARK( ProfiledScope );
+BENCHMARK( ProfiledScope )->Threads( 4 );
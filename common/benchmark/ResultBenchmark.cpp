@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <AbstractPlatform/common/ErrorCode.hpp>
+#include <AbstractPlatform/common/Result.hpp>
+
+#include <cstdint>
+
+using namespace AbstractPlatform;
+namespace
+{
+// The sensor NACKs three of four reads, the pattern of the retry loops polling a busy device.
+constexpr unsigned kNackMask = 3;
+unsigned gAttempt = 0;
+
+__attribute__( ( noinline ) ) TErrorCode
+ReadSensorCode( std::uint16_t& aValue ) NOEXCEPT
+{
+    if ( ( ++gAttempt & kNackMask ) != 0 )
+    {
+        return KGenericError;
+    }
+    aValue = static_cast< std::uint16_t >( gAttempt );
+    return KOk;
+}
+
+__attribute__( ( noinline ) ) TResult< std::uint16_t, TErrorCode >
+ReadSensorResult( ) NOEXCEPT
+{
+    if ( ( ++gAttempt & kNackMask ) != 0 )
+    {
+        return Failure( KGenericError );
+    }
+    return static_cast< std::uint16_t >( gAttempt );
+}
+
+__attribute__( ( noinline ) ) TResult< std::uint16_t, TCategorizedError >
+ReadSensorCategorizedResult( ) NOEXCEPT
+{
+    if ( ( ++gAttempt & kNackMask ) != 0 )
+    {
+        return Failure( KGenericError );
+    }
+    return static_cast< std::uint16_t >( gAttempt );
+}
+
+void
+RetryErrorCode( benchmark::State& aState )
+{
+    for ( auto _ : aState )
+    {
+        std::uint16_t value = 0;
+        while ( ReadSensorCode( value ) != KOk )
+        {
+        }
+        benchmark::DoNotOptimize( value );
+    }
+}
+
+template < typename taRead >
+void
+RetryResult( benchmark::State& aState, taRead aRead )
+{
+    for ( auto _ : aState )
+    {
+        auto result = aRead( );
+        while ( !result )
+        {
+            result = aRead( );
+        }
+        benchmark::DoNotOptimize( result.Value( ) );
+    }
+}
+
+#ifdef __EXCEPTIONS
+__attribute__( ( noinline ) ) std::uint16_t
+ReadSensorOrThrow( )
+{
+    std::uint16_t value = 0;
+    ThrowOnError( ReadSensorCode( value ) );
+    return value;
+}
+
+void
+RetryException( benchmark::State& aState )
+{
+    for ( auto _ : aState )
+    {
+        for ( ;; )
+        {
+            try
+            {
+                benchmark::DoNotOptimize( ReadSensorOrThrow( ) );
+                break;
+            }
+            catch ( const EGenericError& )
+            {
+            }
+        }
+    }
+}
+BENCHMARK( RetryException );
+#endif
+}  // namespace
+
+BENCHMARK( RetryErrorCode );
+BENCHMARK_CAPTURE( RetryResult, Plain, &ReadSensorResult );
+BENCHMARK_CAPTURE( RetryResult, Categorized, &ReadSensorCategorizedResult );
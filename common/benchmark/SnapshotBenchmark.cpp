@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <AbstractPlatform/common/Snapshot.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+// The decoded readings of an IMU, published by the sensor thread.
+struct TImuReading
+{
+    std::int32_t iAcceleration[ 3 ];
+    std::int32_t iAngularRate[ 3 ];
+    std::int32_t iTemperature;
+    std::uint32_t iTimestamp;
+};
+
+// The mutex-guarded latest value the snapshot replaces.
+class TLockedValue
+{
+public:
+    void
+    Write( const TImuReading& aValue )
+    {
+        std::lock_guard< std::mutex > lock{ iMutex };
+        iValue = aValue;
+    }
+
+    TImuReading
+    Read( ) const
+    {
+        std::lock_guard< std::mutex > lock{ iMutex };
+        return iValue;
+    }
+
+private:
+    mutable std::mutex iMutex;
+    TImuReading iValue{ };
+};
+
+// Measures the writer while aState.range( 0 ) readers poll the value continuously.
+template < typename taChannel >
+void
+WriteUnderReaders( benchmark::State& aState )
+{
+    taChannel channel;
+    std::atomic< bool > done{ false };
+    std::vector< std::thread > readers;
+    for ( std::int64_t reader = 0; reader < aState.range( 0 ); ++reader )
+    {
+        readers.emplace_back( [ & ]( ) {
+            while ( !done.load( std::memory_order_relaxed ) )
+            {
+                benchmark::DoNotOptimize( channel.Read( ) );
+            }
+        } );
+    }
+
+    TImuReading reading{ };
+    for ( auto _ : aState )
+    {
+        ++reading.iTimestamp;
+        channel.Write( reading );
+    }
+
+    done.store( true, std::memory_order_relaxed );
+    for ( auto& reader : readers )
+    {
+        reader.join( );
+    }
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE( WriteUnderReaders, TLockedValue )->Arg( 0 )->Arg( 3 )->UseRealTime( );
+BENCHMARK_TEMPLATE( WriteUnderReaders, TSnapshot< TImuReading > )
+    ->Arg( 0 )
+    ->Arg( 3 )
+    ->UseRealTime( );
+BENCHMARK_TEMPLATE( WriteUnderReaders, TDoubleBufferedSnapshot< TImuReading > )
+    ->Arg( 0 )
+    ->Arg( 3 )
+    ->UseRealTime( );
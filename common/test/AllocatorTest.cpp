@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/Allocator.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+bool
+IsAligned( const void* aPointer, size_t aAlignment )
+{
+    return reinterpret_cast< std::uintptr_t >( aPointer ) % aAlignment == 0;
+}
+}  // namespace
+
+TEST( ArenaTest, AllocatesAlignedUntilExhausted )
+{
+    TStaticArena< 64 > arena;
+
+    void* first = arena.Allocate( 3, 1 );
+    ASSERT_NE( first, nullptr );
+    auto* second = arena.Allocate< std::uint32_t >( 2 );
+    ASSERT_NE( second, nullptr );
+    EXPECT_TRUE( IsAligned( second, alignof( std::uint32_t ) ) );
+    EXPECT_EQ( arena.Used( ), 12u );
+
+    void* aligned = arena.Allocate( 8, 16 );
+    ASSERT_NE( aligned, nullptr );
+    EXPECT_TRUE( IsAligned( aligned, 16 ) );
+
+    EXPECT_EQ( arena.Allocate( 64, 1 ), nullptr );
+    EXPECT_EQ( arena.Allocate< std::uint64_t >( 100 ), nullptr );
+    EXPECT_NE( arena.Allocate( arena.Capacity( ) - arena.Used( ), 1 ), nullptr );
+    EXPECT_EQ( arena.Allocate( 1, 1 ), nullptr );
+
+    arena.Reset( );
+    EXPECT_EQ( arena.Used( ), 0u );
+    EXPECT_NE( arena.Allocate( 64, 1 ), nullptr );
+}
+
+TEST( ArenaTest, ScopeRewindsToMarker )
+{
+    std::uint8_t buffer[ 128 ];
+    CArena arena{ buffer, sizeof( buffer ) };
+    arena.Allocate( 16, 1 );
+    const auto marker = arena.Mark( );
+    {
+        CArenaScope scope{ arena };
+        EXPECT_NE( arena.Allocate( 32, 1 ), nullptr );
+        EXPECT_EQ( arena.Used( ), 48u );
+    }
+    EXPECT_EQ( arena.Used( ), marker );
+
+    void* memory = arena.Allocate( 8, 1 );
+    EXPECT_EQ( memory, buffer + 16 );
+    EXPECT_TRUE( arena.Owns( memory ) );
+    EXPECT_FALSE( arena.Owns( buffer + sizeof( buffer ) ) );
+
+    arena.Rewind( marker );
+    EXPECT_EQ( arena.Used( ), 16u );
+}
+
+TEST( BlockPoolTest, AllocatesAllBlocksAndReusesFreed )
+{
+    TBlockPool< 24, 4, 8 > pool;
+    EXPECT_EQ( pool.kBlockSize, 24u );
+    EXPECT_EQ( pool.Available( ), 4u );
+
+    void* blocks[ 4 ];
+    for ( auto& block : blocks )
+    {
+        block = pool.Allocate( );
+        ASSERT_NE( block, nullptr );
+        EXPECT_TRUE( IsAligned( block, 8 ) );
+        EXPECT_TRUE( pool.Owns( block ) );
+    }
+    EXPECT_EQ( pool.Allocate( ), nullptr );
+    EXPECT_EQ( pool.Available( ), 0u );
+
+    pool.Deallocate( blocks[ 2 ] );
+    EXPECT_EQ( pool.Available( ), 1u );
+    EXPECT_EQ( pool.Allocate( ), blocks[ 2 ] );
+    EXPECT_FALSE( pool.Owns( static_cast< std::uint8_t* >( blocks[ 0 ] ) + 1 ) );
+}
+
+TEST( BlockPoolTest, ConcurrentAllocateDeallocate )
+{
+    constexpr int kThreads = 4;
+    constexpr int kIterations = 20000;
+    static TBlockPool< sizeof( int ), 8 > pool;
+    std::atomic< bool > corrupted{ false };
+
+    std::vector< std::thread > threads;
+    for ( int thread = 0; thread < kThreads; ++thread )
+    {
+        threads.emplace_back( [ thread, &corrupted ]( ) {
+            for ( int iteration = 0; iteration < kIterations; ++iteration )
+            {
+                auto* value = static_cast< int* >( pool.Allocate( ) );
+                if ( value == nullptr )
+                {
+                    continue;
+                }
+                // The block is exclusively owned until it is returned.
+                *value = thread;
+                std::this_thread::yield( );
+                if ( *value != thread )
+                {
+                    corrupted = true;
+                }
+                pool.Deallocate( value );
+            }
+        } );
+    }
+    for ( auto& thread : threads )
+    {
+        thread.join( );
+    }
+
+    EXPECT_FALSE( corrupted );
+    EXPECT_EQ( pool.Available( ), 8u );
+}
+
+#if defined( ABSTRACT_PLATFORM_HAS_PMR )
+TEST( AllocatorResourceTest, PmrVectorFromArena )
+{
+    TStaticArena< 256 > arena;
+    CArenaResource resource{ arena };
+
+    std::pmr::vector< std::uint16_t > values{ &resource };
+    values.reserve( 16 );
+    for ( std::uint16_t index = 0; index < 16; ++index )
+    {
+        values.push_back( index );
+    }
+    EXPECT_TRUE( arena.Owns( values.data( ) ) );
+    EXPECT_THROW( values.reserve( 1024 ), std::bad_alloc );
+}
+
+TEST( AllocatorResourceTest, PoolResourceFallsBackToUpstream )
+{
+    TBlockPool< 32, 2 > pool;
+    TPoolResource< decltype( pool ) > resource{ pool, std::pmr::new_delete_resource( ) };
+
+    void* small = resource.allocate( 16 );
+    EXPECT_TRUE( pool.Owns( small ) );
+    void* large = resource.allocate( 64 );
+    EXPECT_FALSE( pool.Owns( large ) );
+
+    resource.deallocate( small, 16 );
+    resource.deallocate( large, 64 );
+    EXPECT_EQ( pool.Available( ), 2u );
+}
+#endif
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/BinarySchema.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace AbstractPlatform;
+namespace
+{
+enum class TSensorKind : std::uint8_t
+{
+    Temperature = 1,
+    Humidity = 2
+};
+
+using TTelemetryFrame = TRecordSchema< TSchemaField< std::uint16_t, Endianness::Big >,
+                                       TSchemaField< TSensorKind >,
+                                       TSchemaPadding< 1 >,
+                                       TSchemaField< std::int32_t, Endianness::Little >,
+                                       TSchemaField< float, Endianness::Big >,
+                                       TSchemaBytes< 3 > >;
+enum
+{
+    kSequence = 0,
+    kKind = 1,
+    kValue = 3,
+    kScale = 4,
+    kTag = 5
+};
+
+static_assert( TTelemetryFrame::kSize == 15, "Unexpected record size" );
+static_assert( TTelemetryFrame::kOffset< kValue > == 4, "Unexpected field offset" );
+static_assert( TTelemetryFrame::kOffset< kTag > == 12, "Unexpected field offset" );
+
+}  // namespace
+
+TEST( BinarySchemaTest, ViewReadsFieldsInPlace )
+{
+    const float scale = 0.5f;
+    std::uint32_t scaleBits;
+    std::memcpy( &scaleBits, &scale, sizeof( scaleBits ) );
+
+    const std::uint8_t frame[] = { 0x12,
+                                   0x34,
+                                   0x02,
+                                   0xAA,
+                                   0xFE,
+                                   0xFF,
+                                   0xFF,
+                                   0xFF,
+                                   static_cast< std::uint8_t >( scaleBits >> 24 ),
+                                   static_cast< std::uint8_t >( scaleBits >> 16 ),
+                                   static_cast< std::uint8_t >( scaleBits >> 8 ),
+                                   static_cast< std::uint8_t >( scaleBits ),
+                                   'a',
+                                   'b',
+                                   'c' };
+
+    TTelemetryFrame::CView view;
+    ASSERT_TRUE( TTelemetryFrame::View( frame, sizeof( frame ), view ) );
+    EXPECT_EQ( view.Data( ), frame );
+    EXPECT_EQ( view.Get< kSequence >( ), 0x1234 );
+    EXPECT_EQ( view.Get< kKind >( ), TSensorKind::Humidity );
+    EXPECT_EQ( view.Get< kValue >( ), -2 );
+    EXPECT_FLOAT_EQ( view.Get< kScale >( ), 0.5f );
+    EXPECT_EQ( view.Get< kTag >( ), frame + 12 );
+}
+
+TEST( BinarySchemaTest, ShortBufferIsRejected )
+{
+    std::uint8_t frame[ TTelemetryFrame::kSize - 1 ] = { };
+
+    TTelemetryFrame::CView view;
+    EXPECT_FALSE( TTelemetryFrame::View( frame, sizeof( frame ), view ) );
+    EXPECT_FALSE( TTelemetryFrame::View( nullptr, TTelemetryFrame::kSize, view ) );
+
+    TTelemetryFrame::CWriter writer;
+    EXPECT_FALSE( TTelemetryFrame::Writer( frame, sizeof( frame ), writer ) );
+}
+
+TEST( BinarySchemaTest, WriterRoundTrip )
+{
+    std::uint8_t frame[ TTelemetryFrame::kSize ];
+    std::memset( frame, 0xCC, sizeof( frame ) );
+    const std::uint8_t tag[] = { 'x', 'y', 'z' };
+
+    TTelemetryFrame::CWriter writer;
+    ASSERT_TRUE( TTelemetryFrame::Writer( frame, sizeof( frame ), writer ) );
+    writer.Set< kSequence >( 0xBEEF )
+        .Set< kKind >( TSensorKind::Temperature )
+        .Set< kValue >( 100000 )
+        .Set< kScale >( -1.25f )
+        .Set< kTag >( tag );
+
+    EXPECT_EQ( frame[ 0 ], 0xBE );
+    EXPECT_EQ( frame[ 1 ], 0xEF );
+    EXPECT_EQ( frame[ 3 ], 0x00 );
+    EXPECT_EQ( frame[ 4 ], 0xA0 );
+    EXPECT_EQ( frame[ 5 ], 0x86 );
+    EXPECT_EQ( frame[ 6 ], 0x01 );
+    EXPECT_EQ( frame[ 7 ], 0x00 );
+
+    TTelemetryFrame::CView view;
+    ASSERT_TRUE( TTelemetryFrame::View( frame, sizeof( frame ), view ) );
+    EXPECT_EQ( view.Get< kSequence >( ), 0xBEEF );
+    EXPECT_EQ( view.Get< kKind >( ), TSensorKind::Temperature );
+    EXPECT_EQ( view.Get< kValue >( ), 100000 );
+    EXPECT_FLOAT_EQ( view.Get< kScale >( ), -1.25f );
+    EXPECT_EQ( std::memcmp( view.Get< kTag >( ), tag, sizeof( tag ) ), 0 );
+}
+
+TEST( BinarySchemaTest, ViewAtIteratesRecordArray )
+{
+    using TSample = TRecordSchema< TSchemaField< std::uint8_t >,
+                                   TSchemaField< std::uint16_t, Endianness::Big > >;
+    const std::uint8_t samples[] = { 1, 0x00, 0x10, 2, 0x00, 0x20, 3, 0x00 };
+
+    EXPECT_EQ( TSample::Count( sizeof( samples ) ), 2u );
+
+    TSample::CView view;
+    ASSERT_TRUE( TSample::ViewAt( samples, sizeof( samples ), 1, view ) );
+    EXPECT_EQ( view.Get< 0 >( ), 2 );
+    EXPECT_EQ( view.Get< 1 >( ), 0x20 );
+    EXPECT_FALSE( TSample::ViewAt( samples, sizeof( samples ), 2, view ) );
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/BitArray.hpp>
+
+#include <bitset>
+#include <cstdint>
+#include <random>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr size_t kBits = 3 * KBitWordBits + 13;
+
+template < typename taArray >
+std::bitset< kBits >
+ToBitset( const taArray& aArray )
+{
+    std::bitset< kBits > bits;
+    for ( size_t index = 0; index < aArray.Size( ); ++index )
+    {
+        bits[ index ] = aArray.Test( index );
+    }
+    return bits;
+}
+
+std::bitset< kBits >
+RandomBits( TBitArray< kBits >& aArray, std::mt19937& aGenerator )
+{
+    std::bitset< kBits > bits;
+    aArray.ClearAll( );
+    for ( size_t index = 0; index < kBits; ++index )
+    {
+        if ( aGenerator( ) & 1u )
+        {
+            aArray.Set( index );
+            bits.set( index );
+        }
+    }
+    return bits;
+}
+}  // namespace
+
+TEST( BitArrayTest, SingleBits )
+{
+    TBitArray< kBits > bits;
+    EXPECT_TRUE( bits.None( ) );
+    bits.Set( 0 ).Set( KBitWordBits ).Set( kBits - 1 );
+    EXPECT_TRUE( bits.Test( KBitWordBits ) );
+    EXPECT_EQ( bits.Count( ), 3u );
+
+    bits.Toggle( 0 ).Clear( KBitWordBits );
+    EXPECT_EQ( bits.FindFirstSet( ), kBits - 1 );
+    EXPECT_EQ( bits.Count( ), 1u );
+}
+
+TEST( BitArrayTest, Ranges )
+{
+    TBitArray< kBits > bits;
+    bits.SetRange( 5, 2 * KBitWordBits );
+    std::bitset< kBits > expected;
+    for ( size_t index = 5; index < 5 + 2 * KBitWordBits; ++index )
+    {
+        expected.set( index );
+    }
+    EXPECT_EQ( ToBitset( bits ), expected );
+
+    bits.ClearRange( 7, 3 );
+    expected.reset( 7 ).reset( 8 ).reset( 9 );
+    EXPECT_EQ( ToBitset( bits ), expected );
+    EXPECT_EQ( bits.Count( ), expected.count( ) );
+
+    bits.SetAll( );
+    EXPECT_EQ( bits.Count( ), kBits );
+    bits.ClearRange( 0, kBits );
+    EXPECT_TRUE( bits.None( ) );
+}
+
+TEST( BitArrayTest, FindSetBits )
+{
+    TBitArray< kBits > bits;
+    EXPECT_EQ( bits.FindFirstSet( ), kBits );
+    const size_t kIndices[]
+        = { 3, KBitWordBits - 1, KBitWordBits, 2 * KBitWordBits + 40, kBits - 1 };
+    for ( const auto index : kIndices )
+    {
+        bits.Set( index );
+    }
+
+    size_t found = 0;
+    for ( size_t index = bits.FindFirstSet( ); index < bits.Size( );
+          index = bits.FindNextSet( index + 1 ) )
+    {
+        ASSERT_LT( found, 5u );
+        EXPECT_EQ( index, kIndices[ found++ ] );
+    }
+    EXPECT_EQ( found, 5u );
+}
+
+TEST( BitArrayTest, MatchesBitsetOnRandomData )
+{
+    std::mt19937 generator{ 42 };
+    for ( int iteration = 0; iteration < 50; ++iteration )
+    {
+        TBitArray< kBits > left;
+        TBitArray< kBits > right;
+        const auto leftBits = RandomBits( left, generator );
+        const auto rightBits = RandomBits( right, generator );
+        const size_t shift = generator( ) % ( kBits + 2 );
+
+        TBitArray< kBits > result = left;
+        EXPECT_EQ( ToBitset( result.And( right ) ), leftBits & rightBits );
+        result = left;
+        EXPECT_EQ( ToBitset( result.Or( right ) ), leftBits | rightBits );
+        result = left;
+        EXPECT_EQ( ToBitset( result.Xor( right ) ), leftBits ^ rightBits );
+        result = left;
+        EXPECT_EQ( ToBitset( result.AndNot( right ) ), leftBits & ~rightBits );
+        result = left;
+        EXPECT_EQ( ToBitset( result.ShiftUp( shift ) ), leftBits << shift ) << shift;
+        result = left;
+        EXPECT_EQ( ToBitset( result.ShiftDown( shift ) ), leftBits >> shift ) << shift;
+        EXPECT_EQ( left.Count( ), leftBits.count( ) );
+    }
+}
+
+TEST( BitArrayTest, SpanOverExternalWords )
+{
+    TBitWord words[ 2 ] = { };
+    CBitSpan span{ words, KBitWordBits + 4 };
+    span.SetAll( );
+    EXPECT_EQ( span.Count( ), KBitWordBits + 4 );
+    EXPECT_EQ( words[ 1 ], TBitWord{ 0xF } );
+
+    TBitArray< KBitWordBits + 4 > mask;
+    mask.Set( 1 );
+    EXPECT_EQ( span.AndNot( mask ).Count( ), KBitWordBits + 3 );
+    EXPECT_FALSE( span.Test( 1 ) );
+    EXPECT_TRUE( mask.Span( ).Test( 1 ) );
+    EXPECT_NE( span, mask );
+    EXPECT_EQ( span.Xor( span ), TBitArray< KBitWordBits + 4 >{ } );
+}
+
+TEST( BitArrayTest, CombineWithShorterArray )
+{
+    // The missing bits of the shorter array count as clear
+    TBitArray< KBitWordBits * 2 > bits;
+    bits.Set( 0 );
+    bits.Set( KBitWordBits + 1 );
+    TBitArray< 4 > shorter;
+    shorter.Set( 0 );
+    shorter.Set( 2 );
+
+    auto result = bits;
+    result.And( shorter );
+    EXPECT_EQ( result.Count( ), 1u );
+    EXPECT_TRUE( result.Test( 0 ) );
+
+    result = bits;
+    EXPECT_EQ( result.Or( shorter ).Count( ), 3u );
+    result = bits;
+    EXPECT_EQ( result.Xor( shorter ).Count( ), 2u );
+    EXPECT_TRUE( result.Test( KBitWordBits + 1 ) );
+    result = bits;
+    EXPECT_EQ( result.AndNot( shorter ).Count( ), 1u );
+    EXPECT_TRUE( result.Test( KBitWordBits + 1 ) );
+}
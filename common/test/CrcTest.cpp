@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/Crc.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr std::uint8_t kCheck[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+template < typename taCrc >
+typename taCrc::TValue
+BitwiseReference( const std::uint8_t* aData,
+                  size_t aLength,
+                  typename taCrc::TValue aPolynomial,
+                  typename taCrc::TValue aInitial,
+                  bool aReflected )
+{
+    using TValue = typename taCrc::TValue;
+    constexpr int kWidth = 8 * sizeof( TValue );
+    TValue crc = aInitial;
+    for ( size_t index = 0; index < aLength; ++index )
+    {
+        std::uint8_t byte = aData[ index ];
+        for ( int bit = 0; bit < 8; ++bit )
+        {
+            const int dataBit = aReflected ? ( byte >> bit ) & 1 : ( byte >> ( 7 - bit ) ) & 1;
+            const int topBit = ( crc >> ( kWidth - 1 ) ) & 1;
+            crc = static_cast< TValue >( crc << 1 );
+            if ( topBit ^ dataBit )
+            {
+                crc ^= aPolynomial;
+            }
+        }
+    }
+    if ( aReflected )
+    {
+        TValue reflected = 0;
+        for ( int bit = 0; bit < kWidth; ++bit )
+        {
+            reflected = static_cast< TValue >( ( reflected << 1 ) | ( ( crc >> bit ) & 1 ) );
+        }
+        crc = reflected;
+    }
+    return crc;
+}
+}  // namespace
+
+TEST( CrcTest, CheckValues )
+{
+    EXPECT_EQ( TCrc8Smbus::Compute( kCheck, sizeof( kCheck ) ), 0xF4 );
+    EXPECT_EQ( TCrc8Sensirion::Compute( kCheck, sizeof( kCheck ) ), 0xF7 );
+    EXPECT_EQ( TCrc16CcittFalse::Compute( kCheck, sizeof( kCheck ) ), 0x29B1 );
+    EXPECT_EQ( TCrc16Modbus::Compute( kCheck, sizeof( kCheck ) ), 0x4B37 );
+
+    // The Sensirion datasheet example
+    const std::uint8_t kWord[] = { 0xBE, 0xEF };
+    EXPECT_EQ( TCrc8Sensirion::Compute( kWord, sizeof( kWord ) ), 0x92 );
+
+    static_assert( TCrc8Smbus::ComputeConstexpr( kCheck, sizeof( kCheck ) ) == 0xF4 );
+    static_assert( TCrc16Modbus::ComputeConstexpr( kCheck, sizeof( kCheck ) ) == 0x4B37 );
+}
+
+TEST( CrcTest, MatchesBitwiseReference )
+{
+    std::uint8_t data[ 67 ];
+    for ( size_t i = 0; i < sizeof( data ); ++i )
+    {
+        data[ i ] = static_cast< std::uint8_t >( i * 37 + 11 );
+    }
+
+    using TCrc32 = TCrc< std::uint32_t, 0x04C11DB7, 0xFFFFFFFF, true, 0xFFFFFFFF >;
+    EXPECT_EQ( TCrc32::Compute( kCheck, sizeof( kCheck ) ), 0xCBF43926u );
+
+    for ( size_t length = 0; length <= sizeof( data ); ++length )
+    {
+        EXPECT_EQ( TCrc8Sensirion::Compute( data, length ),
+                   BitwiseReference< TCrc8Sensirion >( data, length, 0x31, 0xFF, false ) );
+        EXPECT_EQ( TCrc16CcittFalse::Compute( data, length ),
+                   BitwiseReference< TCrc16CcittFalse >( data, length, 0x1021, 0xFFFF, false ) );
+        EXPECT_EQ( TCrc16Modbus::Compute( data, length ),
+                   BitwiseReference< TCrc16Modbus >( data, length, 0x8005, 0xFFFF, true ) );
+    }
+}
+
+TEST( CrcTest, Incremental )
+{
+    auto crc = TCrc16CcittFalse::Initial( );
+    crc = TCrc16CcittFalse::Update( crc, kCheck, 5 );
+    crc = TCrc16CcittFalse::Update( crc, kCheck + 5, 4 );
+    EXPECT_EQ( TCrc16CcittFalse::Finalize( crc ), 0x29B1 );
+}
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/FixedPoint.hpp>
+
+#include <cmath>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+using namespace AbstractPlatform;
+namespace
+{
+static_assert( sizeof( TQ15 ) == 2 );
+static_assert( sizeof( TQ15_16 ) == 4 );
+static_assert( sizeof( TFixed< 40, 20 > ) == 8 );
+static_assert( TQ7_8::FromFloat( 1.5 ).Raw( ) == 384 );
+static_assert( TQ7_8::FromFloat( 1.5 ) * TQ7_8::FromInteger( 3 ) == TQ7_8::FromFloat( 4.5 ) );
+static_assert( TQ7_8::FromInteger( 200 ) == TQ7_8::Max( ) );
+static_assert( TQ15::One( ) == TQ15::Max( ) );
+
+using TQ3_4 = TFixed< 3, 4 >;
+
+TQ3_4
+Q34( int aRaw )
+{
+    return TQ3_4::FromRaw( static_cast< TQ3_4::TRaw >( aRaw ) );
+}
+}  // namespace
+
+TEST( FixedPointTest, Conversions )
+{
+    EXPECT_EQ( TQ15_16::FromFloat( -2.25 ).Raw( ), -147456 );
+    EXPECT_DOUBLE_EQ( TQ15_16::FromFloat( -2.25 ).ToFloat( ), -2.25 );
+    EXPECT_EQ( TQ15::FromFloat( 1.0 ), TQ15::Max( ) );
+    EXPECT_EQ( TQ15::FromFloat( -1.0 ).Raw( ), -32768 );
+
+    // -2.25 rounded with every rounding mode.
+    const auto value = TQ15_16::FromFloat( -2.25 );
+    EXPECT_EQ( value.ToInteger( ), -3 );
+    EXPECT_EQ( value.ToInteger< TFixedRounding::TowardZero >( ), -2 );
+    EXPECT_EQ( value.ToInteger< TFixedRounding::Nearest >( ), -2 );
+    EXPECT_EQ( TQ15_16::FromFloat( -2.5 ).ToInteger< TFixedRounding::Nearest >( ), -2 );
+    EXPECT_EQ( TQ15_16::FromFloat( -2.5 ).ToInteger< TFixedRounding::NearestEven >( ), -2 );
+    EXPECT_EQ( TQ15_16::FromFloat( 3.5 ).ToInteger< TFixedRounding::NearestEven >( ), 4 );
+
+    EXPECT_EQ( FixedCast< TQ7_8 >( TQ15_16::FromFloat( 1.0 / 3 ) ), TQ7_8::FromRaw( 85 ) );
+    EXPECT_EQ( FixedCast< TQ7_8 >( TQ15_16::FromInteger( 1000 ) ), TQ7_8::Max( ) );
+    EXPECT_EQ( FixedCast< TQ15_16 >( TQ7_8::FromFloat( -0.75 ) ), TQ15_16::FromFloat( -0.75 ) );
+    EXPECT_EQ( FixedCast< TQ15 >( TQ7_8::FromInteger( -2 ) ), TQ15::Min( ) );
+}
+
+TEST( FixedPointTest, SaturatingArithmetic )
+{
+    EXPECT_EQ( TQ15::Max( ) + TQ15::Epsilon( ), TQ15::Max( ) );
+    EXPECT_EQ( TQ15::Min( ) - TQ15::Epsilon( ), TQ15::Min( ) );
+    EXPECT_EQ( -TQ15::Min( ), TQ15::Max( ) );
+    EXPECT_EQ( TQ15::Min( ) * TQ15::Min( ), TQ15::Max( ) );
+    EXPECT_EQ( Abs( TQ7_8::FromFloat( -3.5 ) ), TQ7_8::FromFloat( 3.5 ) );
+
+    EXPECT_EQ( TQ7_8::FromInteger( 1 ) / TQ7_8{ }, TQ7_8::Max( ) );
+    EXPECT_EQ( TQ7_8::FromInteger( -1 ) / TQ7_8{ }, TQ7_8::Min( ) );
+    EXPECT_EQ( TQ7_8::FromInteger( 100 ) / TQ7_8::FromFloat( 0.5 ), TQ7_8::Max( ) );
+
+    const auto half = TFixed< 40, 20 >::FromFloat( 0.5 );
+    EXPECT_EQ( ( half * TFixed< 40, 20 >::FromInteger( 1 << 30 ) ).ToInteger( ), 1 << 29 );
+}
+
+TEST( FixedPointTest, SaturatesWideOperands )
+{
+    // The integers out of the TWide range
+    EXPECT_EQ( TQ7_8::FromInteger( std::int64_t{ 1 } << 32 ), TQ7_8::Max( ) );
+    EXPECT_EQ( TQ7_8::FromInteger( std::uint32_t{ 4000000000u } ), TQ7_8::Max( ) );
+    EXPECT_EQ( TQ7_8::FromInteger( std::numeric_limits< std::int64_t >::min( ) ), TQ7_8::Min( ) );
+    EXPECT_EQ( TQ7_8::FromInteger( -128 ), TQ7_8::Min( ) );
+    EXPECT_EQ( TQ7_8::FromInteger( -129 ), TQ7_8::Min( ) );
+    EXPECT_EQ( TQ7_8::FromInteger( 127 ).Raw( ), 127 * 256 );
+    EXPECT_EQ( TQ7_8::FromInteger( 128u ), TQ7_8::Max( ) );
+
+    // The shifted raw value out of the target TWide range
+    using TQ31_32 = TFixed< 31, 32 >;
+    EXPECT_EQ( FixedCast< TQ7_8 >( TQ31_32::FromInteger( 1 << 24 ) ), TQ7_8::Max( ) );
+    EXPECT_EQ( FixedCast< TQ7_8 >( TQ31_32::FromInteger( -( 1 << 24 ) ) ), TQ7_8::Min( ) );
+
+    // The sums of the 32-bit products out of the 64-bit range
+    const TQ31 left[] = { TQ31::Min( ), TQ31::Min( ), TQ31::Min( ), TQ31::Min( ) };
+    EXPECT_EQ( FixedDotProduct( left, left, 4 ), TQ31::Max( ) );
+    const TQ31 right[] = { TQ31::Min( ), TQ31::Min( ), TQ31::Max( ), TQ31::Max( ) };
+    EXPECT_EQ( FixedDotProduct( left, right, 4 ).Raw( ), 2 );
+
+    // The 64-bit products saturate the accumulator
+    const TQ31_32 wide[] = { TQ31_32::Max( ), TQ31_32::Max( ), TQ31_32::Max( ) };
+    EXPECT_EQ( FixedDotProduct( wide, wide, 3 ), TQ31_32::Max( ) );
+}
+
+TEST( FixedPointTest, RoundingMatchesReference )
+{
+    // Exhaustive over Q3.4, compared with the rounding of the exact rational result.
+    for ( int left = -128; left < 128; ++left )
+    {
+        for ( int right = -128; right < 128; ++right )
+        {
+            const double exact = left * right / 16.0;
+            const auto clamp
+                = []( double aValue ) { return std::fmin( std::fmax( aValue, -128 ), 127 ); };
+            ASSERT_EQ( TQ3_4::Multiply< TFixedRounding::Floor >( Q34( left ), Q34( right ) ),
+                       Q34( static_cast< int >( clamp( std::floor( exact ) ) ) ) );
+            ASSERT_EQ( TQ3_4::Multiply< TFixedRounding::TowardZero >( Q34( left ), Q34( right ) ),
+                       Q34( static_cast< int >( clamp( std::trunc( exact ) ) ) ) );
+            ASSERT_EQ( TQ3_4::Multiply< TFixedRounding::Nearest >( Q34( left ), Q34( right ) ),
+                       Q34( static_cast< int >( clamp( std::floor( exact + 0.5 ) ) ) ) );
+            ASSERT_EQ( TQ3_4::Multiply< TFixedRounding::NearestEven >( Q34( left ), Q34( right ) ),
+                       Q34( static_cast< int >( clamp( std::nearbyint( exact ) ) ) ) );
+
+            if ( right == 0 )
+            {
+                continue;
+            }
+            const double quotient = left * 16.0 / right;
+            ASSERT_EQ( TQ3_4::Divide< TFixedRounding::Floor >( Q34( left ), Q34( right ) ),
+                       Q34( static_cast< int >( clamp( std::floor( quotient ) ) ) ) );
+            ASSERT_EQ( TQ3_4::Divide< TFixedRounding::TowardZero >( Q34( left ), Q34( right ) ),
+                       Q34( static_cast< int >( clamp( std::trunc( quotient ) ) ) ) );
+            ASSERT_EQ( TQ3_4::Divide< TFixedRounding::Nearest >( Q34( left ), Q34( right ) ),
+                       Q34( static_cast< int >( clamp( std::floor( quotient + 0.5 ) ) ) ) );
+            ASSERT_EQ( TQ3_4::Divide< TFixedRounding::NearestEven >( Q34( left ), Q34( right ) ),
+                       Q34( static_cast< int >( clamp( std::nearbyint( quotient ) ) ) ) );
+        }
+    }
+}
+
+TEST( FixedPointTest, BulkOperations )
+{
+    constexpr size_t kCount = 67;
+    std::mt19937 generator{ 7 };
+    std::uniform_int_distribution< int > distribution{ -32768, 32767 };
+
+    TQ15 left[ kCount ];
+    TQ15 right[ kCount ];
+    TQ15 accumulator[ kCount ];
+    for ( size_t i = 0; i < kCount; ++i )
+    {
+        left[ i ] = TQ15::FromRaw( static_cast< std::int16_t >( distribution( generator ) ) );
+        right[ i ] = TQ15::FromRaw( static_cast< std::int16_t >( distribution( generator ) ) );
+        accumulator[ i ]
+            = TQ15::FromRaw( static_cast< std::int16_t >( distribution( generator ) ) );
+    }
+    left[ 0 ] = right[ 0 ] = TQ15::Min( );
+
+    TQ15 sum[ kCount ];
+    TQ15 product[ kCount ];
+    TQ15 mac[ kCount ];
+    std::copy( accumulator, accumulator + kCount, mac );
+    FixedAdd( left, right, sum, kCount );
+    FixedMultiply( left, right, product, kCount );
+    FixedMultiplyAccumulate( mac, left, right, kCount );
+
+    std::int64_t dot = 0;
+    for ( size_t i = 0; i < kCount; ++i )
+    {
+        ASSERT_EQ( sum[ i ], left[ i ] + right[ i ] ) << i;
+        ASSERT_EQ( product[ i ], left[ i ] * right[ i ] ) << i;
+        const std::int64_t exact = std::int64_t{ left[ i ].Raw( ) } * right[ i ].Raw( )
+                                   + std::int64_t{ accumulator[ i ].Raw( ) } * 32768;
+        const std::int64_t rounded = ( exact + 16384 ) >> 15;
+        const std::int64_t saturated
+            = rounded > 32767 ? 32767 : rounded < -32768 ? -32768 : rounded;
+        ASSERT_EQ( mac[ i ].Raw( ), saturated ) << i;
+        dot += std::int64_t{ left[ i ].Raw( ) } * right[ i ].Raw( );
+    }
+
+    const std::int64_t expectedDot = ( dot + 16384 ) >> 15;
+    const auto result = FixedDotProduct( left, right, kCount );
+    EXPECT_EQ( result.Raw( ), expectedDot > 32767    ? 32767
+                              : expectedDot < -32768 ? -32768
+                                                     : expectedDot );
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/InplaceFunction.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+using namespace AbstractPlatform;
+namespace
+{
+using THandler = TInplaceFunction< int( int ) >;
+
+static_assert( !std::is_copy_constructible< THandler >::value );
+static_assert( std::is_nothrow_move_constructible< THandler >::value );
+static_assert( sizeof( THandler ) <= KInplaceFunctionCapacity + 2 * alignof( std::max_align_t ) );
+
+int
+Twice( int aValue )
+{
+    return 2 * aValue;
+}
+
+struct TCounted
+{
+    explicit TCounted( int& aInstances )
+        : iInstances{ &aInstances }
+    {
+        ++*iInstances;
+    }
+
+    TCounted( TCounted&& aOther ) noexcept
+        : iInstances{ aOther.iInstances }
+    {
+        ++*iInstances;
+    }
+
+    ~TCounted( )
+    {
+        --*iInstances;
+    }
+
+    int
+    operator( )( int aValue ) const
+    {
+        return aValue + *iInstances;
+    }
+
+    int* iInstances;
+};
+}  // namespace
+
+TEST( InplaceFunctionTest, CallsStoredCallables )
+{
+    THandler handler;
+    EXPECT_FALSE( handler );
+    EXPECT_TRUE( handler == nullptr );
+
+    handler = &Twice;
+    EXPECT_EQ( handler( 4 ), 8 );
+
+    const std::uint64_t offsets[ 3 ] = { 1, 2, 3 };
+    handler = [ offsets ]( int aValue ) { return aValue + static_cast< int >( offsets[ 2 ] ); };
+    EXPECT_EQ( handler( 4 ), 7 );
+
+    int calls = 0;
+    TInplaceFunction< void( ) > counter{ [ &calls ]( ) { ++calls; } };
+    counter( );
+    counter( );
+    EXPECT_EQ( calls, 2 );
+}
+
+TEST( InplaceFunctionTest, MoveOnlyCapture )
+{
+    auto value = std::make_unique< int >( 5 );
+    THandler handler{ [ value = std::move( value ) ]( int aValue ) { return aValue * *value; } };
+    THandler moved{ std::move( handler ) };
+    EXPECT_FALSE( handler );
+    EXPECT_EQ( moved( 3 ), 15 );
+
+    handler = std::move( moved );
+    EXPECT_EQ( handler( 2 ), 10 );
+    EXPECT_FALSE( moved );
+}
+
+TEST( InplaceFunctionTest, DestroysCallable )
+{
+    int instances = 0;
+    {
+        THandler handler{ TCounted{ instances } };
+        EXPECT_EQ( instances, 1 );
+        EXPECT_EQ( handler( 1 ), 2 );
+
+        THandler moved{ std::move( handler ) };
+        EXPECT_EQ( instances, 1 );
+
+        handler.Emplace< TCounted >( instances );
+        EXPECT_EQ( instances, 2 );
+
+        moved = nullptr;
+        EXPECT_EQ( instances, 1 );
+    }
+    EXPECT_EQ( instances, 0 );
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/LookupTable.hpp>
+
+#include <cmath>
+#include <cstdint>
+
+using namespace AbstractPlatform;
+namespace
+{
+struct TSquares
+{
+    using TValue = std::uint16_t;
+    static constexpr size_t kSize = 256;
+
+    static constexpr TValue
+    Generate( size_t aIndex )
+    {
+        return static_cast< TValue >( aIndex * aIndex );
+    }
+};
+
+static_assert( TLookupTable< TSquares >::kEntries[ 12 ] == 144 );
+static_assert( TGammaTable< >::kEntries[ 255 ] == 255 );
+static_assert( SineLookup( 0x4000 ) == TQ15::Max( ) );
+}  // namespace
+
+TEST( LookupTableTest, ConstexprMathMatchesReference )
+{
+    for ( double x = -20; x <= 20; x += 0.01 )
+    {
+        ASSERT_NEAR( ConstexprSin( x ), std::sin( x ), 1e-12 ) << x;
+        ASSERT_NEAR( ConstexprCos( x ), std::cos( x ), 1e-12 ) << x;
+        ASSERT_NEAR( ConstexprExp( x ) / std::exp( x ), 1.0, 1e-13 ) << x;
+    }
+    for ( double x = 1e-6; x < 1e6; x *= 1.01 )
+    {
+        ASSERT_NEAR( ConstexprLog( x ), std::log( x ), 1e-12 ) << x;
+        ASSERT_NEAR( ConstexprSqrt( x ) / std::sqrt( x ), 1.0, 1e-15 ) << x;
+        ASSERT_NEAR( ConstexprPow( x, 2.2 ) / std::pow( x, 2.2 ), 1.0, 1e-12 ) << x;
+    }
+}
+
+TEST( LookupTableTest, InterpolationIsExactOnLinearTable )
+{
+    constexpr auto kTable = MakeLookupTable< int, 5 >(
+        []( size_t aIndex ) { return 100 * static_cast< int >( aIndex ) - 200; } );
+    EXPECT_EQ( InterpolateLookup< 4 >( kTable, 0 ), -200 );
+    EXPECT_EQ( InterpolateLookup< 4 >( kTable, 8 ), -150 );
+    EXPECT_EQ( InterpolateLookup< 4 >( kTable, 3 * 16 + 15 ), 194 );
+}
+
+TEST( LookupTableTest, SineAccuracy )
+{
+    double maxError = 0;
+    for ( std::uint32_t angle = 0; angle < 0x10000; ++angle )
+    {
+        const double radians = 2 * KPi * angle / 65536.0;
+        const auto angle16 = static_cast< TBinaryAngle >( angle );
+        maxError = std::fmax( maxError,
+                              std::fabs( SineLookup( angle16 ).ToFloat( ) - std::sin( radians ) ) );
+        maxError = std::fmax(
+            maxError, std::fabs( CosineLookup( angle16 ).ToFloat( ) - std::cos( radians ) ) );
+    }
+    EXPECT_LT( maxError, 1.2e-4 );
+}
+
+TEST( LookupTableTest, GammaMatchesReference )
+{
+    const auto& gamma = TGammaTable< 22, 10 >::kEntries;
+    const auto& inverse = TGammaTable< 10, 22 >::kEntries;
+    for ( int value = 0; value < 256; ++value )
+    {
+        EXPECT_EQ( gamma[ value ],
+                   static_cast< std::uint8_t >( 255 * std::pow( value / 255.0, 2.2 ) + 0.5 ) );
+        EXPECT_EQ( inverse[ value ],
+                   static_cast< std::uint8_t >( 255 * std::pow( value / 255.0, 1 / 2.2 ) + 0.5 ) );
+    }
+}
+
+TEST( LookupTableTest, SqrtAccuracy )
+{
+    for ( std::uint64_t value = 1; value <= 0xFFFFFFFFu; value = value * 5 / 4 + 1 )
+    {
+        const double root = std::sqrt( static_cast< double >( value ) );
+        const double lookup = SqrtLookup( static_cast< std::uint32_t >( value ) );
+        ASSERT_LE( std::fabs( lookup - root ), 0.5 + 5e-4 * root ) << value;
+    }
+    EXPECT_EQ( SqrtLookup( 0 ), 0 );
+    EXPECT_EQ( SqrtLookup( 0xFFFFFFFFu ), 0xFFFF );
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/MpscQueue.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+struct TItem : public TMpscNode
+{
+    std::uint32_t iProducer = 0;
+    std::uint32_t iValue = 0;
+};
+}  // namespace
+
+TEST( MpscQueueTest, Fifo )
+{
+    TMpscQueue< TItem > queue;
+    EXPECT_EQ( queue.Pop( ), nullptr );
+
+    TItem items[ 3 ];
+    for ( auto& item : items )
+    {
+        queue.Push( item );
+    }
+    EXPECT_EQ( queue.Pop( ), &items[ 0 ] );
+    EXPECT_EQ( queue.Pop( ), &items[ 1 ] );
+
+    queue.Push( items[ 0 ] );
+    EXPECT_EQ( queue.Pop( ), &items[ 2 ] );
+    EXPECT_EQ( queue.Pop( ), &items[ 0 ] );
+    EXPECT_EQ( queue.Pop( ), nullptr );
+}
+
+TEST( MpscQueueTest, ConcurrentProducers )
+{
+    constexpr std::uint32_t kProducers = 4;
+    constexpr std::uint32_t kItemsPerProducer = 10000;
+
+    TMpscQueue< TItem > queue;
+    std::vector< TItem > items( kProducers * kItemsPerProducer );
+    std::vector< std::thread > producers;
+    for ( std::uint32_t producer = 0; producer < kProducers; ++producer )
+    {
+        producers.emplace_back( [ &, producer ]( ) {
+            for ( std::uint32_t value = 0; value < kItemsPerProducer; ++value )
+            {
+                auto& item = items[ producer * kItemsPerProducer + value ];
+                item.iProducer = producer;
+                item.iValue = value;
+                queue.Push( item );
+            }
+        } );
+    }
+
+    std::uint32_t expected[ kProducers ] = { };
+    for ( std::uint32_t received = 0; received < kProducers * kItemsPerProducer; )
+    {
+        if ( TItem* item = queue.Pop( ) )
+        {
+            ASSERT_EQ( item->iValue, expected[ item->iProducer ]++ );
+            ++received;
+        }
+    }
+    for ( auto& producer : producers )
+    {
+        producer.join( );
+    }
+    EXPECT_EQ( queue.Pop( ), nullptr );
+}
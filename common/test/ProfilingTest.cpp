@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+// The macros are tested regardless of the USE_PROFILING option.
+#ifndef PROFILING
+#define PROFILING
+#endif
+#include <AbstractPlatform/common/Profiling.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+using THistogram = Detail::TLogLinearHistogram;
+
+void
+ProfiledFunction( )
+{
+    PROFILE_SCOPE( "test.profiled_function" );
+    PROFILE_COUNT( "test.profiled_calls", 1 );
+    PROFILE_GAUGE( "test.profiled_gauge", -7 );
+}
+
+bool
+FindTimer( const char* aName, TProfileTimerStatistics& aStatistics )
+{
+    auto& profiler = CProfiler::Instance( );
+    for ( size_t index = 0; index < profiler.TimerCount( ); ++index )
+    {
+        if ( profiler.TimerStatistics( index, aStatistics )
+             && std::strcmp( aStatistics.iName, aName ) == 0 )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
+TEST( ProfilingTest, LogLinearHistogramLayout )
+{
+    EXPECT_EQ( THistogram::BucketOf( 0 ), 0u );
+    EXPECT_EQ( THistogram::BucketOf( 3 ), 3u );
+    EXPECT_EQ( THistogram::BucketOf( 4 ), 4u );
+    EXPECT_EQ( THistogram::BucketOf( 8 ), 8u );
+    EXPECT_EQ( THistogram::BucketOf( 11 ), 9u );
+    EXPECT_EQ( THistogram::BucketOf( ~std::uint64_t{ 0 } ), THistogram::kBuckets - 1 );
+
+    for ( std::uint64_t value = 1; value < ( std::uint64_t{ 1 } << 40 ); value = value * 3 + 1 )
+    {
+        const size_t bucket = THistogram::BucketOf( value );
+        ASSERT_LE( THistogram::LowerBound( bucket ), value );
+        ASSERT_GT( THistogram::LowerBound( bucket + 1 ), value );
+        // The relative width of the bucket is at most 1 / kSubBuckets.
+        ASSERT_LE( ( THistogram::LowerBound( bucket + 1 ) - THistogram::LowerBound( bucket ) )
+                       * THistogram::kSubBuckets,
+                   value + THistogram::kSubBuckets );
+    }
+}
+
+TEST( ProfilingTest, TimerStatistics )
+{
+    static CProfileSite site{ "test.timer_statistics", TProfileSiteKind::Timer };
+    auto& profiler = CProfiler::Instance( );
+    ASSERT_NE( site.Index( ), CProfiler::kInvalidIndex );
+
+    for ( TNanoseconds duration = 1; duration <= 100; ++duration )
+    {
+        profiler.RecordDuration( site.Index( ), duration * 1000 );
+    }
+
+    TProfileTimerStatistics statistics;
+    ASSERT_TRUE( profiler.TimerStatistics( site.Index( ), statistics ) );
+    EXPECT_STREQ( statistics.iName, "test.timer_statistics" );
+    EXPECT_EQ( statistics.iCount, 100u );
+    EXPECT_EQ( statistics.iTotal, 5050u * 1000 );
+    EXPECT_EQ( statistics.iMax, 100000u );
+    // Within the bucket resolution of 25 %.
+    EXPECT_GE( statistics.iP50, 50000u );
+    EXPECT_LE( statistics.iP50, 62500u );
+    EXPECT_GE( statistics.iP90, 90000u );
+    EXPECT_LE( statistics.iP99, 100000u );
+    EXPECT_FALSE( profiler.TimerStatistics( CProfiler::kMaxTimers, statistics ) );
+}
+
+TEST( ProfilingTest, CountersMergeThreads )
+{
+    static CProfileSite site{ "test.thread_counter", TProfileSiteKind::Counter };
+    auto& profiler = CProfiler::Instance( );
+
+    std::vector< std::thread > threads;
+    for ( int thread = 0; thread < 4; ++thread )
+    {
+        threads.emplace_back( []( ) {
+            for ( int iteration = 0; iteration < 1000; ++iteration )
+            {
+                site.Add( 2 );
+            }
+        } );
+    }
+    for ( auto& thread : threads )
+    {
+        thread.join( );
+    }
+
+    EXPECT_EQ( profiler.CounterValue( site.Index( ) ), 8000u );
+    EXPECT_STREQ( profiler.CounterName( site.Index( ) ), "test.thread_counter" );
+}
+
+TEST( ProfilingTest, MacrosAndExport )
+{
+    ProfiledFunction( );
+    ProfiledFunction( );
+
+    TProfileTimerStatistics statistics;
+    ASSERT_TRUE( FindTimer( "test.profiled_function", statistics ) );
+    EXPECT_GE( statistics.iCount, 2u );
+
+    char text[ 4096 ];
+    const size_t textLength = CProfiler::Instance( ).WriteText( text, sizeof( text ) );
+    ASSERT_LT( textLength, sizeof( text ) );
+    EXPECT_NE( std::strstr( text, "timer test.profiled_function count=" ), nullptr );
+    EXPECT_NE( std::strstr( text, "counter test.profiled_calls value=" ), nullptr );
+    EXPECT_NE( std::strstr( text, "gauge test.profiled_gauge value=-7" ), nullptr );
+
+    char json[ 4096 ];
+    const size_t jsonLength = CProfiler::Instance( ).WriteJson( json, sizeof( json ) );
+    ASSERT_LT( jsonLength, sizeof( json ) );
+    EXPECT_EQ( std::strncmp( json, "{\"timers\":[", 11 ), 0 );
+    EXPECT_NE( std::strstr( json, "{\"name\":\"test.profiled_gauge\",\"value\":-7}" ), nullptr );
+    EXPECT_EQ( json[ jsonLength - 1 ], '}' );
+
+    // The truncated output reports the complete length.
+    char small[ 16 ];
+    EXPECT_EQ( CProfiler::Instance( ).WriteJson( small, sizeof( small ) ), jsonLength );
+    EXPECT_EQ( std::strlen( small ), sizeof( small ) - 1 );
+}
+
+TEST( ProfilingTest, ScopeMeasuresDuration )
+{
+    static CProfileSite site{ "test.sleep", TProfileSiteKind::Timer };
+    {
+        CProfileScope scope{ site };
+        std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+    }
+
+    TProfileTimerStatistics statistics;
+    ASSERT_TRUE( CProfiler::Instance( ).TimerStatistics( site.Index( ), statistics ) );
+    EXPECT_EQ( statistics.iCount, 1u );
+    EXPECT_GE( statistics.iTotal, 1500000u );
+    EXPECT_LT( statistics.iTotal, 1000000000u );
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/Result.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+using namespace AbstractPlatform;
+namespace
+{
+static_assert( sizeof( TResult< void, TErrorCode > ) == sizeof( TErrorCode ) );
+static_assert( sizeof( TResult< std::uint16_t, TErrorCode > ) == 2 * sizeof( TErrorCode ) );
+static_assert( std::is_trivially_copyable< TResult< std::uint32_t, TErrorCode > >::value );
+static_assert( std::is_trivially_copyable< TResult< void, TCategorizedError > >::value );
+
+constexpr TResult< int, TErrorCode >
+ParseDigit( char aCharacter )
+{
+    if ( aCharacter < '0' || aCharacter > '9' )
+    {
+        return Failure( KInvalidArgumentError );
+    }
+    return aCharacter - '0';
+}
+
+constexpr TResult< int, TErrorCode >
+ParseTwoDigits( const char* aText )
+{
+    const auto high = ParseDigit( aText[ 0 ] );
+    RETURN_IF_FAILED( high );
+    return ParseDigit( aText[ 1 ] ).Transform( [ & ]( int aLow ) { return *high * 10 + aLow; } );
+}
+
+static_assert( ParseTwoDigits( "42" ).Value( ) == 42 );
+static_assert( ParseTwoDigits( "4x" ).Error( ) == KInvalidArgumentError );
+
+const char*
+DescribeSensorError( TErrorCode aCode )
+{
+    return aCode == -100 ? "Sensor not ready" : "Sensor error";
+}
+
+constexpr TErrorCategory KSensorErrorCategory{ "sensor", &DescribeSensorError };
+}  // namespace
+
+TEST( ResultTest, ValueAndError )
+{
+    TResult< std::uint8_t, TErrorCode > value{ 7 };
+    EXPECT_TRUE( value );
+    EXPECT_EQ( *value, 7 );
+    EXPECT_EQ( ToErrorCode( value ), KOk );
+
+    TResult< std::uint8_t, TErrorCode > error{ Failure( KGenericError ) };
+    EXPECT_FALSE( error.HasValue( ) );
+    EXPECT_EQ( error.Error( ), KGenericError );
+    EXPECT_EQ( error.ValueOr( 3 ), 3 );
+
+    EXPECT_TRUE( ToResult( KOk ) );
+    EXPECT_EQ( ToResult( KInvalidVendor ).Error( ), KInvalidVendor );
+}
+
+TEST( ResultTest, MonadicChaining )
+{
+    int calls = 0;
+    const auto next = [ & ]( int aValue ) -> TResult< int, TErrorCode > {
+        ++calls;
+        return aValue + 1;
+    };
+
+    EXPECT_EQ( ParseDigit( '1' ).AndThen( next ).AndThen( next ).Value( ), 3 );
+    EXPECT_EQ( ParseDigit( '-' ).AndThen( next ).Error( ), KInvalidArgumentError );
+    EXPECT_EQ( calls, 2 );
+
+    const auto recovered = ParseDigit( '-' ).OrElse(
+        []( TErrorCode ) -> TResult< int, TErrorCode > { return 0; } );
+    EXPECT_EQ( recovered.Value( ), 0 );
+
+    const auto mappedError
+        = ParseDigit( '-' ).TransformError( []( TErrorCode ) { return KGenericError; } );
+    EXPECT_EQ( mappedError.Error( ), KGenericError );
+
+    TResult< void, TErrorCode > done;
+    EXPECT_EQ( done.Transform( [ & ]( ) { return calls; } ).Value( ), 2 );
+    EXPECT_FALSE( done.AndThen( [ ]( ) { return ParseDigit( 'x' ); } ) );
+}
+
+TEST( ResultTest, ErrorCategories )
+{
+    const TResult< void, TCategorizedError > platform{ Failure( KChecksumError ) };
+    EXPECT_EQ( ErrorCodeOf( platform.Error( ) ), KChecksumError );
+    EXPECT_STREQ( platform.Error( ).iCategory->iName, "platform" );
+    EXPECT_STREQ( platform.Error( ).Describe( ), "Checksum mismatch" );
+
+    const TResult< float, TCategorizedError > sensor{ Failure(
+        TCategorizedError{ -100, KSensorErrorCategory } ) };
+    EXPECT_FALSE( sensor );
+    EXPECT_NE( sensor.Error( ), TCategorizedError{ -100 } );
+    EXPECT_STREQ( sensor.Error( ).Describe( ), "Sensor not ready" );
+    EXPECT_EQ( ToErrorCode( sensor ), -100 );
+}
+
+#ifdef __EXCEPTIONS
+TEST( ResultTest, ValueOrThrow )
+{
+    EXPECT_EQ( ParseDigit( '5' ).ValueOrThrow( ), 5 );
+    EXPECT_THROW( ParseDigit( 'x' ).ValueOrThrow( ), EInvalidArgumentError );
+}
+#endif
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/RingBuffer.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+}
+
+TEST( SpscRingTest, PushPop )
+{
+    TSpscRing< int, 4 > ring;
+    EXPECT_TRUE( ring.IsEmpty( ) );
+
+    const int kValues[] = { 1, 2, 3, 4, 5 };
+    EXPECT_EQ( ring.Push( kValues, 5 ), 4u );
+    EXPECT_FALSE( ring.Push( 6 ) );
+    EXPECT_EQ( ring.Size( ), 4u );
+
+    int value = 0;
+    EXPECT_TRUE( ring.Pop( value ) );
+    EXPECT_EQ( value, 1 );
+    EXPECT_TRUE( ring.Push( 5 ) );
+
+    int values[ 8 ] = { };
+    ASSERT_EQ( ring.Pop( values, 8 ), 4u );
+    EXPECT_EQ( values[ 0 ], 2 );
+    EXPECT_EQ( values[ 3 ], 5 );
+    EXPECT_FALSE( ring.Pop( value ) );
+}
+
+TEST( SpscRingTest, ProducerConsumer )
+{
+    constexpr std::uint32_t kCount = 10000;
+    TSpscRing< std::uint32_t, 64 > ring;
+
+    std::thread producer( [ &ring ]( ) {
+        for ( std::uint32_t value = 0; value < kCount; )
+        {
+            if ( !ring.Push( value ) )
+            {
+                // Lets the consumer run on a single CPU.
+                std::this_thread::yield( );
+                continue;
+            }
+            ++value;
+        }
+    } );
+
+    std::uint32_t expected = 0;
+    std::uint32_t values[ 16 ];
+    while ( expected < kCount )
+    {
+        const size_t count = ring.Pop( values, 16 );
+        if ( count == 0 )
+        {
+            std::this_thread::yield( );
+        }
+        for ( size_t i = 0; i < count; ++i )
+        {
+            ASSERT_EQ( values[ i ], expected++ );
+        }
+    }
+    producer.join( );
+}
+
+TEST( SpscRingTest, ReserveCommitWrapsAround )
+{
+    TSpscRing< int, 8 > ring;
+    const int kValues[] = { 1, 2, 3, 4, 5, 6 };
+    ASSERT_EQ( ring.Push( kValues, 6 ), 6u );
+    int values[ 4 ];
+    ASSERT_EQ( ring.Pop( values, 4 ), 4u );
+
+    // The free space wraps: the region ends at the end of the storage.
+    auto region = ring.ReserveWrite( 5 );
+    ASSERT_EQ( region.iCount, 2u );
+    region.iData[ 0 ] = 7;
+    region.iData[ 1 ] = 8;
+    ring.CommitWrite( region );
+
+    region = ring.ReserveWrite( 5 );
+    ASSERT_EQ( region.iCount, 4u );
+    region.iData[ 0 ] = 9;
+    region.iCount = 1;
+    ring.CommitWrite( region );
+    EXPECT_EQ( ring.Size( ), 5u );
+
+    auto readRegion = ring.ReserveRead( 8 );
+    ASSERT_EQ( readRegion.iCount, 4u );
+    EXPECT_EQ( readRegion.iData[ 0 ], 5 );
+    EXPECT_EQ( readRegion.iData[ 3 ], 8 );
+    ring.CommitRead( readRegion );
+
+    readRegion = ring.ReserveRead( 8 );
+    ASSERT_EQ( readRegion.iCount, 1u );
+    EXPECT_EQ( readRegion.iData[ 0 ], 9 );
+    ring.CommitRead( readRegion );
+    EXPECT_TRUE( ring.IsEmpty( ) );
+    EXPECT_EQ( ring.ReserveRead( 1 ).iCount, 0u );
+}
+
+TEST( SpscRingTest, ZeroCopyProducerConsumer )
+{
+    constexpr std::uint32_t kCount = 10000;
+    TSpscRing< std::uint32_t, 64 > ring;
+
+    std::thread producer( [ &ring ]( ) {
+        for ( std::uint32_t value = 0; value < kCount; )
+        {
+            auto region = ring.ReserveWrite( 16 );
+            if ( region.iCount == 0 )
+            {
+                std::this_thread::yield( );
+                continue;
+            }
+            size_t filled = 0;
+            for ( ; filled < region.iCount && value < kCount; ++filled )
+            {
+                region.iData[ filled ] = value++;
+            }
+            region.iCount = filled;
+            ring.CommitWrite( region );
+        }
+    } );
+
+    std::uint32_t expected = 0;
+    while ( expected < kCount )
+    {
+        const auto region = ring.ReserveRead( 32 );
+        if ( region.iCount == 0 )
+        {
+            std::this_thread::yield( );
+            continue;
+        }
+        for ( size_t i = 0; i < region.iCount; ++i )
+        {
+            ASSERT_EQ( region.iData[ i ], expected++ );
+        }
+        ring.CommitRead( region );
+    }
+    producer.join( );
+}
+
+TEST( MpmcRingTest, PushPop )
+{
+    TMpmcRing< int, 4 > ring;
+    EXPECT_TRUE( ring.IsEmpty( ) );
+
+    const int kValues[] = { 1, 2, 3, 4, 5 };
+    EXPECT_EQ( ring.Push( kValues, 5 ), 4u );
+    EXPECT_FALSE( ring.Push( 6 ) );
+    EXPECT_EQ( ring.Size( ), 4u );
+
+    int value = 0;
+    EXPECT_TRUE( ring.Pop( value ) );
+    EXPECT_EQ( value, 1 );
+    EXPECT_TRUE( ring.Push( 5 ) );
+
+    int values[ 8 ] = { };
+    ASSERT_EQ( ring.Pop( values, 8 ), 4u );
+    EXPECT_EQ( values[ 0 ], 2 );
+    EXPECT_EQ( values[ 3 ], 5 );
+    EXPECT_FALSE( ring.Pop( value ) );
+}
+
+TEST( MpmcRingTest, ReserveCommit )
+{
+    TMpmcRing< int, 8 > ring;
+    auto first = ring.ReserveWrite( 3 );
+    auto second = ring.ReserveWrite( 3 );
+    ASSERT_EQ( first.iCount, 3u );
+    ASSERT_EQ( second.iCount, 3u );
+    EXPECT_EQ( second.iData, first.iData + 3 );
+
+    second.iData[ 0 ] = 4;
+    second.iData[ 1 ] = 5;
+    second.iData[ 2 ] = 6;
+    ring.CommitWrite( second );
+
+    // The consumers wait at the first region until it is committed.
+    EXPECT_EQ( ring.ReserveRead( 8 ).iCount, 0u );
+
+    first.iData[ 0 ] = 1;
+    first.iData[ 1 ] = 2;
+    first.iData[ 2 ] = 3;
+    ring.CommitWrite( first );
+
+    const auto region = ring.ReserveRead( 8 );
+    ASSERT_EQ( region.iCount, 6u );
+    for ( size_t i = 0; i < region.iCount; ++i )
+    {
+        EXPECT_EQ( region.iData[ i ], static_cast< int >( i ) + 1 );
+    }
+    ring.CommitRead( region );
+    EXPECT_TRUE( ring.IsEmpty( ) );
+}
+
+TEST( MpmcRingTest, ProducersConsumers )
+{
+    constexpr int kThreads = 3;
+    constexpr std::uint32_t kCountPerProducer = 3000;
+    TMpmcRing< std::uint32_t, 64 > ring;
+    std::atomic< std::uint64_t > sum{ 0 };
+    std::atomic< std::uint32_t > consumed{ 0 };
+
+    std::vector< std::thread > threads;
+    for ( int thread = 0; thread < kThreads; ++thread )
+    {
+        threads.emplace_back( [ &ring ]( ) {
+            for ( std::uint32_t value = 1; value <= kCountPerProducer; )
+            {
+                if ( !ring.Push( value ) )
+                {
+                    // Lets the consumers run on a single CPU.
+                    std::this_thread::yield( );
+                    continue;
+                }
+                ++value;
+            }
+        } );
+        threads.emplace_back( [ &ring, &sum, &consumed ]( ) {
+            std::uint32_t values[ 8 ];
+            while ( consumed.load( ) < kThreads * kCountPerProducer )
+            {
+                const size_t count = ring.Pop( values, 8 );
+                if ( count == 0 )
+                {
+                    std::this_thread::yield( );
+                    continue;
+                }
+                for ( size_t i = 0; i < count; ++i )
+                {
+                    sum += values[ i ];
+                }
+                consumed += static_cast< std::uint32_t >( count );
+            }
+        } );
+    }
+    for ( auto& thread : threads )
+    {
+        thread.join( );
+    }
+
+    const std::uint64_t kExpected
+        = kThreads * std::uint64_t{ kCountPerProducer } * ( kCountPerProducer + 1 ) / 2;
+    EXPECT_EQ( sum.load( ), kExpected );
+    EXPECT_TRUE( ring.IsEmpty( ) );
+}
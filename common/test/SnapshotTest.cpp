@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/Snapshot.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+// Every field holds the same counter, so a torn copy is detected.
+template < size_t taFieldCount >
+struct TReading
+{
+    std::uint32_t iFields[ taFieldCount ];
+};
+
+template < size_t taFieldCount >
+TReading< taFieldCount >
+MakeReading( std::uint32_t aCounter )
+{
+    TReading< taFieldCount > reading;
+    for ( auto& field : reading.iFields )
+    {
+        field = aCounter;
+    }
+    return reading;
+}
+
+template < typename taSnapshot, size_t taFieldCount >
+void
+CheckConcurrentReaders( )
+{
+    constexpr std::uint32_t kWrites = 200000;
+    constexpr size_t kReaders = 3;
+
+    taSnapshot snapshot;
+    std::atomic< bool > done{ false };
+    std::atomic< size_t > started{ 0 };
+    std::vector< std::thread > readers;
+    std::atomic< size_t > torn{ 0 };
+    std::atomic< size_t > reordered{ 0 };
+    for ( size_t reader = 0; reader < kReaders; ++reader )
+    {
+        readers.emplace_back( [ & ]( ) {
+            std::uint32_t previous = 0;
+            ++started;
+            while ( !done.load( std::memory_order_acquire ) )
+            {
+                const auto reading = snapshot.Read( );
+                for ( const auto field : reading.iFields )
+                {
+                    torn += field != reading.iFields[ 0 ];
+                }
+                reordered += reading.iFields[ 0 ] < previous;
+                previous = reading.iFields[ 0 ];
+            }
+        } );
+    }
+
+    while ( started.load( ) != kReaders )
+    {
+        std::this_thread::yield( );
+    }
+    for ( std::uint32_t counter = 1; counter <= kWrites; ++counter )
+    {
+        snapshot.Write( MakeReading< taFieldCount >( counter ) );
+    }
+    done.store( true, std::memory_order_release );
+    for ( auto& reader : readers )
+    {
+        reader.join( );
+    }
+
+    EXPECT_EQ( torn, 0u );
+    EXPECT_EQ( reordered, 0u );
+    EXPECT_EQ( snapshot.Read( ).iFields[ taFieldCount - 1 ], kWrites );
+}
+}  // namespace
+
+TEST( SnapshotTest, LatestValue )
+{
+    TSnapshot< TReading< 3 > > snapshot{ MakeReading< 3 >( 7 ) };
+    EXPECT_EQ( snapshot.Version( ), 0u );
+    EXPECT_EQ( snapshot.Read( ).iFields[ 2 ], 7u );
+
+    snapshot.Write( MakeReading< 3 >( 8 ) );
+    snapshot.Write( MakeReading< 3 >( 9 ) );
+    EXPECT_EQ( snapshot.Version( ), 2u );
+
+    TReading< 3 > reading;
+    ASSERT_TRUE( snapshot.TryRead( reading ) );
+    EXPECT_EQ( reading.iFields[ 0 ], 9u );
+}
+
+TEST( SnapshotTest, DoubleBufferedLatestValue )
+{
+    TDoubleBufferedSnapshot< TReading< 3 > > snapshot{ MakeReading< 3 >( 7 ) };
+    EXPECT_EQ( snapshot.Read( ).iFields[ 1 ], 7u );
+
+    snapshot.Write( MakeReading< 3 >( 8 ) );
+    EXPECT_EQ( snapshot.Version( ), 1u );
+    EXPECT_EQ( snapshot.Read( ).iFields[ 1 ], 8u );
+    snapshot.Write( MakeReading< 3 >( 9 ) );
+    EXPECT_EQ( snapshot.Version( ), 2u );
+    EXPECT_EQ( snapshot.Read( ).iFields[ 1 ], 9u );
+}
+
+TEST( SnapshotTest, ConcurrentReadersSeeConsistentValues )
+{
+    CheckConcurrentReaders< TSnapshot< TReading< 5 > >, 5 >( );
+}
+
+TEST( SnapshotTest, DoubleBufferedConcurrentReadersSeeConsistentValues )
+{
+    CheckConcurrentReaders< TDoubleBufferedSnapshot< TReading< 256 > >, 256 >( );
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/TypeBinaryRepresentation.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+enum class TColour : std::uint16_t
+{
+    Red = 0x0102
+};
+
+static_assert( ByteSwap( std::uint16_t{ 0x0102 } ) == 0x0201 );
+static_assert( ByteSwap( std::uint32_t{ 0x01020304 } ) == 0x04030201 );
+static_assert( ByteSwap( std::uint64_t{ 0x0102030405060708 } ) == 0x0807060504030201 );
+static_assert( ByteSwap( std::int16_t{ -2 } ) == std::int16_t( 0xFEFF ) );
+static_assert( ByteSwap( std::uint8_t{ 0xAB } ) == 0xAB );
+static_assert( ByteSwap( TColour::Red ) == TColour( 0x0201 ) );
+static_assert( EndiannessConverter< Endianness::Big, Endianness::Little >::Convert(
+                   std::uint32_t{ 0x01020304 } )
+               == 0x04030201 );
+
+template < typename T >
+struct ByteSwapNTest : public testing::Test
+{
+};
+
+using TSwapTypes = testing::Types< std::uint16_t, std::int32_t, std::uint64_t, float, double >;
+TYPED_TEST_SUITE( ByteSwapNTest, TSwapTypes );
+}  // namespace
+
+TEST( ByteSwapTest, Float )
+{
+    const float kValue = 1.5f;
+    const float swapped = ByteSwap( kValue );
+
+    std::uint8_t valueBytes[ sizeof( float ) ];
+    std::uint8_t swappedBytes[ sizeof( float ) ];
+    std::memcpy( valueBytes, &kValue, sizeof( float ) );
+    std::memcpy( swappedBytes, &swapped, sizeof( float ) );
+    for ( size_t i = 0; i < sizeof( float ); ++i )
+    {
+        EXPECT_EQ( valueBytes[ i ], swappedBytes[ sizeof( float ) - 1 - i ] );
+    }
+    EXPECT_EQ( ByteSwap( swapped ), kValue );
+}
+
+TYPED_TEST( ByteSwapNTest, MatchesScalarSwap )
+{
+    // Odd counts and starts one element past the vector alignment exercise the SIMD blocks
+    // from an unaligned address and the scalar tail
+    for ( size_t count : { 0u, 1u, 7u, 16u, 33u, 257u } )
+    {
+        std::vector< std::uint8_t > storage( ( count + 1 ) * sizeof( TypeParam ) );
+        for ( size_t i = 0; i < storage.size( ); ++i )
+        {
+            storage[ i ] = static_cast< std::uint8_t >( i * 7 + 1 );
+        }
+        std::vector< TypeParam > sourceStorage( count + 1 );
+        std::memcpy( sourceStorage.data( ), storage.data( ), storage.size( ) );
+        const TypeParam* const source = sourceStorage.data( ) + 1;
+
+        std::vector< TypeParam > destination( count );
+        EndiannessConverter< Endianness::Big, Endianness::Little >::ConvertN(
+            source, destination.data( ), count );
+        for ( size_t i = 0; i < count; ++i )
+        {
+            const TypeParam expected = ByteSwap( source[ i ] );
+            EXPECT_EQ( std::memcmp( &destination[ i ], &expected, sizeof( TypeParam ) ), 0 );
+        }
+
+        EndiannessConverter< Endianness::Little, Endianness::Big >::ConvertInPlace(
+            destination.data( ), count );
+        EXPECT_EQ( std::memcmp( destination.data( ), source, count * sizeof( TypeParam ) ), 0 );
+    }
+}
+
+TEST( EndiannessConverterTest, IdentityBulk )
+{
+    const std::uint32_t kSource[] = { 1, 2, 3 };
+    std::uint32_t destination[ 3 ] = { };
+    EndiannessConverter< Endianness::Big, Endianness::Big >::ConvertN( kSource, destination, 3 );
+    EXPECT_EQ( destination[ 2 ], 3u );
+    EndiannessConverter<>::ConvertInPlace( destination, 3 );
+    EXPECT_EQ( destination[ 0 ], 1u );
+}
+
+namespace
+{
+static_assert( TBigEndian< std::uint32_t >{ 0x01020304 }.Bytes( )[ 0 ] == 0x01 );
+static_assert( TLittleEndian< std::uint32_t >{ 0x01020304 }.Bytes( )[ 0 ] == 0x04 );
+static_assert( TBigEndian< std::int16_t >{ -2 }.Get( ) == -2 );
+
+struct TBatteryStatus
+{
+    TBigEndian< std::uint16_t > iVoltage;
+    TLittleEndian< std::int16_t > iCurrent;
+    std::uint8_t iFlags;
+    TBigEndian< std::uint32_t > iUptime;
+};
+static_assert( sizeof( TBatteryStatus ) == 9 );
+static_assert( alignof( TBatteryStatus ) == 1 );
+static_assert( std::is_trivially_copyable< TBatteryStatus >::value );
+}  // namespace
+
+TEST( WireIntegerTest, MixedEndianStruct )
+{
+    const std::uint8_t kWire[] = { 0x0F, 0xA0, 0x18, 0xFC, 0x81, 0x00, 0x01, 0x00, 0x02 };
+    TBatteryStatus status;
+    std::memcpy( &status, kWire, sizeof( status ) );
+
+    EXPECT_EQ( status.iVoltage, 4000 );
+    EXPECT_EQ( status.iCurrent, -1000 );
+    EXPECT_EQ( status.iFlags, 0x81 );
+    EXPECT_EQ( status.iUptime, 65538u );
+
+    status.iCurrent = 1000;
+    std::uint8_t wire[ sizeof( status ) ];
+    std::memcpy( wire, &status, sizeof( status ) );
+    EXPECT_EQ( wire[ 2 ], 0xE8 );
+    EXPECT_EQ( wire[ 3 ], 0x03 );
+}
+
+TEST( WireIntegerTest, NativeEndianness )
+{
+    const std::uint32_t kValue = 0x01020304;
+    std::uint8_t bytes[ sizeof( kValue ) ];
+    std::memcpy( bytes, &kValue, sizeof( kValue ) );
+    EXPECT_EQ( bytes[ 0 ], Endianness::Native == Endianness::Little ? 0x04 : 0x01 );
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/common/WorkStealingPool.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+std::uint64_t
+Fibonacci( CWorkStealingPool& aPool, unsigned aIndex )
+{
+    if ( aIndex < 12 )
+    {
+        return aIndex < 2 ? aIndex
+                          : Fibonacci( aPool, aIndex - 1 ) + Fibonacci( aPool, aIndex - 2 );
+    }
+    std::uint64_t left = 0;
+    auto task = MakeTask( [ &aPool, &left, aIndex ]( ) { left = Fibonacci( aPool, aIndex - 1 ); } );
+    CTaskGroup group{ aPool };
+    group.Run( task );
+    const std::uint64_t right = Fibonacci( aPool, aIndex - 2 );
+    group.Wait( );
+    return left + right;
+}
+}  // namespace
+
+TEST( WorkStealingPoolTest, ParallelForCoversRangeOnce )
+{
+    CWorkStealingPool pool{ TWorkStealingPoolConfig{ 4 } };
+    EXPECT_EQ( pool.WorkerCount( ), 4u );
+
+    constexpr size_t kCount = 100000;
+    std::vector< std::uint8_t > visits( kCount, 0 );
+    std::atomic< size_t > chunks{ 0 };
+    pool.ParallelFor( 0, kCount, [ &visits, &chunks ]( size_t aBegin, size_t aEnd ) {
+        ++chunks;
+        for ( size_t index = aBegin; index < aEnd; ++index )
+        {
+            ++visits[ index ];
+        }
+    } );
+
+    for ( size_t index = 0; index < kCount; ++index )
+    {
+        ASSERT_EQ( visits[ index ], 1 ) << index;
+    }
+    EXPECT_GT( chunks.load( ), 1u );
+}
+
+TEST( WorkStealingPoolTest, ParallelForHonoursGrain )
+{
+    CWorkStealingPool pool{ TWorkStealingPoolConfig{ 2 } };
+    std::atomic< size_t > minimal{ ~size_t{ 0 } };
+    std::atomic< size_t > total{ 0 };
+    pool.ParallelFor(
+        10,
+        1010,
+        [ &minimal, &total ]( size_t aBegin, size_t aEnd ) {
+            total += aEnd - aBegin;
+            size_t current = minimal.load( );
+            while ( aEnd - aBegin < current
+                    && !minimal.compare_exchange_weak( current, aEnd - aBegin ) )
+            {
+            }
+        },
+        100 );
+    EXPECT_EQ( total.load( ), 1000u );
+    EXPECT_GE( minimal.load( ), 50u );
+
+    pool.ParallelFor( 5, 5, []( size_t, size_t ) { FAIL( ); } );
+}
+
+TEST( WorkStealingPoolTest, NestedTaskGroups )
+{
+    CWorkStealingPool pool{ TWorkStealingPoolConfig{ 3 } };
+    EXPECT_EQ( Fibonacci( pool, 25 ), 75025u );
+}
+
+TEST( WorkStealingPoolTest, TasksFromSeveralExternalThreads )
+{
+    CWorkStealingPool pool{ TWorkStealingPoolConfig{ 2, true } };
+    std::atomic< int > executed{ 0 };
+
+    std::vector< std::thread > threads;
+    for ( int thread = 0; thread < 3; ++thread )
+    {
+        threads.emplace_back( [ &pool, &executed ]( ) {
+            for ( int round = 0; round < 100; ++round )
+            {
+                auto first = MakeTask( [ &executed ]( ) { ++executed; } );
+                auto second = MakeTask( [ &executed ]( ) { ++executed; } );
+                CTaskGroup group{ pool };
+                group.Run( first );
+                group.Run( second );
+                group.Wait( );
+            }
+        } );
+    }
+    for ( auto& thread : threads )
+    {
+        thread.join( );
+    }
+    EXPECT_EQ( executed.load( ), 600 );
+}
+
+TEST( ChaseLevDequeTest, OwnerIsLifoThievesAreFifo )
+{
+    Detail::TChaseLevDeque< int, 4 > deque;
+    int values[] = { 1, 2, 3, 4, 5 };
+    for ( int i = 0; i < 4; ++i )
+    {
+        EXPECT_TRUE( deque.Push( &values[ i ] ) );
+    }
+    EXPECT_FALSE( deque.Push( &values[ 4 ] ) );
+
+    EXPECT_EQ( deque.Steal( ), &values[ 0 ] );
+    EXPECT_EQ( deque.Pop( ), &values[ 3 ] );
+    EXPECT_EQ( deque.Size( ), 2u );
+    EXPECT_EQ( deque.Steal( ), &values[ 1 ] );
+    EXPECT_EQ( deque.Pop( ), &values[ 2 ] );
+    EXPECT_EQ( deque.Pop( ), nullptr );
+    EXPECT_EQ( deque.Steal( ), nullptr );
+}
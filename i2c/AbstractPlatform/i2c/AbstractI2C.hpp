@@ -1,15 +1,41 @@
 #pragma once
 
 #include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Crc.hpp>
 #include <AbstractPlatform/common/PlatformLiteral.hpp>
 #include <AbstractPlatform/common/Memory.hpp>
 #include <AbstractPlatform/common/ErrorCode.hpp>
+#include <AbstractPlatform/common/Profiling.hpp>
+#include <AbstractPlatform/common/Result.hpp>
+#include <AbstractPlatform/i2c/RegisterBlock.hpp>
+#include <AbstractPlatform/i2c/RegisterMap.hpp>
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 
 namespace AbstractPlatform
 {
+/// @brief The direction of the I2C transfer.
+enum class TI2CDirection : std::uint8_t
+{
+    Write,
+    Read
+};
+
+/// @brief The state of the transaction executed by the bus front ends (e.g. CI2CScheduler).
+enum class TI2CTransactionState : std::uint8_t
+{
+    Idle,
+    Pending,
+    InProgress,
+    Done,
+    Failed
+};
+
+/// @brief The maximum length of the data transferred with the packet error code.
+static constexpr size_t KSmbusMaxBlockLength = 32;
+
 /// @brief I2C bus interface
 class IAbstractI2CBus
 {
@@ -84,7 +110,10 @@ struct CI2CBus
            size_t aDataLength,
            bool aNoStop ) NOEXCEPT
     {
-        return iI2CBus.Write( aDeviceAddress, aDataSource, aDataLength, aNoStop );
+        PROFILE_SCOPE( "i2c.write" );
+        const int result = iI2CBus.Write( aDeviceAddress, aDataSource, aDataLength, aNoStop );
+        PROFILE_COUNT( "i2c.write_bytes", result > 0 ? result : 0 );
+        return result;
     }
 
     /**
@@ -104,54 +133,135 @@ struct CI2CBus
           size_t aDataLength,
           bool aNoStop ) NOEXCEPT
     {
-        return iI2CBus.Read( aDeviceAddress, aDataDestination, aDataLength, aNoStop );
+        PROFILE_SCOPE( "i2c.read" );
+        const int result = iI2CBus.Read( aDeviceAddress, aDataDestination, aDataLength, aNoStop );
+        PROFILE_COUNT( "i2c.read_bytes", result > 0 ? result : 0 );
+        return result;
     }
 
     /**
-     * @brief Reads the register from the previously used register address
+     * @brief Writes exactly aDataLength bytes to the device.
      *
-     * @tparam taTRegister The type of the register receiving variable.
      * @param aDeviceAddress 7-bit address of device to write to.
-     * @param aRegisterValue The register receiving variable.
+     * @param aDataSource Pointer to data to send.
+     * @param aDataLength Length of data in bytes to send.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return The error reported by the bus, or KIncompleteTransferError if fewer bytes than
+     * requested were written.
+     */
+    inline TResult< void >
+    WriteExact( std::uint8_t aDeviceAddress,
+                const std::uint8_t* aDataSource,
+                size_t aDataLength,
+                bool aNoStop = false ) NOEXCEPT
+    {
+        return TransferResult( Write( aDeviceAddress, aDataSource, aDataLength, aNoStop ),
+                               aDataLength );
+    }
+
+    /**
+     * @brief Reads exactly aDataLength bytes from the device.
+     *
+     * @param aDeviceAddress 7-bit address of device to read from.
+     * @param aDataDestination Pointer to buffer to receive data.
+     * @param aDataLength Length of data in bytes to receive.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return The error reported by the bus, or KIncompleteTransferError if fewer bytes than
+     * requested were read.
+     */
+    inline TResult< void >
+    ReadExact( std::uint8_t aDeviceAddress,
+               std::uint8_t* aDataDestination,
+               size_t aDataLength,
+               bool aNoStop = false ) NOEXCEPT
+    {
+        return TransferResult( Read( aDeviceAddress, aDataDestination, aDataLength, aNoStop ),
+                               aDataLength );
+    }
+
+    /**
+     * @brief Reads the register from the previously used register address
+     *
+     * @tparam taTRegister The type of the register value.
+     * @param aDeviceAddress 7-bit address of device to read from.
      * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
      * is issued), and the next transfer will begin with a Restart rather than a Start.
-     * @return true If operation succeed, otherwise - false
+     * @return The raw register value or the transfer error.
      */
     template < typename taTRegister >
-    inline bool
-    ReadLastRegisterRaw( std::uint8_t aDeviceAddress,
-                         taTRegister& aRegisterValue,
-                         bool aNoStop = false ) NOEXCEPT
+    inline TResult< taTRegister >
+    ReadLastRegisterRaw( std::uint8_t aDeviceAddress, bool aNoStop = false ) NOEXCEPT
     {
-        return iI2CBus.Read( aDeviceAddress, reinterpret_cast< std::uint8_t* >( &aRegisterValue ),
-                             sizeof( aRegisterValue ), aNoStop )
-               != sizeof( aRegisterValue );
+        taTRegister registerValue{ };
+        RETURN_IF_FAILED( ReadExact( aDeviceAddress,
+                                     reinterpret_cast< std::uint8_t* >( &registerValue ),
+                                     sizeof( registerValue ), aNoStop ) );
+        return registerValue;
     }
 
     /**
      * @brief Reads the register from the I2C device.
      *
+     * @tparam taTRegister The type of the register value.
      * @tparam taTRegisterAddress The type of the register address value.
-     * @tparam taTRegister The type of the register receiving variable.
-     * @param aDeviceAddress 7-bit address of device to write to.
+     * @param aDeviceAddress 7-bit address of device to read from.
      * @param aRegisterAddress The register address.
-     * @param aRegisterValue The register receiving variable.
      * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
      * is issued), and the next transfer will begin with a Restart rather than a Start.
-     * @return true If operation succeed, otherwise - false
+     * @return The raw register value or the transfer error.
      */
-    template < typename taTRegisterAddress, typename taTRegister >
-    bool
+    template < typename taTRegister, typename taTRegisterAddress >
+    TResult< taTRegister >
     ReadRegisterRaw( std::uint8_t aDeviceAddress,
                      taTRegisterAddress aRegisterAddress,
-                     taTRegister& aRegisterValue,
                      bool aNoStop = false ) NOEXCEPT
     {
-        return ( iI2CBus.Write( aDeviceAddress, &aRegisterAddress, sizeof( aRegisterAddress ),
-                                true )
-                 == sizeof( aRegisterAddress ) )
-               && ( ReadLastRegisterRaw( aDeviceAddress, aRegisterValue, aNoStop )
-                    != sizeof( aRegisterValue ) );
+        std::uint8_t addressPack[ sizeof( aRegisterAddress ) ];
+        ScalarTypeCopy( addressPack, aRegisterAddress );
+
+        RETURN_IF_FAILED( WriteExact( aDeviceAddress, addressPack, sizeof( addressPack ), true ) );
+        return ReadLastRegisterRaw< taTRegister >( aDeviceAddress, aNoStop );
+    }
+
+    /**
+     * @brief Reads a contiguous block of registers in a single transfer and decodes it into the
+     * block structure.
+     *
+     * The register address is written once and then taRegisterBlock::kSize bytes are read back,
+     * relying on the device's register address auto-increment. Devices that require an
+     * auto-increment flag in the register address expect the flag to be set in
+     * aFirstRegisterAddress.
+     *
+     * @tparam taRegisterBlock The TRegisterBlock describing the block layout.
+     * @tparam taTRegisterAddress The type of the register address value.
+     * @param aDeviceAddress 7-bit address of device to read from.
+     * @param aFirstRegisterAddress The address of the first register of the block.
+     * @param aBlock The structure receiving the decoded block.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return The transfer error on failure. On failure aBlock is left untouched.
+     */
+    template < typename taRegisterBlock, typename taTRegisterAddress >
+    TResult< void >
+    ReadRegisterBlock( std::uint8_t aDeviceAddress,
+                       taTRegisterAddress aFirstRegisterAddress,
+                       typename taRegisterBlock::TStruct& aBlock,
+                       bool aNoStop = false ) NOEXCEPT
+    {
+        std::uint8_t addressPack[ sizeof( aFirstRegisterAddress ) ];
+        ScalarTypeCopy( addressPack, aFirstRegisterAddress );
+
+        // The wire bytes cannot be received into aBlock itself: the structure padding and the
+        // field byte orders generally differ from the wire layout. The block is staged here and
+        // decoded field by field, which costs one copy of the block that the transfer dominates.
+        std::uint8_t wire[ taRegisterBlock::kSize ];
+        RETURN_IF_FAILED( WriteExact( aDeviceAddress, addressPack, sizeof( addressPack ), true ) );
+        RETURN_IF_FAILED( ReadExact( aDeviceAddress, wire, sizeof( wire ), aNoStop ) );
+
+        taRegisterBlock::Decode( wire, aBlock );
+        return { };
     }
 
     /**
@@ -164,10 +274,10 @@ struct CI2CBus
      * @param aRegisterValue The register source variable.
      * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
      * is issued), and the next transfer will begin with a Restart rather than a Start.
-     * @return true If operation succeed, otherwise - false
+     * @return The transfer error on failure.
      */
     template < typename taTRegisterAddress, typename taTRegister >
-    bool
+    TResult< void >
     WriteRegisterRaw( std::uint8_t aDeviceAddress,
                       taTRegisterAddress aRegisterAddress,
                       taTRegister aRegisterValue,
@@ -177,8 +287,377 @@ struct CI2CBus
         ScalarTypeCopy( dataPack, aRegisterAddress );
         ScalarTypeCopy( dataPack + sizeof( aRegisterAddress ), aRegisterValue );
 
-        return iI2CBus.Write( aDeviceAddress, dataPack, sizeof( dataPack ), aNoStop )
-               != sizeof( dataPack );
+        return WriteExact( aDeviceAddress, dataPack, sizeof( dataPack ), aNoStop );
+    }
+
+    /**
+     * @brief Reads the register declared with the TRegister.
+     *
+     * @tparam taRegister The TRegister to read.
+     * @param aDeviceAddress 7-bit address of device to read from.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return The native register value or the transfer error.
+     */
+    template < typename taRegister >
+    TResult< typename taRegister::TValue >
+    ReadRegister( std::uint8_t aDeviceAddress, bool aNoStop = false ) NOEXCEPT
+    {
+        static_assert( taRegister::IsReadable( ), "The register is write-only" );
+
+        return ReadRegisterRaw< typename taRegister::TValue >(
+                   aDeviceAddress, taRegister::WireAddress( ), aNoStop )
+            .Transform( []( typename taRegister::TValue aWireValue ) {
+                return taRegister::FromWire( aWireValue );
+            } );
+    }
+
+    /**
+     * @brief Reads the register field declared with the TRegisterField.
+     *
+     * @tparam taField The TRegisterField to read.
+     * @param aDeviceAddress 7-bit address of device to read from.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return The field value or the transfer error.
+     */
+    template < typename taField >
+    TResult< typename taField::TFieldValue >
+    ReadField( std::uint8_t aDeviceAddress, bool aNoStop = false ) NOEXCEPT
+    {
+        return ReadRegister< typename taField::TRegister >( aDeviceAddress, aNoStop )
+            .Transform( []( typename taField::TValue aRegisterValue ) {
+                return taField::Get( aRegisterValue );
+            } );
+    }
+
+    /**
+     * @brief Writes the register declared with the TRegister.
+     *
+     * @tparam taRegister The TRegister to write.
+     * @param aDeviceAddress 7-bit address of device to write to.
+     * @param aRegisterValue The native register value.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return The transfer error on failure.
+     */
+    template < typename taRegister >
+    TResult< void >
+    WriteRegister( std::uint8_t aDeviceAddress,
+                   typename taRegister::TValue aRegisterValue,
+                   bool aNoStop = false ) NOEXCEPT
+    {
+        static_assert( taRegister::IsWritable( ), "The register is read-only" );
+
+        return WriteRegisterRaw( aDeviceAddress, taRegister::WireAddress( ),
+                                 taRegister::ToWire( aRegisterValue ), aNoStop );
+    }
+
+    /**
+     * @brief Applies the accumulated field updates to the register with a single bus write.
+     *
+     * The current register value is read back first unless the update defines every register
+     * bit. A write-only register can only be updated completely here; its partial updates need
+     * the shadow value overload.
+     *
+     * @tparam taRegister The TRegister to update.
+     * @param aDeviceAddress 7-bit address of device to write to.
+     * @param aUpdate The accumulated field updates.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return KInvalidArgumentError for the partial update of a write-only register, otherwise
+     * the transfer error on failure.
+     */
+    template < typename taRegister >
+    TResult< void >
+    UpdateRegister( std::uint8_t aDeviceAddress,
+                    const TRegisterUpdate< taRegister >& aUpdate,
+                    bool aNoStop = false ) NOEXCEPT
+    {
+        typename taRegister::TValue registerValue = 0;
+        if ( !aUpdate.IsComplete( ) )
+        {
+            if constexpr ( taRegister::IsReadable( ) )
+            {
+                const auto current = ReadRegister< taRegister >( aDeviceAddress );
+                RETURN_IF_FAILED( current );
+                registerValue = current.Value( );
+            }
+            else
+            {
+                // The partial update of a write-only register requires the shadow value overload.
+                return Failure( KInvalidArgumentError );
+            }
+        }
+
+        return WriteRegister< taRegister >( aDeviceAddress, aUpdate.Apply( registerValue ),
+                                            aNoStop );
+    }
+
+    /**
+     * @brief Applies the accumulated field updates to the register using the caller-maintained
+     * shadow copy of the register value instead of reading it back from the device.
+     *
+     * The bus write is skipped if the update does not change the shadow value.
+     *
+     * @tparam taRegister The TRegister to update.
+     * @param aDeviceAddress 7-bit address of device to write to.
+     * @param aUpdate The accumulated field updates.
+     * @param aShadowValue The last value written to the register. Updated on success.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return The transfer error on failure.
+     */
+    template < typename taRegister >
+    TResult< void >
+    UpdateRegister( std::uint8_t aDeviceAddress,
+                    const TRegisterUpdate< taRegister >& aUpdate,
+                    typename taRegister::TValue& aShadowValue,
+                    bool aNoStop = false ) NOEXCEPT
+    {
+        const auto registerValue = aUpdate.Apply( aShadowValue );
+        if ( registerValue == aShadowValue )
+        {
+            return { };
+        }
+
+        RETURN_IF_FAILED( WriteRegister< taRegister >( aDeviceAddress, registerValue, aNoStop ) );
+        aShadowValue = registerValue;
+        return { };
+    }
+
+    /**
+     * @brief Writes the command followed by the data and the SMBus packet error code (PEC).
+     *
+     * The data is sent as is, without the byte count of the SMBus Block Write, as in the SMBus
+     * Write Byte/Word protocols. The PEC covers the device address with the write bit, the command
+     * and the data.
+     *
+     * @param aDeviceAddress 7-bit address of device to write to.
+     * @param aCommand The command (the register address).
+     * @param aDataSource The data to write.
+     * @param aDataLength The data length, up to KSmbusMaxBlockLength.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return KInvalidArgumentError if the data is too long, otherwise the transfer error on
+     * failure.
+     */
+    TResult< void >
+    WriteDataWithPec( std::uint8_t aDeviceAddress,
+                      std::uint8_t aCommand,
+                      const std::uint8_t* aDataSource,
+                      size_t aDataLength,
+                      bool aNoStop = false ) NOEXCEPT
+    {
+        if ( aDataLength > KSmbusMaxBlockLength )
+        {
+            return Failure( KInvalidArgumentError );
+        }
+
+        std::uint8_t packet[ 1 + KSmbusMaxBlockLength + 1 ];
+        packet[ 0 ] = aCommand;
+        std::memcpy( packet + 1, aDataSource, aDataLength );
+
+        const std::uint8_t addressByte = static_cast< std::uint8_t >( aDeviceAddress << 1 );
+        auto pec = TCrc8Smbus::Update( TCrc8Smbus::Initial( ), &addressByte, 1 );
+        pec = TCrc8Smbus::Update( pec, packet, 1 + aDataLength );
+        packet[ 1 + aDataLength ] = TCrc8Smbus::Finalize( pec );
+
+        return WriteExact( aDeviceAddress, packet, aDataLength + 2, aNoStop );
+    }
+
+    /**
+     * @brief Writes the command, then reads the data followed by the SMBus packet error code
+     * (PEC) and verifies it.
+     *
+     * The data of the known length is read as is, without the byte count of the SMBus Block Read,
+     * as in the SMBus Read Byte/Word protocols. The PEC covers the device address with the write
+     * bit, the command, the device address with the read bit and the data.
+     *
+     * @param aDeviceAddress 7-bit address of device to read from.
+     * @param aCommand The command (the register address).
+     * @param aDataDestination The buffer receiving the data.
+     * @param aDataLength The data length, up to KSmbusMaxBlockLength.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return KInvalidArgumentError if the data is too long, KChecksumError if the PEC does not
+     * match, otherwise the transfer error on failure. On failure aDataDestination is left
+     * untouched.
+     */
+    TResult< void >
+    ReadDataWithPec( std::uint8_t aDeviceAddress,
+                     std::uint8_t aCommand,
+                     std::uint8_t* aDataDestination,
+                     size_t aDataLength,
+                     bool aNoStop = false ) NOEXCEPT
+    {
+        if ( aDataLength > KSmbusMaxBlockLength )
+        {
+            return Failure( KInvalidArgumentError );
+        }
+
+        std::uint8_t packet[ KSmbusMaxBlockLength + 1 ];
+        RETURN_IF_FAILED( WriteExact( aDeviceAddress, &aCommand, 1, true ) );
+        RETURN_IF_FAILED( ReadExact( aDeviceAddress, packet, aDataLength + 1, aNoStop ) );
+
+        const std::uint8_t addressByte = static_cast< std::uint8_t >( aDeviceAddress << 1 );
+        const std::uint8_t header[] = { addressByte, aCommand,
+                                        static_cast< std::uint8_t >( addressByte | 1 ) };
+        auto pec = TCrc8Smbus::Update( TCrc8Smbus::Initial( ), header, sizeof( header ) );
+        pec = TCrc8Smbus::Update( pec, packet, aDataLength );
+        if ( TCrc8Smbus::Finalize( pec ) != packet[ aDataLength ] )
+        {
+            return Failure( KChecksumError );
+        }
+
+        std::memcpy( aDataDestination, packet, aDataLength );
+        return { };
+    }
+
+    /**
+     * @brief Writes the SMBus Block Write: the command, the byte count, the data and the packet
+     * error code (PEC).
+     *
+     * The PEC covers the device address with the write bit, the command, the byte count and the
+     * data.
+     *
+     * @param aDeviceAddress 7-bit address of device to write to.
+     * @param aCommand The command (the register address).
+     * @param aDataSource The block data.
+     * @param aDataLength The block length, up to KSmbusMaxBlockLength.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return KInvalidArgumentError if the block is too long, otherwise the transfer error on
+     * failure.
+     */
+    TResult< void >
+    WriteBlockWithPec( std::uint8_t aDeviceAddress,
+                       std::uint8_t aCommand,
+                       const std::uint8_t* aDataSource,
+                       size_t aDataLength,
+                       bool aNoStop = false ) NOEXCEPT
+    {
+        if ( aDataLength > KSmbusMaxBlockLength )
+        {
+            return Failure( KInvalidArgumentError );
+        }
+
+        std::uint8_t packet[ 2 + KSmbusMaxBlockLength + 1 ];
+        packet[ 0 ] = aCommand;
+        packet[ 1 ] = static_cast< std::uint8_t >( aDataLength );
+        std::memcpy( packet + 2, aDataSource, aDataLength );
+
+        const std::uint8_t addressByte = static_cast< std::uint8_t >( aDeviceAddress << 1 );
+        auto pec = TCrc8Smbus::Update( TCrc8Smbus::Initial( ), &addressByte, 1 );
+        pec = TCrc8Smbus::Update( pec, packet, 2 + aDataLength );
+        packet[ 2 + aDataLength ] = TCrc8Smbus::Finalize( pec );
+
+        return WriteExact( aDeviceAddress, packet, aDataLength + 3, aNoStop );
+    }
+
+    /**
+     * @brief Reads the SMBus Block Read: writes the command, then reads the byte count, the data
+     * and the packet error code (PEC) and verifies them.
+     *
+     * IAbstractI2CBus::Read() transfers a fixed length, so the block length has to be known in
+     * advance: the count byte the device sends has to match aDataLength. The PEC covers the device
+     * address with the write bit, the command, the device address with the read bit, the byte
+     * count and the data.
+     *
+     * @param aDeviceAddress 7-bit address of device to read from.
+     * @param aCommand The command (the register address).
+     * @param aDataDestination The buffer receiving the block data.
+     * @param aDataLength The expected block length, up to KSmbusMaxBlockLength.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return KInvalidArgumentError if the block is too long, KChecksumError if the PEC does not
+     * match, KGenericError if the device reports another block length, otherwise the transfer
+     * error on failure. On failure aDataDestination is left untouched.
+     */
+    TResult< void >
+    ReadBlockWithPec( std::uint8_t aDeviceAddress,
+                      std::uint8_t aCommand,
+                      std::uint8_t* aDataDestination,
+                      size_t aDataLength,
+                      bool aNoStop = false ) NOEXCEPT
+    {
+        if ( aDataLength > KSmbusMaxBlockLength )
+        {
+            return Failure( KInvalidArgumentError );
+        }
+
+        std::uint8_t packet[ 1 + KSmbusMaxBlockLength + 1 ];
+        RETURN_IF_FAILED( WriteExact( aDeviceAddress, &aCommand, 1, true ) );
+        RETURN_IF_FAILED( ReadExact( aDeviceAddress, packet, aDataLength + 2, aNoStop ) );
+
+        const std::uint8_t addressByte = static_cast< std::uint8_t >( aDeviceAddress << 1 );
+        const std::uint8_t header[] = { addressByte, aCommand,
+                                        static_cast< std::uint8_t >( addressByte | 1 ) };
+        auto pec = TCrc8Smbus::Update( TCrc8Smbus::Initial( ), header, sizeof( header ) );
+        pec = TCrc8Smbus::Update( pec, packet, 1 + aDataLength );
+        if ( TCrc8Smbus::Finalize( pec ) != packet[ 1 + aDataLength ] )
+        {
+            return Failure( KChecksumError );
+        }
+        if ( packet[ 0 ] != aDataLength )
+        {
+            return Failure( KGenericError );
+        }
+
+        std::memcpy( aDataDestination, packet + 1, aDataLength );
+        return { };
+    }
+
+    /**
+     * @brief Reads a contiguous block of registers followed by the SMBus packet error code (PEC),
+     * verifies it and decodes the block into the block structure.
+     *
+     * The block is read with ReadDataWithPec(), so the device appends the PEC to the
+     * auto-incremented register range as to the SMBus Read Byte/Word data.
+     *
+     * @tparam taRegisterBlock The TRegisterBlock describing the block layout.
+     * @param aDeviceAddress 7-bit address of device to read from.
+     * @param aCommand The address of the first register of the block.
+     * @param aBlock The structure receiving the decoded block.
+     * @param aNoStop If true, master retains control of the bus at the end of the transfer (no Stop
+     * is issued), and the next transfer will begin with a Restart rather than a Start.
+     * @return KChecksumError if the PEC does not match, otherwise the transfer error on failure.
+     * On failure aBlock is left untouched.
+     */
+    template < typename taRegisterBlock >
+    TResult< void >
+    ReadRegisterBlockWithPec( std::uint8_t aDeviceAddress,
+                              std::uint8_t aCommand,
+                              typename taRegisterBlock::TStruct& aBlock,
+                              bool aNoStop = false ) NOEXCEPT
+    {
+        static_assert( taRegisterBlock::kSize <= KSmbusMaxBlockLength,
+                       "The register block is too long for the SMBus transfer" );
+
+        std::uint8_t wire[ taRegisterBlock::kSize ];
+        RETURN_IF_FAILED( ReadDataWithPec( aDeviceAddress, aCommand, wire, sizeof( wire ),
+                                           aNoStop ) );
+
+        taRegisterBlock::Decode( wire, aBlock );
+        return { };
+    }
+
+    /**
+     * @brief Converts the transfer length returned by the bus to the result of the transfer of
+     * aExpectedLength bytes.
+     */
+    static constexpr TResult< void >
+    TransferResult( int aTransferred, size_t aExpectedLength ) NOEXCEPT
+    {
+        if ( aTransferred < 0 )
+        {
+            return Failure( aTransferred );
+        }
+        if ( static_cast< size_t >( aTransferred ) != aExpectedLength )
+        {
+            return Failure( KIncompleteTransferError );
+        }
+        return { };
     }
 
     IAbstractI2CBus& iI2CBus;
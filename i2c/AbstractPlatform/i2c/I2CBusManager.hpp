@@ -0,0 +1,353 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Barrier.hpp>
+#include <AbstractPlatform/common/ErrorCode.hpp>
+#include <AbstractPlatform/common/MpscQueue.hpp>
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace AbstractPlatform
+{
+/// @brief The job executed by the CI2CBusManager on the thread owning the bus.
+class IAbstractI2CBusJob : public TMpscNode
+{
+public:
+    virtual ~IAbstractI2CBusJob( ) = default;
+
+    /**
+     * @brief Executes the job.
+     *
+     * @param aBusIndex The index of the bus the job is executed on.
+     * @param aI2CBus The bus.
+     */
+    virtual void Execute( size_t aBusIndex, IAbstractI2CBus& aI2CBus ) NOEXCEPT = 0;
+};
+
+/// @brief The register read executed by the CI2CBusManager::ReadAll().
+struct TI2CFanOutRead
+{
+    std::uint8_t iBusIndex = 0;
+    std::uint8_t iDeviceAddress = 0;
+    std::uint8_t iRegisterAddress = 0;
+    std::uint8_t* iDestination = nullptr;
+    size_t iLength = 0;
+
+    /// @brief KOk, or KGenericError if the read failed.
+    TErrorCode iResult = KOk;
+};
+
+/**
+ * @brief Owns several buses and executes the jobs on them in parallel, one executor thread per
+ * bus.
+ *
+ * The jobs submitted to the same bus are executed in submission order, the jobs of different
+ * buses run concurrently. The fan-out calls (ReadAll(), ForEachBus(), Synchronised()) split the
+ * work by bus, run it on all the executors and wait for the completion, so a scan of the whole
+ * rig takes as long as the scan of the slowest bus.
+ *
+ * The buses are added before Start(). Submissions are accepted from any thread.
+ *
+ * @tparam taMaxBuses The maximum count of buses.
+ */
+template < size_t taMaxBuses = 16 >
+class CI2CBusManager
+{
+public:
+    static_assert( taMaxBuses > 0 && taMaxBuses <= 256, "taMaxBuses has to be in range [1, 256]" );
+
+    CI2CBusManager( ) = default;
+    CI2CBusManager( const CI2CBusManager& ) = delete;
+    CI2CBusManager& operator=( const CI2CBusManager& ) = delete;
+
+    ~CI2CBusManager( )
+    {
+        Stop( );
+    }
+
+    /**
+     * @brief Adds the bus.
+     *
+     * @return int The bus index, KGenericError if there is no room for the bus or the executors
+     * are running.
+     */
+    int
+    AddBus( IAbstractI2CBus& aI2CBus ) NOEXCEPT
+    {
+        if ( iBusCount == taMaxBuses || iIsRunning )
+        {
+            return KGenericError;
+        }
+        iExecutors[ iBusCount ].iI2CBus = &aI2CBus;
+        return static_cast< int >( iBusCount++ );
+    }
+
+    size_t
+    BusCount( ) const NOEXCEPT
+    {
+        return iBusCount;
+    }
+
+    /**
+     * @brief Starts the executor threads.
+     */
+    void
+    Start( )
+    {
+        if ( iIsRunning )
+        {
+            return;
+        }
+        iIsRunning = true;
+        for ( size_t index = 0; index < iBusCount; ++index )
+        {
+            auto& executor = iExecutors[ index ];
+            executor.iStop = false;
+            executor.iThread = std::thread( [ &executor, index ]( ) { executor.Run( index ); } );
+        }
+    }
+
+    /**
+     * @brief Executes the already submitted jobs and stops the executor threads.
+     */
+    void
+    Stop( ) NOEXCEPT
+    {
+        if ( !iIsRunning )
+        {
+            return;
+        }
+        for ( size_t index = 0; index < iBusCount; ++index )
+        {
+            iExecutors[ index ].RequestStop( );
+        }
+        for ( size_t index = 0; index < iBusCount; ++index )
+        {
+            iExecutors[ index ].iThread.join( );
+        }
+        iIsRunning = false;
+    }
+
+    /**
+     * @brief Enqueues the job to the bus executor. The job has to stay alive until it is
+     * executed.
+     *
+     * @return TErrorCode KOk on success, KInvalidArgumentError if there is no such bus.
+     */
+    TErrorCode
+    Submit( size_t aBusIndex, IAbstractI2CBusJob& aJob ) NOEXCEPT
+    {
+        if ( aBusIndex >= iBusCount )
+        {
+            return KInvalidArgumentError;
+        }
+        iExecutors[ aBusIndex ].Push( aJob );
+        return KOk;
+    }
+
+    /**
+     * @brief Executes aAction( size_t aBusIndex, IAbstractI2CBus& aI2CBus ) on every bus
+     * concurrently and waits for the completion.
+     *
+     * @return TErrorCode KOk on success, KGenericError if the executors are not running.
+     */
+    template < typename taAction >
+    TErrorCode
+    ForEachBus( taAction&& aAction ) NOEXCEPT
+    {
+        return RunOnAll( [ &aAction ]( size_t aBusIndex, IAbstractI2CBus& aI2CBus ) {
+            aAction( aBusIndex, aI2CBus );
+        } );
+    }
+
+    /**
+     * @brief Executes aAction( size_t aBusIndex, IAbstractI2CBus& aI2CBus ) on every bus once
+     * all the executors have finished their earlier jobs and reached the barrier, so the actions
+     * (e.g. the conversion triggers) start on all the buses at the same moment. Waits for the
+     * completion.
+     *
+     * @return TErrorCode KOk on success, KGenericError if the executors are not running.
+     */
+    template < typename taAction >
+    TErrorCode
+    Synchronised( taAction&& aAction ) NOEXCEPT
+    {
+        CBarrier barrier{ iBusCount };
+        return RunOnAll( [ &aAction, &barrier ]( size_t aBusIndex, IAbstractI2CBus& aI2CBus ) {
+            barrier.ArriveAndWait( );
+            aAction( aBusIndex, aI2CBus );
+        } );
+    }
+
+    /**
+     * @brief Reads the registers across all the buses concurrently. The reads of the same bus
+     * are executed in the given order.
+     *
+     * @return TErrorCode KOk if all the reads succeeded, KInvalidArgumentError if a read refers
+     * to a missing bus, KGenericError if a read failed or the executors are not running. The
+     * result of every read is stored into its iResult.
+     */
+    TErrorCode
+    ReadAll( TI2CFanOutRead* aReads, size_t aCount ) NOEXCEPT
+    {
+        for ( size_t index = 0; index < aCount; ++index )
+        {
+            if ( aReads[ index ].iBusIndex >= iBusCount )
+            {
+                return KInvalidArgumentError;
+            }
+        }
+
+        std::atomic< bool > failed{ false };
+        auto readBus = [ aReads, aCount, &failed ]( size_t aBusIndex, IAbstractI2CBus& aI2CBus ) {
+            for ( size_t index = 0; index < aCount; ++index )
+            {
+                auto& read = aReads[ index ];
+                if ( read.iBusIndex != aBusIndex )
+                {
+                    continue;
+                }
+                const bool succeed
+                    = aI2CBus.Write( read.iDeviceAddress, &read.iRegisterAddress, 1, true ) == 1
+                      && aI2CBus.Read( read.iDeviceAddress, read.iDestination, read.iLength,
+                                       false )
+                             == static_cast< int >( read.iLength );
+                read.iResult = succeed ? KOk : KGenericError;
+                if ( !succeed )
+                {
+                    failed.store( true, std::memory_order_relaxed );
+                }
+            }
+        };
+        const TErrorCode result = RunOnAll( readBus );
+        if ( result != KOk )
+        {
+            return result;
+        }
+        return failed.load( std::memory_order_relaxed ) ? KGenericError : KOk;
+    }
+
+private:
+    class CExecutor
+    {
+    public:
+        void
+        Push( IAbstractI2CBusJob& aJob ) NOEXCEPT
+        {
+            iQueue.Push( aJob );
+            {
+                std::lock_guard< std::mutex > lock{ iMutex };
+                ++iPending;
+            }
+            iWakeUp.notify_one( );
+        }
+
+        void
+        RequestStop( ) NOEXCEPT
+        {
+            {
+                std::lock_guard< std::mutex > lock{ iMutex };
+                iStop = true;
+            }
+            iWakeUp.notify_one( );
+        }
+
+        void
+        Run( size_t aBusIndex ) NOEXCEPT
+        {
+            for ( ;; )
+            {
+                {
+                    std::unique_lock< std::mutex > lock{ iMutex };
+                    iWakeUp.wait( lock, [ this ]( ) { return iPending > 0 || iStop; } );
+                    if ( iPending == 0 )
+                    {
+                        return;
+                    }
+                }
+
+                // The job is counted only after it is pushed, but its link may still be in
+                // flight.
+                IAbstractI2CBusJob* job = iQueue.Pop( );
+                while ( job == nullptr )
+                {
+                    std::this_thread::yield( );
+                    job = iQueue.Pop( );
+                }
+                {
+                    std::lock_guard< std::mutex > lock{ iMutex };
+                    --iPending;
+                }
+                job->Execute( aBusIndex, *iI2CBus );
+            }
+        }
+
+        IAbstractI2CBus* iI2CBus = nullptr;
+        std::thread iThread;
+        bool iStop = false;
+
+    private:
+        TMpscQueue< IAbstractI2CBusJob > iQueue;
+        std::mutex iMutex;
+        std::condition_variable iWakeUp;
+        size_t iPending = 0;
+    };
+
+    template < typename taAction >
+    class CActionJob : public IAbstractI2CBusJob
+    {
+    public:
+        void
+        Execute( size_t aBusIndex, IAbstractI2CBus& aI2CBus ) NOEXCEPT override
+        {
+            ( *iAction )( aBusIndex, aI2CBus );
+            iLatch->CountDown( );
+        }
+
+        taAction* iAction = nullptr;
+        CLatch* iLatch = nullptr;
+    };
+
+    /**
+     * @brief Executes aAction on every bus executor and waits for the completion. Fails rather
+     * than waiting forever when there are no executor threads to run the jobs.
+     *
+     * The jobs of concurrent callers are pushed under iFanOutMutex, so every executor receives
+     * them in the same order and the barriers of Synchronised() can not wait on each other.
+     */
+    template < typename taAction >
+    TErrorCode
+    RunOnAll( taAction aAction ) NOEXCEPT
+    {
+        if ( !iIsRunning )
+        {
+            return KGenericError;
+        }
+
+        CLatch latch{ iBusCount };
+        CActionJob< taAction > jobs[ taMaxBuses ];
+        {
+            std::lock_guard< std::mutex > lock{ iFanOutMutex };
+            for ( size_t index = 0; index < iBusCount; ++index )
+            {
+                jobs[ index ].iAction = &aAction;
+                jobs[ index ].iLatch = &latch;
+                iExecutors[ index ].Push( jobs[ index ] );
+            }
+        }
+        latch.Wait( );
+        return KOk;
+    }
+
+    CExecutor iExecutors[ taMaxBuses ];
+    std::mutex iFanOutMutex;
+    size_t iBusCount = 0;
+    bool iIsRunning = false;
+};
+
+}  // namespace AbstractPlatform
@@ -0,0 +1,420 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Clock.hpp>
+#include <AbstractPlatform/common/ErrorCode.hpp>
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+
+#include <cassert>
+#include <cstdint>
+
+namespace AbstractPlatform
+{
+static constexpr std::uint32_t KI2CStandardModeFrequency = 100000;
+static constexpr std::uint32_t KI2CFastModeFrequency = 400000;
+static constexpr std::uint32_t KI2CFastModePlusFrequency = 1000000;
+
+/**
+ * @brief The bus timing parameters of the CI2CBusSimulator.
+ */
+struct TI2CTimingModel
+{
+    /// @brief The SCL frequency in Hz.
+    std::uint32_t iClockFrequency = KI2CFastModeFrequency;
+    /// @brief The duration of the Start and Restart conditions, in SCL periods.
+    std::uint32_t iStartConditionPeriods = 1;
+    /// @brief The duration of the Stop condition, in SCL periods.
+    std::uint32_t iStopConditionPeriods = 1;
+    /// @brief The controller's fixed cost of every Write() or Read() call.
+    TNanoseconds iTransferOverhead = 0;
+    /// @brief The controller's gap between the bytes (FIFO refill, interrupt latency, etc.).
+    TNanoseconds iByteOverhead = 0;
+
+    constexpr TNanoseconds
+    ClockPeriod( ) const
+    {
+        return 1000000000ull / iClockFrequency;
+    }
+
+    /**
+     * @brief Returns the wire time of a single byte: 8 data bits and the acknowledge bit.
+     */
+    constexpr TNanoseconds
+    ByteTime( ) const
+    {
+        return 9 * ClockPeriod( ) + iByteOverhead;
+    }
+};
+
+/**
+ * @brief The device model attached to the CI2CBusSimulator.
+ *
+ * The simulator calls the hooks in the bus order: OnStart() once the device is addressed, then
+ * OnWriteByte() or OnReadByte() for every data byte, then OnStop() once the Stop condition is
+ * issued. A transfer that ends without a Stop is followed by the OnStart() of the next one
+ * (the Restart condition).
+ */
+class ISimulatedI2CDevice
+{
+public:
+    virtual ~ISimulatedI2CDevice( ) = default;
+
+    /**
+     * @brief Called when the device is addressed.
+     *
+     * @param aIsRead true for a read transfer, false for a write transfer.
+     * @return true To acknowledge the address, false to NACK it.
+     */
+    virtual bool
+    OnStart( bool /*aIsRead*/ ) NOEXCEPT
+    {
+        return true;
+    }
+
+    /**
+     * @brief Called for every byte written to the device.
+     *
+     * @return true To acknowledge the byte, false to NACK it and abort the transfer.
+     */
+    virtual bool OnWriteByte( std::uint8_t aByte ) NOEXCEPT = 0;
+
+    /**
+     * @brief Called for every byte read from the device.
+     *
+     * @return std::uint8_t The byte the device drives on the bus.
+     */
+    virtual std::uint8_t OnReadByte( ) NOEXCEPT = 0;
+
+    virtual void
+    OnStop( ) NOEXCEPT
+    {
+    }
+
+    /**
+     * @brief Returns the time the device holds SCL low after every byte (clock stretching).
+     */
+    virtual TNanoseconds
+    ClockStretch( ) const NOEXCEPT
+    {
+        return 0;
+    }
+};
+
+/**
+ * @brief The device model with a register file and 8-bit register addresses.
+ *
+ * The first byte written after the Start selects the register; the following written bytes are
+ * stored to the consecutive registers and the read bytes are taken from the consecutive
+ * registers, as long as auto-increment is enabled. The register address wraps around at
+ * taRegisterCount.
+ *
+ * The device behaviour is scripted by overriding OnRegisterRead() and OnRegisterWrite() (e.g. to
+ * clear a status register on read or to reset the device on a command) or by changing the public
+ * configuration members at runtime.
+ *
+ * @tparam taRegisterCount The count of registers.
+ */
+template < size_t taRegisterCount = 256 >
+class CSimulatedRegisterDevice : public ISimulatedI2CDevice
+{
+public:
+    static_assert( taRegisterCount > 0 && taRegisterCount <= 256,
+                   "taRegisterCount has to be in range [1, 256]" );
+
+    bool
+    OnStart( bool aIsRead ) NOEXCEPT override
+    {
+        iIsAddressPhase = !aIsRead;
+        iTransferredBytes = 0;
+        return iPresent;
+    }
+
+    bool
+    OnWriteByte( std::uint8_t aByte ) NOEXCEPT override
+    {
+        if ( iTransferredBytes++ >= iNackAfterBytes )
+        {
+            return false;
+        }
+
+        if ( iIsAddressPhase )
+        {
+            iIsAddressPhase = false;
+            iRegisterAddress = aByte % taRegisterCount;
+            return true;
+        }
+
+        OnRegisterWrite( iRegisterAddress, aByte );
+        Advance( );
+        return true;
+    }
+
+    std::uint8_t
+    OnReadByte( ) NOEXCEPT override
+    {
+        ++iTransferredBytes;
+        const std::uint8_t value = OnRegisterRead( iRegisterAddress );
+        Advance( );
+        return value;
+    }
+
+    TNanoseconds
+    ClockStretch( ) const NOEXCEPT override
+    {
+        return iClockStretch;
+    }
+
+    /**
+     * @brief Returns the value of the register read by the bus master.
+     */
+    virtual std::uint8_t
+    OnRegisterRead( std::uint8_t aRegisterAddress ) NOEXCEPT
+    {
+        return iRegisters[ aRegisterAddress ];
+    }
+
+    /**
+     * @brief Stores the value of the register written by the bus master.
+     */
+    virtual void
+    OnRegisterWrite( std::uint8_t aRegisterAddress, std::uint8_t aValue ) NOEXCEPT
+    {
+        iRegisters[ aRegisterAddress ] = aValue;
+    }
+
+    std::uint8_t iRegisters[ taRegisterCount ] = { };
+    /// @brief If false, the device NACKs its address.
+    bool iPresent = true;
+    bool iAutoIncrement = true;
+    /// @brief The count of written bytes (register address included) the device acknowledges.
+    size_t iNackAfterBytes = static_cast< size_t >( -1 );
+    TNanoseconds iClockStretch = 0;
+
+private:
+    void
+    Advance( ) NOEXCEPT
+    {
+        if ( iAutoIncrement )
+        {
+            iRegisterAddress = static_cast< std::uint8_t >( ( iRegisterAddress + 1u )
+                                                            % taRegisterCount );
+        }
+    }
+
+    std::uint8_t iRegisterAddress = 0;
+    bool iIsAddressPhase = false;
+    size_t iTransferredBytes = 0;
+};
+
+/**
+ * @brief The in-process I2C bus simulating the attached device models and accounting the bus
+ * time with the TI2CTimingModel.
+ *
+ * The bus time is virtual: Now() advances only with the simulated transfers and explicit
+ * AdvanceTime() calls, so throughput measurements are deterministic. The simulator provides the
+ * clock interface and may be used as the clock of the components it serves (e.g.
+ * CI2CScheduler).
+ */
+class CI2CBusSimulator : public IAbstractI2CBus
+{
+public:
+    static constexpr size_t kAddressCount = 128;
+
+    explicit CI2CBusSimulator( const TI2CTimingModel& aTimingModel = TI2CTimingModel{ } )
+        : iTimingModel{ aTimingModel }
+    {
+    }
+
+    /**
+     * @brief Attaches the device model to the 7-bit address.
+     *
+     * The device has to outlive the simulator or be detached.
+     */
+    void
+    Attach( std::uint8_t aDeviceAddress, ISimulatedI2CDevice& aDevice ) NOEXCEPT
+    {
+        assert( aDeviceAddress < kAddressCount );
+        iDevices[ aDeviceAddress ] = &aDevice;
+    }
+
+    void
+    Detach( std::uint8_t aDeviceAddress ) NOEXCEPT
+    {
+        assert( aDeviceAddress < kAddressCount );
+        iDevices[ aDeviceAddress ] = nullptr;
+    }
+
+    int
+    Write( std::uint8_t aDeviceAddress,
+           const std::uint8_t* aDataSource,
+           size_t aDataLength,
+           bool aNoStop ) NOEXCEPT override
+    {
+        assert( aDataSource != nullptr || aDataLength == 0 );
+
+        ISimulatedI2CDevice* device = BeginTransfer( aDeviceAddress, false );
+        if ( device == nullptr )
+        {
+            return KGenericError;
+        }
+
+        size_t written = 0;
+        for ( ; written < aDataLength; ++written )
+        {
+            ChargeByte( *device );
+            if ( !device->OnWriteByte( aDataSource[ written ] ) )
+            {
+                // The NACKed byte was clocked out too, as ChargeByte has already accounted.
+                iStatistics.iBytesWritten += written + 1;
+                EndTransfer( device, false );
+                return static_cast< int >( written );
+            }
+        }
+
+        iStatistics.iBytesWritten += written;
+        EndTransfer( device, aNoStop );
+        return static_cast< int >( written );
+    }
+
+    int
+    Read( std::uint8_t aDeviceAddress,
+          std::uint8_t* aDataDestination,
+          size_t aDataLength,
+          bool aNoStop ) NOEXCEPT override
+    {
+        assert( aDataDestination != nullptr || aDataLength == 0 );
+
+        ISimulatedI2CDevice* device = BeginTransfer( aDeviceAddress, true );
+        if ( device == nullptr )
+        {
+            return KGenericError;
+        }
+
+        for ( size_t i = 0; i < aDataLength; ++i )
+        {
+            ChargeByte( *device );
+            aDataDestination[ i ] = device->OnReadByte( );
+        }
+
+        iStatistics.iBytesRead += aDataLength;
+        EndTransfer( device, aNoStop );
+        return static_cast< int >( aDataLength );
+    }
+
+    /**
+     * @brief Returns the current virtual time.
+     */
+    TNanoseconds
+    Now( ) const NOEXCEPT
+    {
+        return iNow;
+    }
+
+    /**
+     * @brief Advances the virtual time, e.g. to model the host's computation between transfers.
+     */
+    void
+    AdvanceTime( TNanoseconds aDuration ) NOEXCEPT
+    {
+        iNow += aDuration;
+    }
+
+    const TI2CTimingModel&
+    TimingModel( ) const NOEXCEPT
+    {
+        return iTimingModel;
+    }
+
+    void
+    SetTimingModel( const TI2CTimingModel& aTimingModel ) NOEXCEPT
+    {
+        iTimingModel = aTimingModel;
+    }
+
+    struct TStatistics
+    {
+        /// @brief The virtual time the bus was not idle.
+        TNanoseconds iBusyTime = 0;
+        std::uint64_t iTransfers = 0;
+        std::uint64_t iAddressNacks = 0;
+        std::uint64_t iBytesWritten = 0;
+        std::uint64_t iBytesRead = 0;
+    };
+
+    const TStatistics&
+    Statistics( ) const NOEXCEPT
+    {
+        return iStatistics;
+    }
+
+    void
+    ResetStatistics( ) NOEXCEPT
+    {
+        iStatistics = TStatistics{ };
+    }
+
+private:
+    ISimulatedI2CDevice*
+    BeginTransfer( std::uint8_t aDeviceAddress, bool aIsRead ) NOEXCEPT
+    {
+        ++iStatistics.iTransfers;
+        Charge( iTimingModel.iTransferOverhead
+                + ( iTimingModel.iStartConditionPeriods + 9 ) * iTimingModel.ClockPeriod( ) );
+
+        // A transfer to another device after a held bus implicitly ends the previous one.
+        if ( iHeldDevice != nullptr && iHeldDevice != DeviceAt( aDeviceAddress ) )
+        {
+            iHeldDevice->OnStop( );
+        }
+        iHeldDevice = nullptr;
+
+        ISimulatedI2CDevice* device = DeviceAt( aDeviceAddress );
+        if ( device == nullptr || !device->OnStart( aIsRead ) )
+        {
+            ++iStatistics.iAddressNacks;
+            Charge( iTimingModel.iStopConditionPeriods * iTimingModel.ClockPeriod( ) );
+            return nullptr;
+        }
+        return device;
+    }
+
+    void
+    EndTransfer( ISimulatedI2CDevice* aDevice, bool aNoStop ) NOEXCEPT
+    {
+        if ( aNoStop )
+        {
+            iHeldDevice = aDevice;
+            return;
+        }
+
+        Charge( iTimingModel.iStopConditionPeriods * iTimingModel.ClockPeriod( ) );
+        aDevice->OnStop( );
+    }
+
+    void
+    ChargeByte( const ISimulatedI2CDevice& aDevice ) NOEXCEPT
+    {
+        Charge( iTimingModel.ByteTime( ) + aDevice.ClockStretch( ) );
+    }
+
+    void
+    Charge( TNanoseconds aDuration ) NOEXCEPT
+    {
+        iNow += aDuration;
+        iStatistics.iBusyTime += aDuration;
+    }
+
+    ISimulatedI2CDevice*
+    DeviceAt( std::uint8_t aDeviceAddress ) const NOEXCEPT
+    {
+        return aDeviceAddress < kAddressCount ? iDevices[ aDeviceAddress ] : nullptr;
+    }
+
+    TI2CTimingModel iTimingModel;
+    ISimulatedI2CDevice* iDevices[ kAddressCount ] = { };
+    ISimulatedI2CDevice* iHeldDevice = nullptr;
+    TNanoseconds iNow = 0;
+    TStatistics iStatistics;
+};
+
+}  // namespace AbstractPlatform
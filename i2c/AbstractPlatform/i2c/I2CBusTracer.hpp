@@ -0,0 +1,497 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/ArrayHelper.hpp>
+#include <AbstractPlatform/common/Clock.hpp>
+#include <AbstractPlatform/common/Memory.hpp>
+#include <AbstractPlatform/common/TypeBinaryRepresentation.hpp>
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace AbstractPlatform
+{
+#ifdef I2C_TRACING
+static constexpr bool KI2CTracingEnabled = true;
+#else
+static constexpr bool KI2CTracingEnabled = false;
+#endif
+
+/// @brief The single transfer recorded by the CI2CBusTracer.
+struct TI2CTraceRecord
+{
+    TNanoseconds iStart = 0;
+    TNanoseconds iEnd = 0;
+    std::uint32_t iLength = 0;
+    /// @brief The value returned by the traced bus (the transferred byte count or the error).
+    std::int32_t iResult = 0;
+    std::uint8_t iDeviceAddress = 0;
+    TI2CDirection iDirection = TI2CDirection::Write;
+};
+
+/**
+ * @brief The per-device transfer histograms.
+ *
+ * The bucket N of the latency histogram counts the transfers lasting [2^(N-1), 2^N) nanoseconds
+ * (the bucket 0 counts zero-length ones), the last bucket also counts the longer ones. The size
+ * histogram uses the same log2 bucketing for the transfer length in bytes.
+ */
+struct TI2CDeviceHistogram
+{
+    static constexpr size_t kLatencyBuckets = 32;
+    static constexpr size_t kSizeBuckets = 17;
+
+    std::uint32_t iLatency[ kLatencyBuckets ] = { };
+    std::uint32_t iSize[ kSizeBuckets ] = { };
+    std::uint32_t iFailures = 0;
+};
+
+/**
+ * @brief The IAbstractI2CBus decorator recording every transfer of the decorated bus.
+ *
+ * Every thread calling the tracer claims its own ring buffer on the first transfer, so recording
+ * is lock-free and wait-free: a few relaxed atomic stores per record plus the histogram
+ * increments. A ring keeps the last taRingCapacity records of its thread. Threads that find no
+ * free ring are still accounted in the histograms, but their records are dropped and counted in
+ * DroppedRecords(). Rings stay claimed for the tracer's lifetime.
+ *
+ * The snapshot API (CopyRecords(), Histogram(), Dump()) may be called from any thread
+ * concurrently with the transfers; records overwritten while being copied are skipped.
+ *
+ * If taEnabled is false (the default unless the I2C_TRACING macro is defined, see the
+ * USE_I2C_TRACING CMake option), the tracer holds no storage and forwards the calls as is.
+ *
+ * @tparam taClock The clock type providing TNanoseconds Now() (e.g. CSteadyClock).
+ * @tparam taEnabled Whether transfers are recorded.
+ * @tparam taMaxThreads The count of per-thread rings.
+ * @tparam taRingCapacity The count of records a ring keeps, has to be a power of 2.
+ */
+template < typename taClock,
+           bool taEnabled = KI2CTracingEnabled,
+           size_t taMaxThreads = 8,
+           size_t taRingCapacity = 1024 >
+class CI2CBusTracer : public IAbstractI2CBus
+{
+public:
+    static_assert( taRingCapacity > 0 && ( taRingCapacity & ( taRingCapacity - 1 ) ) == 0,
+                   "taRingCapacity has to be a power of 2" );
+
+    static constexpr size_t kAddressCount = 128;
+    static constexpr size_t kDumpHeaderSize = 8;
+    static constexpr size_t kDumpRecordSize = 22;
+
+    CI2CBusTracer( IAbstractI2CBus& aI2CBus, const taClock& aClock )
+        : iI2CBus{ aI2CBus }
+        , iClock{ aClock }
+    {
+    }
+
+    int
+    Write( std::uint8_t aDeviceAddress,
+           const std::uint8_t* aDataSource,
+           size_t aDataLength,
+           bool aNoStop ) NOEXCEPT override
+    {
+        if constexpr ( !taEnabled )
+        {
+            return iI2CBus.Write( aDeviceAddress, aDataSource, aDataLength, aNoStop );
+        }
+        else
+        {
+            const TNanoseconds start = iClock.Now( );
+            const int result = iI2CBus.Write( aDeviceAddress, aDataSource, aDataLength, aNoStop );
+            Record( start, iClock.Now( ), aDeviceAddress, TI2CDirection::Write, aDataLength,
+                    result );
+            return result;
+        }
+    }
+
+    int
+    Read( std::uint8_t aDeviceAddress,
+          std::uint8_t* aDataDestination,
+          size_t aDataLength,
+          bool aNoStop ) NOEXCEPT override
+    {
+        if constexpr ( !taEnabled )
+        {
+            return iI2CBus.Read( aDeviceAddress, aDataDestination, aDataLength, aNoStop );
+        }
+        else
+        {
+            const TNanoseconds start = iClock.Now( );
+            const int result
+                = iI2CBus.Read( aDeviceAddress, aDataDestination, aDataLength, aNoStop );
+            Record( start, iClock.Now( ), aDeviceAddress, TI2CDirection::Read, aDataLength,
+                    result );
+            return result;
+        }
+    }
+
+    static constexpr bool
+    IsEnabled( )
+    {
+        return taEnabled;
+    }
+
+    /**
+     * @brief Copies the records currently kept by the rings. The records of a single thread are
+     * ordered by time, the records of different threads are not interleaved.
+     *
+     * @param aDestination Not null pointer to the buffer receiving the records.
+     * @param aMaxRecords The capacity of the buffer.
+     * @return size_t The count of the copied records.
+     */
+    size_t
+    CopyRecords( TI2CTraceRecord* aDestination, size_t aMaxRecords ) const NOEXCEPT
+    {
+        size_t copied = 0;
+        if constexpr ( taEnabled )
+        {
+            for ( const auto& ring : iStorage.iRings )
+            {
+                if ( ring.iOwner.load( std::memory_order_acquire ) != nullptr )
+                {
+                    copied += ring.Copy( aDestination + copied, aMaxRecords - copied );
+                }
+            }
+        }
+        return copied;
+    }
+
+    /**
+     * @brief Returns the snapshot of the device histograms.
+     *
+     * @param aDeviceAddress 7-bit device address.
+     */
+    TI2CDeviceHistogram
+    Histogram( std::uint8_t aDeviceAddress ) const NOEXCEPT
+    {
+        assert( aDeviceAddress < kAddressCount );
+
+        TI2CDeviceHistogram snapshot;
+        if constexpr ( taEnabled )
+        {
+            const auto& histogram = iStorage.iHistograms[ aDeviceAddress ];
+            for ( size_t i = 0; i < TI2CDeviceHistogram::kLatencyBuckets; ++i )
+            {
+                snapshot.iLatency[ i ] = histogram.iLatency[ i ].load( std::memory_order_relaxed );
+            }
+            for ( size_t i = 0; i < TI2CDeviceHistogram::kSizeBuckets; ++i )
+            {
+                snapshot.iSize[ i ] = histogram.iSize[ i ].load( std::memory_order_relaxed );
+            }
+            snapshot.iFailures = histogram.iFailures.load( std::memory_order_relaxed );
+        }
+        return snapshot;
+    }
+
+    std::uint64_t
+    DroppedRecords( ) const NOEXCEPT
+    {
+        if constexpr ( taEnabled )
+        {
+            return iStorage.iDroppedRecords.load( std::memory_order_relaxed );
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Writes the records currently kept by the rings in the compact binary form.
+     *
+     * The dump consists of the header (the "I2CT" magic, the 16-bit format version and the
+     * 16-bit record size) followed by kDumpRecordSize-byte records: the 64-bit start time, the
+     * 32-bit duration, the 32-bit length, the 32-bit result, the device address and the
+     * direction. All values are little-endian.
+     *
+     * @param aBuffer Not null pointer to the buffer receiving the dump.
+     * @param aBufferLength The buffer size in bytes.
+     * @return size_t The count of the bytes written; the records not fitting the buffer are
+     * omitted.
+     */
+    size_t
+    Dump( std::uint8_t* aBuffer, size_t aBufferLength ) const NOEXCEPT
+    {
+        if ( aBufferLength < kDumpHeaderSize )
+        {
+            return 0;
+        }
+
+        const std::uint8_t kMagic[] = { 'I', '2', 'C', 'T' };
+        std::memcpy( aBuffer, kMagic, sizeof( kMagic ) );
+        ScalarTypeCopy( aBuffer + 4, ToLittleEndian( std::uint16_t{ 2 } ) );
+        ScalarTypeCopy( aBuffer + 6,
+                        ToLittleEndian( static_cast< std::uint16_t >( kDumpRecordSize ) ) );
+
+        std::uint8_t* position = aBuffer + kDumpHeaderSize;
+        size_t space = ( aBufferLength - kDumpHeaderSize ) / kDumpRecordSize;
+        TI2CTraceRecord records[ 64 ];
+        if constexpr ( taEnabled )
+        {
+            for ( const auto& ring : iStorage.iRings )
+            {
+                if ( ring.iOwner.load( std::memory_order_acquire ) == nullptr )
+                {
+                    continue;
+                }
+                for ( std::uint64_t from = 0; space > 0; )
+                {
+                    const size_t count
+                        = ring.Copy( records, std::min( space, ArrayLength( records ) ), &from );
+                    if ( count == 0 )
+                    {
+                        break;
+                    }
+                    for ( size_t i = 0; i < count; ++i )
+                    {
+                        position = DumpRecord( position, records[ i ] );
+                    }
+                    space -= count;
+                }
+            }
+        }
+        return static_cast< size_t >( position - aBuffer );
+    }
+
+private:
+    struct TRing
+    {
+        // A record is packed into four words written with relaxed atomic stores, so the
+        // snapshot readers never observe a torn word.
+        struct TPackedRecord
+        {
+            std::atomic< std::uint64_t > iStart{ 0 };
+            std::atomic< std::uint64_t > iEnd{ 0 };
+            std::atomic< std::uint64_t > iTransfer{ 0 };
+            std::atomic< std::uint16_t > iTarget{ 0 };
+        };
+
+        void
+        Push( const TI2CTraceRecord& aRecord ) NOEXCEPT
+        {
+            const std::uint64_t head = iHead.load( std::memory_order_relaxed );
+            iStarted.store( head + 1, std::memory_order_relaxed );
+            std::atomic_thread_fence( std::memory_order_release );
+            auto& slot = iRecords[ head & ( taRingCapacity - 1 ) ];
+            slot.iStart.store( aRecord.iStart, std::memory_order_relaxed );
+            slot.iEnd.store( aRecord.iEnd, std::memory_order_relaxed );
+            const auto result = static_cast< std::uint32_t >( aRecord.iResult );
+            slot.iTransfer.store( static_cast< std::uint64_t >( aRecord.iLength )
+                                      | static_cast< std::uint64_t >( result ) << 32,
+                                  std::memory_order_relaxed );
+            slot.iTarget.store( static_cast< std::uint16_t >(
+                                    aRecord.iDeviceAddress
+                                    | static_cast< unsigned >( aRecord.iDirection ) << 8 ),
+                                std::memory_order_relaxed );
+            iHead.store( head + 1, std::memory_order_release );
+        }
+
+        /**
+         * @brief Copies the kept records starting from the record *aFrom (or the oldest kept
+         * one) and advances *aFrom past the copied ones.
+         */
+        size_t
+        Copy( TI2CTraceRecord* aDestination,
+              size_t aMaxRecords,
+              std::uint64_t* aFrom = nullptr ) const NOEXCEPT
+        {
+            const std::uint64_t head = iHead.load( std::memory_order_acquire );
+            std::uint64_t first = head > taRingCapacity ? head - taRingCapacity : 0;
+            if ( aFrom != nullptr && *aFrom > first )
+            {
+                first = *aFrom;
+            }
+
+            size_t copied = 0;
+            std::uint64_t index = first;
+            for ( ; index < head && copied < aMaxRecords; ++index )
+            {
+                const auto& slot = iRecords[ index & ( taRingCapacity - 1 ) ];
+                auto& record = aDestination[ copied ];
+                record.iStart = slot.iStart.load( std::memory_order_relaxed );
+                record.iEnd = slot.iEnd.load( std::memory_order_relaxed );
+                const std::uint64_t transfer = slot.iTransfer.load( std::memory_order_relaxed );
+                const std::uint16_t target = slot.iTarget.load( std::memory_order_relaxed );
+                record.iLength = static_cast< std::uint32_t >( transfer );
+                record.iResult = static_cast< std::int32_t >( transfer >> 32 );
+                record.iDeviceAddress = static_cast< std::uint8_t >( target );
+                record.iDirection = static_cast< TI2CDirection >( target >> 8 );
+
+                // The writer may have overwritten the slot while it was being copied.
+                std::atomic_thread_fence( std::memory_order_acquire );
+                const std::uint64_t started = iStarted.load( std::memory_order_relaxed );
+                if ( started > index + taRingCapacity )
+                {
+                    continue;
+                }
+                ++copied;
+            }
+
+            if ( aFrom != nullptr )
+            {
+                *aFrom = index;
+            }
+            return copied;
+        }
+
+        /// @brief The token of the thread writing to the ring, nullptr if the ring is free.
+        std::atomic< const void* > iOwner{ nullptr };
+        std::atomic< std::uint64_t > iHead{ 0 };
+        /// @brief The count of the records whose write has started.
+        std::atomic< std::uint64_t > iStarted{ 0 };
+        TPackedRecord iRecords[ taRingCapacity ];
+    };
+
+    struct TAtomicHistogram
+    {
+        std::atomic< std::uint32_t > iLatency[ TI2CDeviceHistogram::kLatencyBuckets ] = { };
+        std::atomic< std::uint32_t > iSize[ TI2CDeviceHistogram::kSizeBuckets ] = { };
+        std::atomic< std::uint32_t > iFailures{ 0 };
+    };
+
+    template < bool taHasStorage, typename = void >
+    struct TStorage
+    {
+    };
+
+    template < typename taDummy >
+    struct TStorage< true, taDummy >
+    {
+        TRing iRings[ taMaxThreads ];
+        TAtomicHistogram iHistograms[ kAddressCount ];
+        std::atomic< std::uint64_t > iDroppedRecords{ 0 };
+    };
+
+    static size_t
+    Log2Bucket( std::uint64_t aValue, size_t aBucketCount ) NOEXCEPT
+    {
+#if defined( __GNUC__ ) || defined( __clang__ )
+        const size_t bucket = aValue == 0 ? 0 : 64 - __builtin_clzll( aValue );
+#else
+        size_t bucket = 0;
+        for ( ; aValue != 0; aValue >>= 1 )
+        {
+            ++bucket;
+        }
+#endif
+        return bucket < aBucketCount ? bucket : aBucketCount - 1;
+    }
+
+    template < typename taValue >
+    static taValue
+    ToLittleEndian( taValue aValue ) NOEXCEPT
+    {
+        return EndiannessConverter< Endianness::Little, Endianness::Native >::Convert( aValue );
+    }
+
+    static std::uint8_t*
+    DumpRecord( std::uint8_t* aPosition, const TI2CTraceRecord& aRecord ) NOEXCEPT
+    {
+        const TNanoseconds duration = aRecord.iEnd - aRecord.iStart;
+        ScalarTypeCopy( aPosition, ToLittleEndian( aRecord.iStart ) );
+        ScalarTypeCopy( aPosition + 8,
+                        ToLittleEndian( static_cast< std::uint32_t >(
+                            duration > 0xFFFFFFFFu ? 0xFFFFFFFFu : duration ) ) );
+        ScalarTypeCopy( aPosition + 12, ToLittleEndian( aRecord.iLength ) );
+        ScalarTypeCopy( aPosition + 16, ToLittleEndian( aRecord.iResult ) );
+        aPosition[ 20 ] = aRecord.iDeviceAddress;
+        aPosition[ 21 ] = static_cast< std::uint8_t >( aRecord.iDirection );
+        return aPosition + kDumpRecordSize;
+    }
+
+    TRing*
+    ThreadRing( ) NOEXCEPT
+    {
+        struct TThreadCache
+        {
+            const CI2CBusTracer* iTracer = nullptr;
+            std::uint64_t iInstance = 0;
+            TRing* iRing = nullptr;
+        };
+        thread_local TThreadCache cache;
+        // The address of a thread_local object identifies the thread among the live ones.
+        thread_local const char threadToken = 0;
+
+        if ( cache.iTracer == this && cache.iInstance == iInstance && cache.iRing != nullptr )
+        {
+            return cache.iRing;
+        }
+
+        TRing* threadRing = nullptr;
+        for ( auto& ring : iStorage.iRings )
+        {
+            if ( ring.iOwner.load( std::memory_order_acquire ) == &threadToken )
+            {
+                threadRing = &ring;
+                break;
+            }
+        }
+        for ( size_t i = 0; threadRing == nullptr && i < taMaxThreads; ++i )
+        {
+            const void* expected = nullptr;
+            if ( iStorage.iRings[ i ].iOwner.compare_exchange_strong(
+                     expected, &threadToken, std::memory_order_acq_rel ) )
+            {
+                threadRing = &iStorage.iRings[ i ];
+            }
+        }
+
+        cache = TThreadCache{ this, iInstance, threadRing };
+        return threadRing;
+    }
+
+    void
+    Record( TNanoseconds aStart,
+            TNanoseconds aEnd,
+            std::uint8_t aDeviceAddress,
+            TI2CDirection aDirection,
+            size_t aLength,
+            int aResult ) NOEXCEPT
+    {
+        TI2CTraceRecord record;
+        record.iStart = aStart;
+        record.iEnd = aEnd;
+        record.iLength = static_cast< std::uint32_t >( aLength );
+        record.iResult = static_cast< std::int32_t >( aResult );
+        record.iDeviceAddress = aDeviceAddress;
+        record.iDirection = aDirection;
+
+        if ( TRing* ring = ThreadRing( ) )
+        {
+            ring->Push( record );
+        }
+        else
+        {
+            iStorage.iDroppedRecords.fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        auto& histogram = iStorage.iHistograms[ aDeviceAddress % kAddressCount ];
+        histogram
+            .iLatency[ Log2Bucket( aEnd - aStart, TI2CDeviceHistogram::kLatencyBuckets ) ]
+            .fetch_add( 1, std::memory_order_relaxed );
+        histogram.iSize[ Log2Bucket( aLength, TI2CDeviceHistogram::kSizeBuckets ) ].fetch_add(
+            1, std::memory_order_relaxed );
+        if ( aResult != static_cast< int >( aLength ) )
+        {
+            histogram.iFailures.fetch_add( 1, std::memory_order_relaxed );
+        }
+    }
+
+    static std::uint64_t
+    NextInstance( ) NOEXCEPT
+    {
+        static std::atomic< std::uint64_t > instanceCounter{ 0 };
+        return instanceCounter.fetch_add( 1, std::memory_order_relaxed ) + 1;
+    }
+
+    IAbstractI2CBus& iI2CBus;
+    const taClock& iClock;
+    // Distinguishes tracers reusing the address of a destroyed one in the thread caches.
+    const std::uint64_t iInstance = taEnabled ? NextInstance( ) : 0;
+    TStorage< taEnabled > iStorage;
+};
+
+}  // namespace AbstractPlatform
@@ -0,0 +1,624 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Clock.hpp>
+#include <AbstractPlatform/common/ErrorCode.hpp>
+#include <AbstractPlatform/common/Memory.hpp>
+#include <AbstractPlatform/common/TypeBinaryRepresentation.hpp>
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define I2C_CAPTURE_MMAP
+#endif
+
+namespace AbstractPlatform
+{
+/**
+ * @brief The I2C capture file format.
+ *
+ * The capture consists of the file header followed by the records. All values are
+ * little-endian.
+ *
+ * File header (kFileHeaderSize bytes):
+ *  - 8 bytes: the "I2CCAP\0\0" magic;
+ *  - u16: the format version (kVersion);
+ *  - u16: the record header size (kRecordHeaderSize);
+ *  - u32: reserved.
+ *
+ * Record (kRecordHeaderSize bytes followed by the payload):
+ *  - u64: the transfer start time relative to the capture start, in nanoseconds;
+ *  - u32: the transfer duration in nanoseconds;
+ *  - u32: the requested transfer length;
+ *  - i32: the value returned by the bus;
+ *  - u8: the device address;
+ *  - u8: the direction (TI2CDirection);
+ *  - u8: the flags (kNoStopFlag);
+ *  - u8: reserved;
+ *  - payload: the written bytes for a write (the requested length), the received bytes for a
+ *    read (the returned length, 0 on failure).
+ *
+ * The records are unaligned and are decoded with memcpy, so the capture is read straight from a
+ * memory-mapped file.
+ */
+struct TI2CCaptureFormat
+{
+    static constexpr std::uint8_t kMagic[ 8 ] = { 'I', '2', 'C', 'C', 'A', 'P', 0, 0 };
+    static constexpr std::uint16_t kVersion = 1;
+    static constexpr size_t kFileHeaderSize = 16;
+    static constexpr size_t kRecordHeaderSize = 24;
+    static constexpr std::uint8_t kNoStopFlag = 0x01;
+};
+
+/// @brief The decoded capture record. The payload points into the capture memory.
+struct TI2CCaptureRecord
+{
+    TNanoseconds iStart = 0;
+    TNanoseconds iDuration = 0;
+    std::uint32_t iLength = 0;
+    std::int32_t iResult = 0;
+    std::uint8_t iDeviceAddress = 0;
+    TI2CDirection iDirection = TI2CDirection::Write;
+    bool iNoStop = false;
+    const std::uint8_t* iPayload = nullptr;
+    size_t iPayloadLength = 0;
+};
+
+/// @brief The destination of the recorded capture bytes.
+class IAbstractCaptureSink
+{
+public:
+    virtual ~IAbstractCaptureSink( ) = default;
+
+    /**
+     * @brief Appends the bytes to the capture.
+     *
+     * @return true If operation succeed, otherwise - false
+     */
+    virtual bool Append( const std::uint8_t* aData, size_t aDataLength ) NOEXCEPT = 0;
+};
+
+/**
+ * @brief The capture sink storing the capture into the caller-provided buffer.
+ */
+class CBufferCaptureSink : public IAbstractCaptureSink
+{
+public:
+    CBufferCaptureSink( std::uint8_t* aBuffer, size_t aCapacity )
+        : iBuffer{ aBuffer }
+        , iCapacity{ aCapacity }
+    {
+    }
+
+    bool
+    Append( const std::uint8_t* aData, size_t aDataLength ) NOEXCEPT override
+    {
+        if ( aDataLength > iCapacity - iLength )
+        {
+            return false;
+        }
+        std::memcpy( iBuffer + iLength, aData, aDataLength );
+        iLength += aDataLength;
+        return true;
+    }
+
+    const std::uint8_t*
+    Data( ) const NOEXCEPT
+    {
+        return iBuffer;
+    }
+
+    size_t
+    Length( ) const NOEXCEPT
+    {
+        return iLength;
+    }
+
+private:
+    std::uint8_t* iBuffer;
+    size_t iCapacity;
+    size_t iLength = 0;
+};
+
+/**
+ * @brief The capture sink appending the capture to the file through the buffered stdio stream.
+ */
+class CFileCaptureSink : public IAbstractCaptureSink
+{
+public:
+    CFileCaptureSink( ) = default;
+    CFileCaptureSink( const CFileCaptureSink& ) = delete;
+    CFileCaptureSink& operator=( const CFileCaptureSink& ) = delete;
+
+    ~CFileCaptureSink( )
+    {
+        Close( );
+    }
+
+    /**
+     * @brief Creates (truncates) the capture file.
+     *
+     * @return true If operation succeed, otherwise - false
+     */
+    bool
+    Open( const char* aPath ) NOEXCEPT
+    {
+        Close( );
+        iFile = std::fopen( aPath, "wb" );
+        return iFile != nullptr;
+    }
+
+    void
+    Close( ) NOEXCEPT
+    {
+        if ( iFile != nullptr )
+        {
+            std::fclose( iFile );
+            iFile = nullptr;
+        }
+    }
+
+    bool
+    Append( const std::uint8_t* aData, size_t aDataLength ) NOEXCEPT override
+    {
+        return iFile != nullptr && std::fwrite( aData, 1, aDataLength, iFile ) == aDataLength;
+    }
+
+private:
+    std::FILE* iFile = nullptr;
+};
+
+/**
+ * @brief The IAbstractI2CBus decorator recording the traffic of the decorated bus into the
+ * capture sink.
+ *
+ * @tparam taClock The clock type providing TNanoseconds Now() (e.g. CSteadyClock).
+ */
+template < typename taClock >
+class CI2CCaptureRecorder : public IAbstractI2CBus
+{
+public:
+    /**
+     * @brief Creates the recorder and writes the capture file header into the sink.
+     */
+    CI2CCaptureRecorder( IAbstractI2CBus& aI2CBus, IAbstractCaptureSink& aSink, const taClock& aClock )
+        : iI2CBus{ aI2CBus }
+        , iSink{ aSink }
+        , iClock{ aClock }
+        , iCaptureStart{ aClock.Now( ) }
+    {
+        std::uint8_t header[ TI2CCaptureFormat::kFileHeaderSize ] = { };
+        std::memcpy( header, TI2CCaptureFormat::kMagic, sizeof( TI2CCaptureFormat::kMagic ) );
+        ScalarTypeCopy( header + 8, ToLittleEndian( TI2CCaptureFormat::kVersion ) );
+        ScalarTypeCopy( header + 10, ToLittleEndian( static_cast< std::uint16_t >(
+                                         TI2CCaptureFormat::kRecordHeaderSize ) ) );
+        iSinkFailed = !iSink.Append( header, sizeof( header ) );
+    }
+
+    int
+    Write( std::uint8_t aDeviceAddress,
+           const std::uint8_t* aDataSource,
+           size_t aDataLength,
+           bool aNoStop ) NOEXCEPT override
+    {
+        const TNanoseconds start = iClock.Now( );
+        const int result = iI2CBus.Write( aDeviceAddress, aDataSource, aDataLength, aNoStop );
+        Record( start, aDeviceAddress, TI2CDirection::Write, aNoStop, aDataLength, result,
+                aDataSource, aDataLength );
+        return result;
+    }
+
+    int
+    Read( std::uint8_t aDeviceAddress,
+          std::uint8_t* aDataDestination,
+          size_t aDataLength,
+          bool aNoStop ) NOEXCEPT override
+    {
+        const TNanoseconds start = iClock.Now( );
+        const int result = iI2CBus.Read( aDeviceAddress, aDataDestination, aDataLength, aNoStop );
+        Record( start, aDeviceAddress, TI2CDirection::Read, aNoStop, aDataLength, result,
+                aDataDestination, result > 0 ? static_cast< size_t >( result ) : 0 );
+        return result;
+    }
+
+    /**
+     * @brief Returns false if the sink failed to store any part of the capture.
+     */
+    bool
+    IsValid( ) const NOEXCEPT
+    {
+        return !iSinkFailed;
+    }
+
+    std::uint64_t
+    RecordCount( ) const NOEXCEPT
+    {
+        return iRecordCount;
+    }
+
+private:
+    template < typename taValue >
+    static taValue
+    ToLittleEndian( taValue aValue ) NOEXCEPT
+    {
+        return EndiannessConverter< Endianness::Little, Endianness::Native >::Convert( aValue );
+    }
+
+    void
+    Record( TNanoseconds aStart,
+            std::uint8_t aDeviceAddress,
+            TI2CDirection aDirection,
+            bool aNoStop,
+            size_t aLength,
+            int aResult,
+            const std::uint8_t* aPayload,
+            size_t aPayloadLength ) NOEXCEPT
+    {
+        const TNanoseconds end = iClock.Now( );
+        const TNanoseconds duration = end - aStart;
+
+        std::uint8_t header[ TI2CCaptureFormat::kRecordHeaderSize ];
+        ScalarTypeCopy( header, ToLittleEndian( aStart - iCaptureStart ) );
+        ScalarTypeCopy( header + 8, ToLittleEndian( static_cast< std::uint32_t >(
+                                        duration > 0xFFFFFFFFu ? 0xFFFFFFFFu : duration ) ) );
+        ScalarTypeCopy( header + 12,
+                        ToLittleEndian( static_cast< std::uint32_t >( aLength ) ) );
+        ScalarTypeCopy( header + 16, ToLittleEndian( static_cast< std::int32_t >( aResult ) ) );
+        header[ 20 ] = aDeviceAddress;
+        header[ 21 ] = static_cast< std::uint8_t >( aDirection );
+        header[ 22 ] = aNoStop ? TI2CCaptureFormat::kNoStopFlag : 0;
+        header[ 23 ] = 0;
+
+        iSinkFailed |= !iSink.Append( header, sizeof( header ) );
+        if ( aPayloadLength > 0 )
+        {
+            iSinkFailed |= !iSink.Append( aPayload, aPayloadLength );
+        }
+        ++iRecordCount;
+    }
+
+    IAbstractI2CBus& iI2CBus;
+    IAbstractCaptureSink& iSink;
+    const taClock& iClock;
+    const TNanoseconds iCaptureStart;
+    std::uint64_t iRecordCount = 0;
+    bool iSinkFailed = false;
+};
+
+/**
+ * @brief The sequential reader of the capture located in memory (e.g. the memory-mapped capture
+ * file). Records are decoded on the fly, nothing is copied.
+ */
+class CI2CCaptureReader
+{
+public:
+    CI2CCaptureReader( ) = default;
+
+    CI2CCaptureReader( const std::uint8_t* aCapture, size_t aCaptureLength )
+    {
+        Reset( aCapture, aCaptureLength );
+    }
+
+    /**
+     * @brief Starts reading the capture.
+     *
+     * @return true If the capture header is valid, otherwise - false
+     */
+    bool
+    Reset( const std::uint8_t* aCapture, size_t aCaptureLength ) NOEXCEPT
+    {
+        iCapture = aCapture;
+        iCaptureLength = aCaptureLength;
+        iPosition = TI2CCaptureFormat::kFileHeaderSize;
+        iIsValid = aCapture != nullptr && aCaptureLength >= TI2CCaptureFormat::kFileHeaderSize
+                   && std::memcmp( aCapture, TI2CCaptureFormat::kMagic,
+                                   sizeof( TI2CCaptureFormat::kMagic ) )
+                          == 0
+                   && Load< std::uint16_t >( 8 ) == TI2CCaptureFormat::kVersion
+                   && Load< std::uint16_t >( 10 ) == TI2CCaptureFormat::kRecordHeaderSize;
+        return iIsValid;
+    }
+
+    /**
+     * @brief Restarts reading from the first record.
+     */
+    void
+    Rewind( ) NOEXCEPT
+    {
+        iPosition = TI2CCaptureFormat::kFileHeaderSize;
+    }
+
+    bool
+    IsValid( ) const NOEXCEPT
+    {
+        return iIsValid;
+    }
+
+    /**
+     * @brief Decodes the next record.
+     *
+     * @param aRecord The decoded record.
+     * @return true If the record was decoded, false at the end of the capture or if the capture
+     * is truncated or corrupted.
+     */
+    bool
+    Next( TI2CCaptureRecord& aRecord ) NOEXCEPT
+    {
+        if ( !iIsValid || iCaptureLength - iPosition < TI2CCaptureFormat::kRecordHeaderSize )
+        {
+            return false;
+        }
+
+        TI2CCaptureRecord record;
+        record.iStart = Load< std::uint64_t >( iPosition );
+        record.iDuration = Load< std::uint32_t >( iPosition + 8 );
+        record.iLength = Load< std::uint32_t >( iPosition + 12 );
+        record.iResult = Load< std::int32_t >( iPosition + 16 );
+        record.iDeviceAddress = iCapture[ iPosition + 20 ];
+        record.iDirection = static_cast< TI2CDirection >( iCapture[ iPosition + 21 ] );
+        record.iNoStop = ( iCapture[ iPosition + 22 ] & TI2CCaptureFormat::kNoStopFlag ) != 0;
+        record.iPayloadLength = record.iDirection == TI2CDirection::Write
+                                    ? record.iLength
+                                    : ( record.iResult > 0 ? record.iResult : 0 );
+        if ( record.iPayloadLength > record.iLength )
+        {
+            // The read can not return more bytes than requested.
+            return false;
+        }
+
+        const size_t payloadPosition = iPosition + TI2CCaptureFormat::kRecordHeaderSize;
+        if ( iCaptureLength - payloadPosition < record.iPayloadLength )
+        {
+            return false;
+        }
+        record.iPayload = iCapture + payloadPosition;
+
+        iPosition = payloadPosition + record.iPayloadLength;
+        aRecord = record;
+        return true;
+    }
+
+private:
+    template < typename taValue >
+    taValue
+    Load( size_t aPosition ) const NOEXCEPT
+    {
+        taValue value;
+        std::memcpy( &value, iCapture + aPosition, sizeof( value ) );
+        return EndiannessConverter< Endianness::Native, Endianness::Little >::Convert( value );
+    }
+
+    const std::uint8_t* iCapture = nullptr;
+    size_t iCaptureLength = 0;
+    size_t iPosition = 0;
+    bool iIsValid = false;
+};
+
+#ifdef I2C_CAPTURE_MMAP
+/**
+ * @brief The read-only memory mapping of the capture file. The kernel pages the capture in on
+ * demand, so captures larger than the available memory are replayed as a stream.
+ */
+class CMappedCaptureFile
+{
+public:
+    CMappedCaptureFile( ) = default;
+    CMappedCaptureFile( const CMappedCaptureFile& ) = delete;
+    CMappedCaptureFile& operator=( const CMappedCaptureFile& ) = delete;
+
+    ~CMappedCaptureFile( )
+    {
+        Close( );
+    }
+
+    /**
+     * @brief Maps the capture file.
+     *
+     * @return true If operation succeed, otherwise - false
+     */
+    bool
+    Open( const char* aPath ) NOEXCEPT
+    {
+        Close( );
+
+        const int file = ::open( aPath, O_RDONLY );
+        if ( file < 0 )
+        {
+            return false;
+        }
+
+        struct stat status;
+        if ( ::fstat( file, &status ) == 0 && status.st_size > 0 )
+        {
+            void* data = ::mmap( nullptr, static_cast< size_t >( status.st_size ), PROT_READ,
+                                 MAP_PRIVATE, file, 0 );
+            if ( data != MAP_FAILED )
+            {
+                ::madvise( data, static_cast< size_t >( status.st_size ), MADV_SEQUENTIAL );
+                iData = static_cast< const std::uint8_t* >( data );
+                iLength = static_cast< size_t >( status.st_size );
+            }
+        }
+        ::close( file );
+        return iData != nullptr;
+    }
+
+    void
+    Close( ) NOEXCEPT
+    {
+        if ( iData != nullptr )
+        {
+            ::munmap( const_cast< std::uint8_t* >( iData ), iLength );
+            iData = nullptr;
+            iLength = 0;
+        }
+    }
+
+    const std::uint8_t*
+    Data( ) const NOEXCEPT
+    {
+        return iData;
+    }
+
+    size_t
+    Length( ) const NOEXCEPT
+    {
+        return iLength;
+    }
+
+private:
+    const std::uint8_t* iData = nullptr;
+    size_t iLength = 0;
+};
+#endif
+
+enum class TI2CReplayTiming
+{
+    /// @brief Every transfer returns immediately.
+    AsFastAsPossible,
+    /// @brief Every transfer returns no earlier than it completed in the capture, relative to
+    /// the first paced transfer. Requires the wall clock (see KClockCanSleep).
+    Captured
+};
+
+/**
+ * @brief The IAbstractI2CBus serving the transfers from the capture.
+ *
+ * Every Write() or Read() call consumes the next capture record and returns its recorded
+ * result; reads receive the recorded data. A call not matching the record (the direction, the
+ * device address, the length or, for writes, the written data) is counted as a mismatch and
+ * fails with KGenericError, so the replayed driver stack diverging from the captured one is
+ * detected.
+ *
+ * The TI2CReplayTiming::Captured timing waits with the clock's SleepUntil(), so it is only
+ * available with the wall clocks. With a virtual clock, e.g. the one of CI2CBusSimulator, the
+ * time would never pass while waiting: the timing is rejected (asserted in the debug builds) and
+ * the transfers are replayed as fast as possible.
+ *
+ * @tparam taClock The clock type providing TNanoseconds Now() (e.g. CSteadyClock).
+ */
+template < typename taClock >
+class CI2CReplayBus : public IAbstractI2CBus
+{
+public:
+    CI2CReplayBus( CI2CCaptureReader& aReader,
+                   const taClock& aClock,
+                   TI2CReplayTiming aTiming = TI2CReplayTiming::AsFastAsPossible )
+        : iReader{ aReader }
+        , iClock{ aClock }
+        , iTiming{ KClockCanSleep< taClock > ? aTiming : TI2CReplayTiming::AsFastAsPossible }
+    {
+        assert( KClockCanSleep< taClock > || aTiming != TI2CReplayTiming::Captured );
+    }
+
+    int
+    Write( std::uint8_t aDeviceAddress,
+           const std::uint8_t* aDataSource,
+           size_t aDataLength,
+           bool /*aNoStop*/ ) NOEXCEPT override
+    {
+        TI2CCaptureRecord record;
+        if ( !NextMatching( record, aDeviceAddress, TI2CDirection::Write, aDataLength )
+             || ( aDataLength > 0
+                  && std::memcmp( record.iPayload, aDataSource, aDataLength ) != 0 ) )
+        {
+            ++iMismatches;
+            return KGenericError;
+        }
+
+        Pace( record );
+        return record.iResult;
+    }
+
+    int
+    Read( std::uint8_t aDeviceAddress,
+          std::uint8_t* aDataDestination,
+          size_t aDataLength,
+          bool /*aNoStop*/ ) NOEXCEPT override
+    {
+        TI2CCaptureRecord record;
+        if ( !NextMatching( record, aDeviceAddress, TI2CDirection::Read, aDataLength ) )
+        {
+            ++iMismatches;
+            return KGenericError;
+        }
+
+        // The reader bounds the payload by the record length, which matches aDataLength; the
+        // copy is bounded by the destination anyway.
+        const size_t payloadLength
+            = record.iPayloadLength < aDataLength ? record.iPayloadLength : aDataLength;
+        if ( payloadLength > 0 )
+        {
+            std::memcpy( aDataDestination, record.iPayload, payloadLength );
+        }
+        Pace( record );
+        return record.iResult;
+    }
+
+    std::uint64_t
+    Mismatches( ) const NOEXCEPT
+    {
+        return iMismatches;
+    }
+
+    std::uint64_t
+    ReplayedRecords( ) const NOEXCEPT
+    {
+        return iReplayedRecords;
+    }
+
+private:
+    bool
+    NextMatching( TI2CCaptureRecord& aRecord,
+                  std::uint8_t aDeviceAddress,
+                  TI2CDirection aDirection,
+                  size_t aDataLength ) NOEXCEPT
+    {
+        if ( !iReader.Next( aRecord ) )
+        {
+            return false;
+        }
+        ++iReplayedRecords;
+        return aRecord.iDirection == aDirection && aRecord.iDeviceAddress == aDeviceAddress
+               && aRecord.iLength == aDataLength;
+    }
+
+    void
+    Pace( const TI2CCaptureRecord& aRecord ) NOEXCEPT
+    {
+        if constexpr ( KClockCanSleep< taClock > )
+        {
+            if ( iTiming != TI2CReplayTiming::Captured )
+            {
+                return;
+            }
+
+            // Anchor the capture time line on the first paced record, whichever it is.
+            if ( !iIsReplayAnchored )
+            {
+                iReplayStart = iClock.Now( ) - aRecord.iStart;
+                iIsReplayAnchored = true;
+            }
+
+            iClock.SleepUntil( iReplayStart + aRecord.iStart + aRecord.iDuration );
+        }
+    }
+
+    CI2CCaptureReader& iReader;
+    const taClock& iClock;
+    const TI2CReplayTiming iTiming;
+    TNanoseconds iReplayStart = 0;
+    bool iIsReplayAnchored = false;
+    std::uint64_t iReplayedRecords = 0;
+    std::uint64_t iMismatches = 0;
+};
+
+}  // namespace AbstractPlatform
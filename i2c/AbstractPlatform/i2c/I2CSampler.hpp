@@ -0,0 +1,317 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Clock.hpp>
+#include <AbstractPlatform/common/ErrorCode.hpp>
+#include <AbstractPlatform/common/RingBuffer.hpp>
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+namespace AbstractPlatform
+{
+/// @brief The periodic read of the device register range.
+struct TI2CSamplingChannel
+{
+    std::uint8_t iDeviceAddress = 0;
+    std::uint8_t iRegisterAddress = 0;
+    std::uint8_t iLength = 0;
+    TNanoseconds iPeriod = 0;
+    /// @brief The time of the first read relative to the moment the channel is added.
+    TNanoseconds iPhase = 0;
+    /// @brief Whether the device auto-increments the register address, so the read may be
+    /// merged with the reads of the adjacent registers.
+    bool iMergeable = true;
+};
+
+/// @brief The single sample produced by the CI2CSampler.
+template < size_t taMaxSampleLength >
+struct TI2CSample
+{
+    /// @brief The time the transaction reading the sample was started.
+    TNanoseconds iTimestamp = 0;
+    std::uint8_t iChannel = 0;
+    std::uint8_t iLength = 0;
+    /// @brief KOk, or the error code if the read failed. iData is undefined on failure.
+    std::int16_t iResult = KOk;
+    std::uint8_t iData[ taMaxSampleLength ] = { };
+};
+
+struct TI2CSamplerStatistics
+{
+    std::uint64_t iTransactions = 0;
+    std::uint64_t iFailedTransactions = 0;
+    std::uint64_t iSamples = 0;
+    /// @brief The samples lost because the consumer did not keep up.
+    std::uint64_t iDroppedSamples = 0;
+    /// @brief The sampling periods skipped because the reads were late by a whole period.
+    std::uint64_t iOverruns = 0;
+};
+
+/**
+ * @brief Samples the device registers periodically on the single thread.
+ *
+ * Every RunOnce() call reads all the channels that are due. The due channels of the same device
+ * whose register ranges are adjacent or overlapping are read by a single batched transaction
+ * (the register address write followed by the repeated-start read). The samples are timestamped
+ * and appended to the lock-free single-producer single-consumer ring, which the consumer drains
+ * in bulk with ReadSamples().
+ *
+ * Channels are added before the sampling is started. RunOnce() and Run() are called from the
+ * single sampling thread and ReadSamples() from the single consumer thread.
+ *
+ * @tparam taClock The clock type providing TNanoseconds Now() (e.g. CSteadyClock).
+ * @tparam taMaxChannels The maximum count of channels.
+ * @tparam taMaxSampleLength The maximum length of the single channel read.
+ * @tparam taRingCapacity The count of the samples the ring holds. Has to be a power of 2.
+ * @tparam taMaxBatchLength The maximum length of the batched read.
+ */
+template < typename taClock,
+           size_t taMaxChannels = 16,
+           size_t taMaxSampleLength = 8,
+           size_t taRingCapacity = 256,
+           size_t taMaxBatchLength = 32 >
+class CI2CSampler
+{
+public:
+    static_assert( taMaxChannels > 0 && taMaxChannels <= 256,
+                   "taMaxChannels has to be in range [1, 256]" );
+    static_assert( taMaxSampleLength <= taMaxBatchLength,
+                   "taMaxSampleLength has to be <= taMaxBatchLength" );
+
+    using TSample = TI2CSample< taMaxSampleLength >;
+
+    CI2CSampler( CI2CBus& aI2CBus, const taClock& aClock )
+        : iI2CBus{ aI2CBus }
+        , iClock{ aClock }
+    {
+    }
+
+    /**
+     * @brief Adds the channel.
+     *
+     * @return int The channel index reported in the samples, KInvalidArgumentError if the
+     * channel is malformed, KGenericError if there is no room for the channel.
+     */
+    int
+    AddChannel( const TI2CSamplingChannel& aChannel ) NOEXCEPT
+    {
+        if ( aChannel.iLength == 0 || aChannel.iLength > taMaxSampleLength
+             || aChannel.iPeriod == 0 )
+        {
+            return KInvalidArgumentError;
+        }
+        if ( iChannelCount == taMaxChannels )
+        {
+            return KGenericError;
+        }
+
+        auto& channel = iChannels[ iChannelCount ];
+        channel.iConfig = aChannel;
+        channel.iNextDue = iClock.Now( ) + aChannel.iPhase;
+        return static_cast< int >( iChannelCount++ );
+    }
+
+    /**
+     * @brief Reads all the channels that are due.
+     *
+     * @return TNanoseconds The time the next channel becomes due.
+     */
+    TNanoseconds
+    RunOnce( ) NOEXCEPT
+    {
+        const TNanoseconds now = iClock.Now( );
+
+        std::uint8_t due[ taMaxChannels ];
+        size_t dueCount = 0;
+        for ( size_t index = 0; index < iChannelCount; ++index )
+        {
+            if ( iChannels[ index ].iNextDue <= now )
+            {
+                Insert( due, dueCount++, static_cast< std::uint8_t >( index ) );
+            }
+        }
+
+        for ( size_t first = 0; first < dueCount; )
+        {
+            const size_t last = BatchEnd( due, first, dueCount );
+            ReadBatch( due + first, last - first );
+            first = last;
+        }
+
+        TNanoseconds nextDue = KNever;
+        for ( size_t index = 0; index < iChannelCount; ++index )
+        {
+            auto& channel = iChannels[ index ];
+            if ( channel.iNextDue <= now )
+            {
+                Reschedule( channel, now );
+            }
+            nextDue = channel.iNextDue < nextDue ? channel.iNextDue : nextDue;
+        }
+        return nextDue;
+    }
+
+    /**
+     * @brief Samples until aStop is set, sleeping between the reads with the clock SleepUntil().
+     * Requires the clock the caller can wait on (see KClockCanSleep).
+     */
+    void
+    Run( const std::atomic< bool >& aStop ) NOEXCEPT
+    {
+        static_assert( KClockCanSleep< taClock >,
+                       "Run() requires the clock providing SleepUntil()" );
+        while ( !aStop.load( std::memory_order_relaxed ) )
+        {
+            const TNanoseconds nextDue = RunOnce( );
+            const TNanoseconds now = iClock.Now( );
+            if ( nextDue > now )
+            {
+                iClock.SleepUntil( nextDue == KNever ? now + KIdleSleep : nextDue );
+            }
+        }
+    }
+
+    /**
+     * @brief Takes up to aCount oldest samples. Consumer side.
+     *
+     * @return size_t The count of the taken samples.
+     */
+    size_t
+    ReadSamples( TSample* aSamples, size_t aCount ) NOEXCEPT
+    {
+        return iSamples.Pop( aSamples, aCount );
+    }
+
+    /**
+     * @brief Returns the statistics. Sampling thread side.
+     */
+    const TI2CSamplerStatistics&
+    Statistics( ) const NOEXCEPT
+    {
+        return iStatistics;
+    }
+
+private:
+    static constexpr TNanoseconds KNever = ~TNanoseconds{ 0 };
+    static constexpr TNanoseconds KIdleSleep = 1000000;
+
+    struct TChannel
+    {
+        TI2CSamplingChannel iConfig;
+        TNanoseconds iNextDue = 0;
+    };
+
+    bool
+    Precedes( std::uint8_t aLeft, std::uint8_t aRight ) const NOEXCEPT
+    {
+        const auto& left = iChannels[ aLeft ].iConfig;
+        const auto& right = iChannels[ aRight ].iConfig;
+        return left.iDeviceAddress != right.iDeviceAddress
+                   ? left.iDeviceAddress < right.iDeviceAddress
+                   : left.iRegisterAddress < right.iRegisterAddress;
+    }
+
+    /// @brief Inserts the channel index keeping the due list ordered by device and register.
+    void
+    Insert( std::uint8_t* aDue, size_t aCount, std::uint8_t aIndex ) const NOEXCEPT
+    {
+        size_t position = aCount;
+        for ( ; position > 0 && Precedes( aIndex, aDue[ position - 1 ] ); --position )
+        {
+            aDue[ position ] = aDue[ position - 1 ];
+        }
+        aDue[ position ] = aIndex;
+    }
+
+    /// @brief Returns the end of the batch starting at aFirst within the ordered due list.
+    size_t
+    BatchEnd( const std::uint8_t* aDue, size_t aFirst, size_t aCount ) const NOEXCEPT
+    {
+        const auto& first = iChannels[ aDue[ aFirst ] ].iConfig;
+        size_t end = first.iRegisterAddress + first.iLength;
+
+        size_t last = aFirst + 1;
+        for ( ; last < aCount && first.iMergeable; ++last )
+        {
+            const auto& next = iChannels[ aDue[ last ] ].iConfig;
+            const size_t nextEnd = next.iRegisterAddress + next.iLength;
+            const size_t batchEnd = nextEnd > end ? nextEnd : end;
+            if ( !next.iMergeable || next.iDeviceAddress != first.iDeviceAddress
+                 || next.iRegisterAddress > end
+                 || batchEnd - first.iRegisterAddress > taMaxBatchLength )
+            {
+                break;
+            }
+            end = batchEnd;
+        }
+        return last;
+    }
+
+    void
+    ReadBatch( const std::uint8_t* aChannels, size_t aCount ) NOEXCEPT
+    {
+        const auto& first = iChannels[ aChannels[ 0 ] ].iConfig;
+        size_t length = 0;
+        for ( size_t i = 0; i < aCount; ++i )
+        {
+            const auto& channel = iChannels[ aChannels[ i ] ].iConfig;
+            const size_t end = channel.iRegisterAddress + channel.iLength - first.iRegisterAddress;
+            length = end > length ? end : length;
+        }
+
+        const TNanoseconds timestamp = iClock.Now( );
+        const auto result
+            = iI2CBus.WriteExact( first.iDeviceAddress, &first.iRegisterAddress, 1, true )
+                  .AndThen( [ & ]( ) {
+                      return iI2CBus.ReadExact( first.iDeviceAddress, iBatch, length );
+                  } );
+        const bool succeed = result.HasValue( );
+
+        ++iStatistics.iTransactions;
+        iStatistics.iFailedTransactions += !succeed;
+
+        for ( size_t i = 0; i < aCount; ++i )
+        {
+            const auto& channel = iChannels[ aChannels[ i ] ].iConfig;
+
+            TSample sample;
+            sample.iTimestamp = timestamp;
+            sample.iChannel = aChannels[ i ];
+            sample.iLength = channel.iLength;
+            sample.iResult = static_cast< std::int16_t >( ToErrorCode( result ) );
+            std::memcpy( sample.iData, iBatch + channel.iRegisterAddress - first.iRegisterAddress,
+                         channel.iLength );
+
+            ++iStatistics.iSamples;
+            iStatistics.iDroppedSamples += !iSamples.Push( sample );
+        }
+    }
+
+    void
+    Reschedule( TChannel& aChannel, TNanoseconds aNow ) NOEXCEPT
+    {
+        // Keep the sampling grid instead of drifting by the read latency, skipping the periods
+        // that have already passed.
+        const TNanoseconds period = aChannel.iConfig.iPeriod;
+        aChannel.iNextDue += period;
+        if ( aChannel.iNextDue <= aNow )
+        {
+            const TNanoseconds skipped = ( aNow - aChannel.iNextDue ) / period + 1;
+            aChannel.iNextDue += skipped * period;
+            iStatistics.iOverruns += skipped;
+        }
+    }
+
+    CI2CBus& iI2CBus;
+    const taClock& iClock;
+    TChannel iChannels[ taMaxChannels ];
+    size_t iChannelCount = 0;
+    std::uint8_t iBatch[ taMaxBatchLength ];
+    TI2CSamplerStatistics iStatistics;
+    TSpscRing< TSample, taRingCapacity > iSamples;
+};
+
+}  // namespace AbstractPlatform
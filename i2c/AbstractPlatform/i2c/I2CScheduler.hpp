@@ -0,0 +1,371 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Clock.hpp>
+#include <AbstractPlatform/common/ErrorCode.hpp>
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace AbstractPlatform
+{
+/// @brief The deadline of the transaction that has no deadline.
+static constexpr TNanoseconds KNoDeadline = std::numeric_limits< TNanoseconds >::max( );
+
+/**
+ * @brief The transaction executed by the CI2CScheduler.
+ *
+ * The transaction consists of the optional prefix (the register address or the controller
+ * command/data selector) followed by the data phase:
+ *  - Read: the prefix is written without a Stop, then iDataLength bytes are read into
+ *    iDestination. Reads are never split.
+ *  - Write: the prefix and iDataLength bytes of iSource are written as a single transfer. If
+ *    iChunkLength is not 0, the data is split into chunks of at most iChunkLength bytes, each sent
+ *    as a separate transfer starting with the prefix, so that other transactions may be executed
+ *    between the chunks.
+ *
+ * The transaction object and the buffers it refers to are owned by the caller and have to stay
+ * alive until the transaction state becomes Done or Failed.
+ */
+struct TI2CScheduledTransaction
+{
+    std::uint8_t iDeviceAddress = 0;
+    TI2CDirection iDirection = TI2CDirection::Write;
+    const std::uint8_t* iPrefix = nullptr;
+    size_t iPrefixLength = 0;
+    const std::uint8_t* iSource = nullptr;
+    std::uint8_t* iDestination = nullptr;
+    size_t iDataLength = 0;
+    size_t iChunkLength = 0;
+
+    /// @brief The priority class, the higher value is more urgent whatever the deadlines are.
+    std::uint8_t iPriority = 0;
+    TNanoseconds iDeadline = KNoDeadline;
+    std::uint8_t iClientId = 0;
+
+    // Maintained by the scheduler
+    TI2CTransactionState iState = TI2CTransactionState::Idle;
+    size_t iTransferred = 0;
+    TErrorCode iResult = KOk;
+    TNanoseconds iCompletedAt = 0;
+    std::uint32_t iSequence = 0;
+};
+
+/// @brief The bus usage statistics of a single scheduler client.
+struct TI2CClientUtilisation
+{
+    /// @brief The time spent on the bus by the client's transfers.
+    TNanoseconds iBusyTime = 0;
+    /// @brief The count of the data bytes transferred, prefixes excluded.
+    std::uint64_t iBytes = 0;
+    std::uint32_t iTransactions = 0;
+    std::uint32_t iFailedTransactions = 0;
+    std::uint32_t iDeadlineMisses = 0;
+};
+
+/**
+ * @brief Shares the single I2C bus between several clients by scheduling their transactions.
+ *
+ * Every RunOnce() call executes a single step: either a whole non-preemptible transaction or a
+ * single chunk of a preemptible write. The step is taken from the pending transaction of the
+ * highest priority class; within the class the earliest deadline goes first (the transactions
+ * without a deadline go last) and then the submission order. A long display frame submitted as a
+ * chunked write therefore occupies the bus for one chunk at a time and urgent sensor reads are
+ * interleaved between its chunks.
+ *
+ * The scheduler is not thread-safe: Submit() and RunOnce() are expected to be called from the
+ * thread owning the bus.
+ *
+ * @tparam taClock The clock type providing TNanoseconds Now() (e.g. CSteadyClock).
+ * @tparam taMaxPending The maximum count of pending transactions.
+ * @tparam taMaxClients The maximum count of clients. Client ids are in range [0, taMaxClients).
+ * @tparam taScratchLength The size of the buffer a prefix is combined with the data in.
+ */
+template < typename taClock,
+           size_t taMaxPending = 16,
+           size_t taMaxClients = 8,
+           size_t taScratchLength = 64 >
+class CI2CScheduler
+{
+public:
+    static_assert( taMaxPending > 0, "taMaxPending has to be > 0" );
+    static_assert( taMaxClients > 0, "taMaxClients has to be > 0" );
+
+    CI2CScheduler( IAbstractI2CBus& aI2CBus, const taClock& aClock )
+        : iI2CBus{ aI2CBus }
+        , iClock{ aClock }
+        , iStatisticsStart{ aClock.Now( ) }
+    {
+    }
+
+    /**
+     * @brief Enqueues the transaction.
+     *
+     * @param aTransaction The transaction to enqueue.
+     * @return TErrorCode KOk on success, KInvalidArgumentError if the transaction is malformed or
+     * already pending, KGenericError if the pending queue is full.
+     */
+    TErrorCode
+    Submit( TI2CScheduledTransaction& aTransaction ) NOEXCEPT
+    {
+        if ( !IsValid( aTransaction ) )
+        {
+            return KInvalidArgumentError;
+        }
+        if ( iPendingCount == taMaxPending )
+        {
+            return KGenericError;
+        }
+
+        aTransaction.iState = TI2CTransactionState::Pending;
+        aTransaction.iTransferred = 0;
+        aTransaction.iResult = KOk;
+        aTransaction.iSequence = iNextSequence++;
+        iPending[ iPendingCount++ ] = &aTransaction;
+        return KOk;
+    }
+
+    /**
+     * @brief Executes the next scheduling step.
+     *
+     * @return true If a step was executed, false if there was nothing pending.
+     */
+    bool
+    RunOnce( ) NOEXCEPT
+    {
+        if ( iPendingCount == 0 )
+        {
+            return false;
+        }
+
+        const size_t index = SelectNext( );
+        auto& transaction = *iPending[ index ];
+        transaction.iState = TI2CTransactionState::InProgress;
+
+        const TNanoseconds start = iClock.Now( );
+        const TErrorCode result = transaction.iDirection == TI2CDirection::Read
+                                      ? ExecuteRead( transaction )
+                                      : ExecuteWriteStep( transaction );
+        const TNanoseconds end = iClock.Now( );
+
+        auto& utilisation = iUtilisation[ transaction.iClientId ];
+        utilisation.iBusyTime += end - start;
+
+        if ( result != KOk || transaction.iTransferred == transaction.iDataLength )
+        {
+            transaction.iResult = result;
+            transaction.iCompletedAt = end;
+            transaction.iState = result == KOk ? TI2CTransactionState::Done
+                                               : TI2CTransactionState::Failed;
+
+            ++utilisation.iTransactions;
+            utilisation.iFailedTransactions += result != KOk;
+            utilisation.iDeadlineMisses += end > transaction.iDeadline;
+
+            iPending[ index ] = iPending[ --iPendingCount ];
+        }
+        else
+        {
+            transaction.iState = TI2CTransactionState::Pending;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Executes the scheduling steps until there is nothing pending.
+     *
+     * @return size_t The count of the executed steps.
+     */
+    size_t
+    RunUntilIdle( ) NOEXCEPT
+    {
+        size_t steps = 0;
+        while ( RunOnce( ) )
+        {
+            ++steps;
+        }
+        return steps;
+    }
+
+    size_t
+    PendingCount( ) const NOEXCEPT
+    {
+        return iPendingCount;
+    }
+
+    /**
+     * @brief Returns the bus usage statistics of the client since the last statistics reset.
+     */
+    const TI2CClientUtilisation&
+    Utilisation( std::uint8_t aClientId ) const NOEXCEPT
+    {
+        assert( aClientId < taMaxClients );
+        return iUtilisation[ aClientId ];
+    }
+
+    /**
+     * @brief Returns the share of the time the client occupied the bus since the last statistics
+     * reset.
+     *
+     * @return double The bus utilisation in range [0, 1].
+     */
+    double
+    UtilisationRatio( std::uint8_t aClientId ) const NOEXCEPT
+    {
+        const TNanoseconds elapsed = iClock.Now( ) - iStatisticsStart;
+        return elapsed == 0 ? 0.0
+                            : static_cast< double >( Utilisation( aClientId ).iBusyTime )
+                                  / static_cast< double >( elapsed );
+    }
+
+    void
+    ResetStatistics( ) NOEXCEPT
+    {
+        for ( auto& utilisation : iUtilisation )
+        {
+            utilisation = TI2CClientUtilisation{ };
+        }
+        iStatisticsStart = iClock.Now( );
+    }
+
+private:
+    bool
+    IsValid( const TI2CScheduledTransaction& aTransaction ) const NOEXCEPT
+    {
+        if ( aTransaction.iState == TI2CTransactionState::Pending
+             || aTransaction.iState == TI2CTransactionState::InProgress
+             || aTransaction.iClientId >= taMaxClients
+             || ( aTransaction.iPrefixLength > 0 && aTransaction.iPrefix == nullptr ) )
+        {
+            return false;
+        }
+
+        if ( aTransaction.iDirection == TI2CDirection::Read )
+        {
+            return aTransaction.iDestination != nullptr || aTransaction.iDataLength == 0;
+        }
+
+        if ( aTransaction.iSource == nullptr && aTransaction.iDataLength != 0 )
+        {
+            return false;
+        }
+
+        // A write with a prefix is combined in the scratch buffer, one chunk at a time.
+        const size_t maxChunkLength
+            = aTransaction.iChunkLength == 0 || aTransaction.iChunkLength > aTransaction.iDataLength
+                  ? aTransaction.iDataLength
+                  : aTransaction.iChunkLength;
+        return aTransaction.iPrefixLength == 0
+               || aTransaction.iPrefixLength + maxChunkLength <= taScratchLength;
+    }
+
+    static size_t
+    ChunkLength( const TI2CScheduledTransaction& aTransaction ) NOEXCEPT
+    {
+        const size_t remaining = aTransaction.iDataLength - aTransaction.iTransferred;
+        if ( aTransaction.iChunkLength == 0 || aTransaction.iChunkLength > remaining )
+        {
+            return remaining;
+        }
+        return aTransaction.iChunkLength;
+    }
+
+    static bool
+    IsMoreUrgent( const TI2CScheduledTransaction& aLeft,
+                  const TI2CScheduledTransaction& aRight ) NOEXCEPT
+    {
+        if ( aLeft.iPriority != aRight.iPriority )
+        {
+            return aLeft.iPriority > aRight.iPriority;
+        }
+        if ( aLeft.iDeadline != aRight.iDeadline )
+        {
+            return aLeft.iDeadline < aRight.iDeadline;
+        }
+        // Wrap-around safe submission order comparison
+        return static_cast< std::int32_t >( aLeft.iSequence - aRight.iSequence ) < 0;
+    }
+
+    size_t
+    SelectNext( ) const NOEXCEPT
+    {
+        size_t selected = 0;
+        for ( size_t i = 1; i < iPendingCount; ++i )
+        {
+            if ( IsMoreUrgent( *iPending[ i ], *iPending[ selected ] ) )
+            {
+                selected = i;
+            }
+        }
+        return selected;
+    }
+
+    TErrorCode
+    ExecuteRead( TI2CScheduledTransaction& aTransaction ) NOEXCEPT
+    {
+        const int prefixLength = static_cast< int >( aTransaction.iPrefixLength );
+        if ( prefixLength > 0
+             && iI2CBus.Write( aTransaction.iDeviceAddress, aTransaction.iPrefix,
+                               aTransaction.iPrefixLength, true )
+                    != prefixLength )
+        {
+            return KGenericError;
+        }
+
+        const int dataLength = static_cast< int >( aTransaction.iDataLength );
+        if ( iI2CBus.Read( aTransaction.iDeviceAddress, aTransaction.iDestination,
+                           aTransaction.iDataLength, false )
+             != dataLength )
+        {
+            return KGenericError;
+        }
+
+        aTransaction.iTransferred = aTransaction.iDataLength;
+        iUtilisation[ aTransaction.iClientId ].iBytes += aTransaction.iDataLength;
+        return KOk;
+    }
+
+    TErrorCode
+    ExecuteWriteStep( TI2CScheduledTransaction& aTransaction ) NOEXCEPT
+    {
+        const size_t chunkLength = ChunkLength( aTransaction );
+        const std::uint8_t* chunk = aTransaction.iSource + aTransaction.iTransferred;
+
+        const std::uint8_t* transfer = chunk;
+        size_t transferLength = chunkLength;
+        if ( aTransaction.iPrefixLength > 0 )
+        {
+            std::memcpy( iScratch, aTransaction.iPrefix, aTransaction.iPrefixLength );
+            if ( chunkLength > 0 )
+            {
+                std::memcpy( iScratch + aTransaction.iPrefixLength, chunk, chunkLength );
+            }
+            transfer = iScratch;
+            transferLength += aTransaction.iPrefixLength;
+        }
+
+        if ( iI2CBus.Write( aTransaction.iDeviceAddress, transfer, transferLength, false )
+             != static_cast< int >( transferLength ) )
+        {
+            return KGenericError;
+        }
+
+        aTransaction.iTransferred += chunkLength;
+        iUtilisation[ aTransaction.iClientId ].iBytes += chunkLength;
+        return KOk;
+    }
+
+    IAbstractI2CBus& iI2CBus;
+    const taClock& iClock;
+    TI2CScheduledTransaction* iPending[ taMaxPending ] = { };
+    size_t iPendingCount = 0;
+    std::uint32_t iNextSequence = 0;
+    TI2CClientUtilisation iUtilisation[ taMaxClients ] = { };
+    TNanoseconds iStatisticsStart = 0;
+    std::uint8_t iScratch[ taScratchLength ];
+};
+
+}  // namespace AbstractPlatform
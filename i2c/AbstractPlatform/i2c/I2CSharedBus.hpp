@@ -0,0 +1,378 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Clock.hpp>
+#include <AbstractPlatform/common/ErrorCode.hpp>
+#include <AbstractPlatform/common/MpscQueue.hpp>
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace AbstractPlatform
+{
+/// @brief The single transfer of the CI2CSharedBus transaction.
+struct TI2CSegment
+{
+    TI2CDirection iDirection = TI2CDirection::Write;
+    const std::uint8_t* iSource = nullptr;
+    std::uint8_t* iDestination = nullptr;
+    size_t iLength = 0;
+};
+
+/**
+ * @brief The transaction executed by the CI2CSharedBus: the segments are transferred to the
+ * device back to back, joined by the Restart conditions, so no other transaction can get between
+ * them.
+ *
+ * The transaction object and the buffers it refers to are owned by the submitter and have to stay
+ * alive until the transaction state becomes Done or Failed.
+ */
+struct TI2CSharedTransaction : public TMpscNode
+{
+    std::uint8_t iDeviceAddress = 0;
+    const TI2CSegment* iSegments = nullptr;
+    size_t iSegmentCount = 0;
+
+    // Maintained by the shared bus
+    std::atomic< TI2CTransactionState > iState{ TI2CTransactionState::Idle };
+    /// @brief KOk, or the value returned by the bus for the segment that failed.
+    int iResult = KOk;
+    size_t iCompletedSegments = 0;
+    TNanoseconds iSubmittedAt = 0;
+
+    bool
+    IsCompleted( ) const NOEXCEPT
+    {
+        const auto state = iState.load( std::memory_order_acquire );
+        return state == TI2CTransactionState::Done || state == TI2CTransactionState::Failed;
+    }
+
+    /**
+     * @brief Waits for the transaction completion spinning and yielding the CPU.
+     */
+    void
+    Wait( ) const NOEXCEPT
+    {
+        for ( unsigned spin = 0; !IsCompleted( ); ++spin )
+        {
+            if ( spin >= KSpinCount )
+            {
+                std::this_thread::yield( );
+            }
+        }
+    }
+
+private:
+    static constexpr unsigned KSpinCount = 64;
+};
+
+struct TI2CSharedBusStatistics
+{
+    /// @brief The count of the submitted transactions waiting for the execution.
+    std::uint32_t iQueueDepth = 0;
+    std::uint32_t iMaxQueueDepth = 0;
+    std::uint64_t iTransactions = 0;
+    std::uint64_t iFailedTransactions = 0;
+    /// @brief The time from the submission to the execution start, summed over the transactions.
+    TNanoseconds iTotalWaitTime = 0;
+    TNanoseconds iMaxWaitTime = 0;
+};
+
+/**
+ * @brief Shares the bus between threads without a lock.
+ *
+ * Any thread submits transactions into the lock-free multi-producer queue, and the single owner
+ * thread executes them in submission order by calling ProcessPending() (or Run()). Only the owner
+ * thread touches the decorated bus, so submitters never hand a lock over to each other.
+ *
+ * @tparam taClock The clock type providing TNanoseconds Now() (e.g. CSteadyClock). Has to be
+ * callable from any thread.
+ */
+template < typename taClock >
+class CI2CSharedBus
+{
+public:
+    CI2CSharedBus( IAbstractI2CBus& aI2CBus, const taClock& aClock )
+        : iI2CBus{ aI2CBus }
+        , iClock{ aClock }
+    {
+    }
+
+    /**
+     * @brief Enqueues the transaction. Callable from any thread.
+     *
+     * @return TErrorCode KOk on success, KInvalidArgumentError if the transaction is malformed or
+     * still pending.
+     */
+    TErrorCode
+    Submit( TI2CSharedTransaction& aTransaction ) NOEXCEPT
+    {
+        const auto state = aTransaction.iState.load( std::memory_order_acquire );
+        if ( aTransaction.iSegments == nullptr || aTransaction.iSegmentCount == 0
+             || state == TI2CTransactionState::Pending
+             || state == TI2CTransactionState::InProgress )
+        {
+            return KInvalidArgumentError;
+        }
+
+        aTransaction.iResult = KOk;
+        aTransaction.iCompletedSegments = 0;
+        aTransaction.iSubmittedAt = iClock.Now( );
+        aTransaction.iState.store( TI2CTransactionState::Pending, std::memory_order_relaxed );
+
+        const std::uint32_t depth = iQueueDepth.fetch_add( 1, std::memory_order_seq_cst ) + 1;
+        std::uint32_t maxDepth = iMaxQueueDepth.load( std::memory_order_relaxed );
+        while ( depth > maxDepth
+                && !iMaxQueueDepth.compare_exchange_weak( maxDepth, depth,
+                                                          std::memory_order_relaxed ) )
+        {
+        }
+
+        iQueue.Push( aTransaction );
+        if ( iIsOwnerSleeping.load( std::memory_order_seq_cst ) )
+        {
+            {
+                std::lock_guard< std::mutex > lock{ iSleepMutex };
+            }
+            iWakeUp.notify_one( );
+        }
+        return KOk;
+    }
+
+    /**
+     * @brief Executes the queued transactions. Owner thread side.
+     *
+     * @return size_t The count of the executed transactions.
+     */
+    size_t
+    ProcessPending( ) NOEXCEPT
+    {
+        size_t count = 0;
+        for ( TI2CSharedTransaction* transaction = iQueue.Pop( ); transaction != nullptr;
+              transaction = iQueue.Pop( ) )
+        {
+            iQueueDepth.fetch_sub( 1, std::memory_order_relaxed );
+            Execute( *transaction );
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Executes the transactions until aStop is set. Owner thread side.
+     *
+     * Once the queue stays empty for a while the owner thread sleeps until a transaction is
+     * submitted. aStop is not signalled, so it is polled every KIdlePollPeriod while sleeping.
+     */
+    void
+    Run( const std::atomic< bool >& aStop ) NOEXCEPT
+    {
+        unsigned idleSpins = 0;
+        while ( !aStop.load( std::memory_order_relaxed ) )
+        {
+            if ( ProcessPending( ) > 0 )
+            {
+                idleSpins = 0;
+                continue;
+            }
+            if ( ++idleSpins < KSpinsBeforeSleep )
+            {
+                std::this_thread::yield( );
+                continue;
+            }
+
+            // Submit() increments iQueueDepth before checking iIsOwnerSleeping, so either the
+            // owner sees the transaction or the submitter sees the sleeper and notifies under
+            // the lock.
+            std::unique_lock< std::mutex > lock{ iSleepMutex };
+            iIsOwnerSleeping.store( true, std::memory_order_seq_cst );
+            iWakeUp.wait_for( lock, KIdlePollPeriod, [ this, &aStop ]( ) {
+                return iQueueDepth.load( std::memory_order_seq_cst ) > 0
+                       || aStop.load( std::memory_order_relaxed );
+            } );
+            iIsOwnerSleeping.store( false, std::memory_order_relaxed );
+            idleSpins = 0;
+        }
+        ProcessPending( );
+    }
+
+    /**
+     * @brief Returns the statistics snapshot. Callable from any thread.
+     */
+    TI2CSharedBusStatistics
+    Statistics( ) const NOEXCEPT
+    {
+        TI2CSharedBusStatistics statistics;
+        statistics.iQueueDepth = iQueueDepth.load( std::memory_order_relaxed );
+        statistics.iMaxQueueDepth = iMaxQueueDepth.load( std::memory_order_relaxed );
+        statistics.iTransactions = iTransactions.load( std::memory_order_relaxed );
+        statistics.iFailedTransactions = iFailedTransactions.load( std::memory_order_relaxed );
+        statistics.iTotalWaitTime = iTotalWaitTime.load( std::memory_order_relaxed );
+        statistics.iMaxWaitTime = iMaxWaitTime.load( std::memory_order_relaxed );
+        return statistics;
+    }
+
+private:
+    static constexpr unsigned KSpinsBeforeSleep = 64;
+    static constexpr std::chrono::milliseconds KIdlePollPeriod{ 10 };
+
+    void
+    Execute( TI2CSharedTransaction& aTransaction ) NOEXCEPT
+    {
+        aTransaction.iState.store( TI2CTransactionState::InProgress, std::memory_order_relaxed );
+
+        const TNanoseconds wait = iClock.Now( ) - aTransaction.iSubmittedAt;
+        iTotalWaitTime.store( iTotalWaitTime.load( std::memory_order_relaxed ) + wait,
+                              std::memory_order_relaxed );
+        if ( wait > iMaxWaitTime.load( std::memory_order_relaxed ) )
+        {
+            iMaxWaitTime.store( wait, std::memory_order_relaxed );
+        }
+
+        for ( size_t index = 0; index < aTransaction.iSegmentCount; ++index )
+        {
+            const auto& segment = aTransaction.iSegments[ index ];
+            const bool noStop = index + 1 < aTransaction.iSegmentCount;
+            const int result
+                = segment.iDirection == TI2CDirection::Write
+                      ? iI2CBus.Write( aTransaction.iDeviceAddress, segment.iSource,
+                                       segment.iLength, noStop )
+                      : iI2CBus.Read( aTransaction.iDeviceAddress, segment.iDestination,
+                                      segment.iLength, noStop );
+            if ( result != static_cast< int >( segment.iLength ) )
+            {
+                aTransaction.iResult = result < 0 ? result : KGenericError;
+                break;
+            }
+            ++aTransaction.iCompletedSegments;
+        }
+
+        const bool succeed = aTransaction.iResult == KOk;
+        iTransactions.store( iTransactions.load( std::memory_order_relaxed ) + 1,
+                             std::memory_order_relaxed );
+        if ( !succeed )
+        {
+            iFailedTransactions.store( iFailedTransactions.load( std::memory_order_relaxed ) + 1,
+                                       std::memory_order_relaxed );
+        }
+
+        // Publishes the results and the received data to the waiting submitter.
+        aTransaction.iState.store( succeed ? TI2CTransactionState::Done
+                                           : TI2CTransactionState::Failed,
+                                   std::memory_order_release );
+    }
+
+    IAbstractI2CBus& iI2CBus;
+    const taClock& iClock;
+    TMpscQueue< TI2CSharedTransaction > iQueue;
+
+    alignas( KCacheLineSize ) std::atomic< std::uint32_t > iQueueDepth{ 0 };
+    std::atomic< std::uint32_t > iMaxQueueDepth{ 0 };
+    std::atomic< bool > iIsOwnerSleeping{ false };
+    std::mutex iSleepMutex;
+    std::condition_variable iWakeUp;
+
+    // Written by the owner thread only
+    alignas( KCacheLineSize ) std::atomic< std::uint64_t > iTransactions{ 0 };
+    std::atomic< std::uint64_t > iFailedTransactions{ 0 };
+    std::atomic< TNanoseconds > iTotalWaitTime{ 0 };
+    std::atomic< TNanoseconds > iMaxWaitTime{ 0 };
+};
+
+/**
+ * @brief The IAbstractI2CBus front end of the CI2CSharedBus for a single client thread, so the
+ * existing drivers (e.g. through CI2CBus) share the bus unchanged.
+ *
+ * The transfers requested with aNoStop are collected and submitted together with the terminating
+ * transfer as a single transaction, keeping the restart sequences atomic. The collected transfers
+ * report the requested length immediately; the terminating transfer blocks until the transaction
+ * is executed and returns KGenericError (or the bus error) if any of the transfers failed. The
+ * buffers of the collected reads are filled when the terminating transfer returns.
+ *
+ * @tparam taClock The clock type of the shared bus.
+ * @tparam taMaxSegments The maximum count of the transfers in a single transaction.
+ */
+template < typename taClock, size_t taMaxSegments = 4 >
+class CI2CSharedBusClient : public IAbstractI2CBus
+{
+public:
+    static_assert( taMaxSegments > 0, "taMaxSegments has to be > 0" );
+
+    explicit CI2CSharedBusClient( CI2CSharedBus< taClock >& aSharedBus )
+        : iSharedBus{ aSharedBus }
+    {
+    }
+
+    int
+    Write( std::uint8_t aDeviceAddress,
+           const std::uint8_t* aDataSource,
+           size_t aDataLength,
+           bool aNoStop ) NOEXCEPT override
+    {
+        TI2CSegment segment;
+        segment.iDirection = TI2CDirection::Write;
+        segment.iSource = aDataSource;
+        segment.iLength = aDataLength;
+        return Transfer( aDeviceAddress, segment, aNoStop );
+    }
+
+    int
+    Read( std::uint8_t aDeviceAddress,
+          std::uint8_t* aDataDestination,
+          size_t aDataLength,
+          bool aNoStop ) NOEXCEPT override
+    {
+        TI2CSegment segment;
+        segment.iDirection = TI2CDirection::Read;
+        segment.iDestination = aDataDestination;
+        segment.iLength = aDataLength;
+        return Transfer( aDeviceAddress, segment, aNoStop );
+    }
+
+private:
+    int
+    Transfer( std::uint8_t aDeviceAddress, const TI2CSegment& aSegment, bool aNoStop ) NOEXCEPT
+    {
+        if ( iSegmentCount == taMaxSegments
+             || ( iSegmentCount > 0 && iTransaction.iDeviceAddress != aDeviceAddress ) )
+        {
+            // The restart sequence is too long or addresses another device, so it can not be
+            // expressed by a single transaction: the collected part is dropped.
+            iSegmentCount = 0;
+            return KGenericError;
+        }
+
+        iTransaction.iDeviceAddress = aDeviceAddress;
+        iSegments[ iSegmentCount++ ] = aSegment;
+        if ( aNoStop )
+        {
+            return static_cast< int >( aSegment.iLength );
+        }
+
+        iTransaction.iSegments = iSegments;
+        iTransaction.iSegmentCount = iSegmentCount;
+        iSegmentCount = 0;
+
+        const TErrorCode result = iSharedBus.Submit( iTransaction );
+        if ( result != KOk )
+        {
+            return result;
+        }
+        iTransaction.Wait( );
+
+        return iTransaction.iResult == KOk ? static_cast< int >( aSegment.iLength )
+                                           : iTransaction.iResult;
+    }
+
+    CI2CSharedBus< taClock >& iSharedBus;
+    TI2CSharedTransaction iTransaction;
+    TI2CSegment iSegments[ taMaxSegments ];
+    size_t iSegmentCount = 0;
+};
+
+}  // namespace AbstractPlatform
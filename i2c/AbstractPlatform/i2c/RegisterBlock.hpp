@@ -0,0 +1,150 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/TypeBinaryRepresentation.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace AbstractPlatform
+{
+namespace Detail
+{
+template < typename taMemberPointer >
+struct TMemberPointerTraits;
+
+template < typename taClass, typename taMember >
+struct TMemberPointerTraits< taMember taClass::* >
+{
+    using TClass = taClass;
+    using TMember = taMember;
+};
+
+/// @brief Whether the field describes a member of taStruct. Paddings have no destination
+/// structure and belong to any block.
+template < typename taField, typename taStruct, typename = void >
+struct TFieldBelongsTo : std::true_type
+{
+};
+
+template < typename taField, typename taStruct >
+struct TFieldBelongsTo< taField, taStruct, std::void_t< typename taField::TStruct > >
+    : std::is_same< typename taField::TStruct, taStruct >
+{
+};
+}  // namespace Detail
+
+/**
+ * @brief Describes a single field of a register block: the structure member the field is decoded
+ * into and the byte order the device uses on the wire.
+ *
+ * The member may be a scalar or a one-dimensional array of scalars (e.g. std::int16_t iAxis[ 3 ]),
+ * in which case every array element is converted separately.
+ *
+ * @tparam taMember The pointer to the destination structure member.
+ * @tparam taEndianness The wire endianness of the field.
+ */
+template < auto taMember, Endianness taEndianness = Endianness::Native >
+struct TRegisterBlockField
+{
+    using TStruct = typename Detail::TMemberPointerTraits< decltype( taMember ) >::TClass;
+    using TMember = typename Detail::TMemberPointerTraits< decltype( taMember ) >::TMember;
+    using TElement = std::remove_all_extents_t< TMember >;
+
+    static_assert( std::is_trivially_copyable< TMember >::value,
+                   "The register block field has to be trivially copyable" );
+    static_assert( std::rank< TMember >::value <= 1,
+                   "Only scalar and one-dimensional array fields are supported" );
+
+    static constexpr size_t kSize = sizeof( TMember );
+
+    /**
+     * @brief Decodes the field from the wire bytes straight into the destination structure.
+     *
+     * @param aWire Not null pointer to the first wire byte of the field.
+     * @param aDestination The structure to decode the field into.
+     */
+    static inline void
+    Decode( const std::uint8_t* aWire, TStruct& aDestination ) NOEXCEPT
+    {
+        auto& member = aDestination.*taMember;
+        std::memcpy( &member, aWire, kSize );
+
+        if constexpr ( taEndianness != Endianness::Native )
+        {
+            EndiannessConverter< Endianness::Native, taEndianness >::ConvertInPlace(
+                reinterpret_cast< TElement* >( &member ), kSize / sizeof( TElement ) );
+        }
+    }
+};
+
+/**
+ * @brief Describes the wire bytes of a register block that have no destination field (reserved
+ * or unused registers located between the fields of interest).
+ *
+ * @tparam taSize The count of bytes to skip.
+ */
+template < size_t taSize >
+struct TRegisterBlockPadding
+{
+    static constexpr size_t kSize = taSize;
+
+    template < typename taStruct >
+    static constexpr inline void
+    Decode( const std::uint8_t*, taStruct& ) NOEXCEPT
+    {
+    }
+};
+
+/**
+ * @brief Describes at compile time a contiguous range of device registers that is read at once
+ * with the register address auto-increment.
+ *
+ * The fields are listed in the wire order. The wire size of the block is the sum of the field
+ * sizes, so it is independent of the padding the compiler inserts into the destination structure.
+ *
+ * Example:
+ * @code
+ * struct TAcceleration
+ * {
+ *     std::int16_t iX;
+ *     std::int16_t iY;
+ *     std::int16_t iZ;
+ * };
+ *
+ * using TAccelerationBlock
+ *     = TRegisterBlock< TAcceleration,
+ *                       TRegisterBlockField< &TAcceleration::iX, Endianness::Big >,
+ *                       TRegisterBlockField< &TAcceleration::iY, Endianness::Big >,
+ *                       TRegisterBlockField< &TAcceleration::iZ, Endianness::Big > >;
+ * @endcode
+ *
+ * @tparam taStruct The destination structure type.
+ * @tparam taFields The list of TRegisterBlockField and TRegisterBlockPadding in the wire order.
+ */
+template < typename taStruct, typename... taFields >
+struct TRegisterBlock
+{
+    using TStruct = taStruct;
+
+    static_assert( sizeof...( taFields ) > 0, "The register block has to contain fields" );
+    static_assert( ( ... && Detail::TFieldBelongsTo< taFields, taStruct >::value ),
+                   "Every register block field has to be a member of the block structure" );
+
+    static constexpr size_t kSize = ( ... + taFields::kSize );
+
+    /**
+     * @brief Decodes the block wire bytes into the destination structure.
+     *
+     * @param aWire Not null pointer to the block wire bytes, at least kSize bytes long.
+     * @param aDestination The structure to decode the block into.
+     */
+    static inline void
+    Decode( const std::uint8_t* aWire, TStruct& aDestination ) NOEXCEPT
+    {
+        ( ( taFields::Decode( aWire, aDestination ), aWire += taFields::kSize ), ... );
+    }
+};
+
+}  // namespace AbstractPlatform
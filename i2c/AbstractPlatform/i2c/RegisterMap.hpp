@@ -0,0 +1,255 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/BinaryOperations.hpp>
+#include <AbstractPlatform/common/TypeBinaryRepresentation.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace AbstractPlatform
+{
+enum class TRegisterAccess
+{
+    ReadOnly,
+    WriteOnly,
+    ReadWrite
+};
+
+/**
+ * @brief Describes a single device register.
+ *
+ * @tparam taAddress The register address type, which determines the address width on the wire.
+ * @tparam taAddressValue The register address.
+ * @tparam taValue The register value type, which determines the register width on the wire.
+ * @tparam taEndianness The wire endianness of both the register address and the register value.
+ * @tparam taAccess The register access mode.
+ */
+template < typename taAddress,
+           taAddress taAddressValue,
+           typename taValue,
+           Endianness taEndianness = Endianness::Big,
+           TRegisterAccess taAccess = TRegisterAccess::ReadWrite >
+struct TRegister
+{
+    using TAddress = taAddress;
+    using TValue = taValue;
+
+    static_assert( std::is_unsigned< TAddress >::value,
+                   "The register address has to be of unsigned integral type" );
+    static_assert( std::is_unsigned< TValue >::value,
+                   "The register value has to be of unsigned integral type" );
+
+    static constexpr TAddress kAddress = taAddressValue;
+    static constexpr Endianness kEndianness = taEndianness;
+    static constexpr TRegisterAccess kAccess = taAccess;
+
+    static constexpr bool
+    IsReadable( )
+    {
+        return kAccess != TRegisterAccess::WriteOnly;
+    }
+
+    static constexpr bool
+    IsWritable( )
+    {
+        return kAccess != TRegisterAccess::ReadOnly;
+    }
+
+    /**
+     * @brief Converts the register address to the wire byte order.
+     */
+    static inline TAddress
+    WireAddress( ) NOEXCEPT
+    {
+        return EndiannessConverter< kEndianness, Endianness::Native >::Convert( kAddress );
+    }
+
+    /**
+     * @brief Converts the native register value to the wire byte order.
+     */
+    static inline TValue
+    ToWire( TValue aValue ) NOEXCEPT
+    {
+        return EndiannessConverter< kEndianness, Endianness::Native >::Convert( aValue );
+    }
+
+    /**
+     * @brief Converts the wire register value to the native byte order.
+     */
+    static inline TValue
+    FromWire( TValue aWireValue ) NOEXCEPT
+    {
+        return EndiannessConverter< Endianness::Native, kEndianness >::Convert( aWireValue );
+    }
+};
+
+/**
+ * @brief Declares the register map of a device sharing the address width and the endianness
+ * between all its registers.
+ *
+ * Example:
+ * @code
+ * using TMap = TRegisterMap< std::uint8_t >;
+ * using TCtrl1 = TMap::TRegister< 0x20, std::uint8_t >;
+ * using TOutputDataRate = TRegisterField< TCtrl1, 4, 4 >;
+ * using TXEnable = TRegisterField< TCtrl1, 0 >;
+ * @endcode
+ *
+ * @tparam taAddress The register address type.
+ * @tparam taEndianness The wire endianness of the register addresses and values.
+ */
+template < typename taAddress, Endianness taEndianness = Endianness::Big >
+struct TRegisterMap
+{
+    template < taAddress taAddressValue,
+               typename taValue,
+               TRegisterAccess taAccess = TRegisterAccess::ReadWrite >
+    using TRegister = AbstractPlatform::TRegister< taAddress,
+                                                   taAddressValue,
+                                                   taValue,
+                                                   taEndianness,
+                                                   taAccess >;
+};
+
+/**
+ * @brief Describes a bit field of the register.
+ *
+ * @tparam taRegister The TRegister the field belongs to.
+ * @tparam taOffset The index of the least significant bit of the field.
+ * @tparam taWidth The field width in bits.
+ * @tparam taFieldValue The type the field value is represented with (integral, bool or enum).
+ */
+template < typename taRegister,
+           size_t taOffset,
+           size_t taWidth = 1,
+           typename taFieldValue
+           = std::conditional_t< taWidth == 1, bool, typename taRegister::TValue > >
+struct TRegisterField
+{
+    using TRegister = taRegister;
+    using TValue = typename TRegister::TValue;
+    using TFieldValue = taFieldValue;
+
+    static constexpr size_t kOffset = taOffset;
+    static constexpr size_t kWidth = taWidth;
+
+    static_assert( kWidth > 0, "The field width has to be > 0" );
+    static_assert( kOffset + kWidth <= std::numeric_limits< TValue >::digits,
+                   "The field exceeds the register width" );
+
+    static constexpr TValue kMask = static_cast< TValue >(
+        ( kWidth == std::numeric_limits< TValue >::digits
+              ? std::numeric_limits< TValue >::max( )
+              : static_cast< TValue >( ( TValue{ 1 } << kWidth ) - 1u ) )
+        << kOffset );
+
+    /**
+     * @brief Extracts the field value out of the register value.
+     *
+     * @param aRegisterValue The native register value.
+     * @return constexpr TFieldValue The field value.
+     */
+    static constexpr TFieldValue
+    Get( TValue aRegisterValue )
+    {
+        if constexpr ( kWidth == 1 )
+        {
+            return static_cast< TFieldValue >( CheckBit( aRegisterValue, kOffset ) );
+        }
+        else
+        {
+            return static_cast< TFieldValue >( static_cast< TValue >( aRegisterValue & kMask )
+                                               >> kOffset );
+        }
+    }
+
+    /**
+     * @brief Replaces the field bits in the register value.
+     *
+     * @param aRegisterValue The native register value.
+     * @param aFieldValue The new field value. Bits exceeding the field width are discarded.
+     * @return constexpr TValue The updated register value.
+     */
+    static constexpr TValue
+    Set( TValue aRegisterValue, TFieldValue aFieldValue )
+    {
+        if constexpr ( kWidth == 1 )
+        {
+            return static_cast< bool >( aFieldValue ) ? SetBit( aRegisterValue, kOffset )
+                                                      : ClearBit( aRegisterValue, kOffset );
+        }
+        else
+        {
+            return static_cast< TValue >(
+                ( aRegisterValue & static_cast< TValue >( ~kMask ) )
+                | ( static_cast< TValue >( static_cast< TValue >( aFieldValue ) << kOffset )
+                    & kMask ) );
+        }
+    }
+};
+
+/**
+ * @brief Accumulates updates of several fields of the same register so that they are applied to
+ * the device with a single bus write.
+ *
+ * Example:
+ * @code
+ * i2cBus.UpdateRegister( kDeviceAddress,
+ *                        TRegisterUpdate< TCtrl1 >{ }
+ *                            .Set< TOutputDataRate >( 5 )
+ *                            .Set< TXEnable >( true ) );
+ * @endcode
+ *
+ * @tparam taRegister The TRegister to update.
+ */
+template < typename taRegister >
+struct TRegisterUpdate
+{
+    using TRegister = taRegister;
+    using TValue = typename TRegister::TValue;
+
+    static_assert( TRegister::IsWritable( ), "The register is read-only" );
+
+    template < typename taField >
+    constexpr TRegisterUpdate&
+    Set( typename taField::TFieldValue aFieldValue )
+    {
+        static_assert( std::is_same< typename taField::TRegister, TRegister >::value,
+                       "The field belongs to another register" );
+
+        iMask = static_cast< TValue >( iMask | taField::kMask );
+        iValue = taField::Set( iValue, aFieldValue );
+        return *this;
+    }
+
+    /**
+     * @brief Applies the accumulated field values to the register value.
+     *
+     * @param aRegisterValue The current native register value.
+     * @return constexpr TValue The updated register value.
+     */
+    constexpr TValue
+    Apply( TValue aRegisterValue ) const
+    {
+        return static_cast< TValue >( ( aRegisterValue & static_cast< TValue >( ~iMask ) )
+                                      | iValue );
+    }
+
+    /**
+     * @brief Checks whether the update defines every register bit, so the current register value
+     * does not have to be read back from the device.
+     */
+    constexpr bool
+    IsComplete( ) const
+    {
+        return iMask == std::numeric_limits< TValue >::max( );
+    }
+
+    TValue iMask = 0;
+    TValue iValue = 0;
+};
+
+}  // namespace AbstractPlatform
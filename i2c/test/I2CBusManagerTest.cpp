@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/i2c/I2CBusManager.hpp>
+#include <AbstractPlatform/i2c/I2CBusSimulator.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr size_t kBusCount = 4;
+constexpr std::uint8_t kDeviceAddress = 0x20;
+constexpr std::uint8_t kIdRegister = 0x0F;
+
+class CBusManagerTest : public ::testing::Test
+{
+protected:
+    void
+    SetUp( ) override
+    {
+        for ( size_t bus = 0; bus < kBusCount; ++bus )
+        {
+            for ( size_t device = 0; device < 2; ++device )
+            {
+                auto& simulatedDevice = iDevices[ bus ][ device ];
+                simulatedDevice.iRegisters[ kIdRegister ]
+                    = static_cast< std::uint8_t >( bus * 16 + device );
+                iSimulators[ bus ].Attach( kDeviceAddress + device, simulatedDevice );
+            }
+            EXPECT_EQ( iManager.AddBus( iSimulators[ bus ] ), static_cast< int >( bus ) );
+        }
+        iManager.Start( );
+    }
+
+    CI2CBusSimulator iSimulators[ kBusCount ];
+    CSimulatedRegisterDevice<> iDevices[ kBusCount ][ 2 ];
+    CI2CBusManager< 8 > iManager;
+};
+}  // namespace
+
+TEST_F( CBusManagerTest, ReadAllAcrossBuses )
+{
+    EXPECT_EQ( iManager.AddBus( iSimulators[ 0 ] ), KGenericError );
+
+    std::uint8_t ids[ kBusCount * 2 + 1 ] = { };
+    TI2CFanOutRead reads[ kBusCount * 2 + 1 ];
+    for ( size_t index = 0; index < kBusCount * 2; ++index )
+    {
+        reads[ index ].iBusIndex = static_cast< std::uint8_t >( index / 2 );
+        reads[ index ].iDeviceAddress = static_cast< std::uint8_t >( kDeviceAddress + index % 2 );
+        reads[ index ].iRegisterAddress = kIdRegister;
+        reads[ index ].iDestination = &ids[ index ];
+        reads[ index ].iLength = 1;
+    }
+    EXPECT_EQ( iManager.ReadAll( reads, kBusCount * 2 ), KOk );
+    for ( size_t index = 0; index < kBusCount * 2; ++index )
+    {
+        EXPECT_EQ( ids[ index ], ( index / 2 ) * 16 + index % 2 );
+    }
+
+    reads[ kBusCount * 2 ] = reads[ 0 ];
+    reads[ kBusCount * 2 ].iDeviceAddress = 0x70;
+    EXPECT_EQ( iManager.ReadAll( reads, kBusCount * 2 + 1 ), KGenericError );
+    EXPECT_EQ( reads[ 0 ].iResult, KOk );
+    EXPECT_EQ( reads[ kBusCount * 2 ].iResult, KGenericError );
+
+    reads[ 0 ].iBusIndex = kBusCount;
+    EXPECT_EQ( iManager.ReadAll( reads, 1 ), KInvalidArgumentError );
+}
+
+TEST_F( CBusManagerTest, ExecutorPerBus )
+{
+    std::thread::id threads[ kBusCount ];
+    iManager.ForEachBus( [ &threads ]( size_t aBusIndex, IAbstractI2CBus& ) {
+        threads[ aBusIndex ] = std::this_thread::get_id( );
+    } );
+    for ( size_t bus = 0; bus < kBusCount; ++bus )
+    {
+        EXPECT_NE( threads[ bus ], std::this_thread::get_id( ) );
+        for ( size_t other = bus + 1; other < kBusCount; ++other )
+        {
+            EXPECT_NE( threads[ bus ], threads[ other ] );
+        }
+    }
+}
+
+TEST_F( CBusManagerTest, SynchronisedWaitsForAllBuses )
+{
+    // A slow job on one bus holds the actions on all the buses back
+    std::atomic< bool > slowJobDone{ false };
+    std::atomic< int > early{ 0 };
+
+    class CSlowJob : public IAbstractI2CBusJob
+    {
+    public:
+        explicit CSlowJob( std::atomic< bool >& aDone )
+            : iDone{ aDone }
+        {
+        }
+
+        void
+        Execute( size_t, IAbstractI2CBus& ) NOEXCEPT override
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+            iDone = true;
+        }
+
+    private:
+        std::atomic< bool >& iDone;
+    } slowJob{ slowJobDone };
+
+    EXPECT_EQ( iManager.Submit( 1, slowJob ), KOk );
+    EXPECT_EQ( iManager.Submit( kBusCount, slowJob ), KInvalidArgumentError );
+    EXPECT_EQ(
+        iManager.Synchronised( [ & ]( size_t, IAbstractI2CBus& ) { early += !slowJobDone; } ),
+        KOk );
+    EXPECT_EQ( early, 0 );
+}
+
+TEST_F( CBusManagerTest, ConcurrentFanOutCallers )
+{
+    // The interleaved jobs of two callers would leave the barriers waiting on each other
+    constexpr int kRounds = 200;
+    std::atomic< int > actions{ 0 };
+    std::atomic< int > errors{ 0 };
+    auto synchronise = [ & ]( ) {
+        for ( int round = 0; round < kRounds; ++round )
+        {
+            if ( iManager.Synchronised( [ & ]( size_t, IAbstractI2CBus& ) { ++actions; } ) != KOk )
+            {
+                ++errors;
+            }
+        }
+    };
+    auto readAll = [ & ]( ) {
+        std::uint8_t ids[ kBusCount ] = { };
+        TI2CFanOutRead reads[ kBusCount ];
+        for ( size_t bus = 0; bus < kBusCount; ++bus )
+        {
+            reads[ bus ].iBusIndex = static_cast< std::uint8_t >( bus );
+            reads[ bus ].iDeviceAddress = kDeviceAddress;
+            reads[ bus ].iRegisterAddress = kIdRegister;
+            reads[ bus ].iDestination = &ids[ bus ];
+            reads[ bus ].iLength = 1;
+        }
+        for ( int round = 0; round < kRounds; ++round )
+        {
+            if ( iManager.ReadAll( reads, kBusCount ) != KOk )
+            {
+                ++errors;
+            }
+        }
+    };
+
+    std::thread first( synchronise );
+    std::thread second( synchronise );
+    std::thread third( readAll );
+    first.join( );
+    second.join( );
+    third.join( );
+    EXPECT_EQ( errors, 0 );
+    EXPECT_EQ( actions, 2 * kRounds * static_cast< int >( kBusCount ) );
+}
+
+TEST_F( CBusManagerTest, FanOutFailsWhenStopped )
+{
+    // There are no executors to run the actions, so the calls fail rather than wait forever
+    iManager.Stop( );
+    int calls = 0;
+    EXPECT_EQ( iManager.ForEachBus( [ &calls ]( size_t, IAbstractI2CBus& ) { ++calls; } ),
+               KGenericError );
+    EXPECT_EQ( iManager.Synchronised( [ &calls ]( size_t, IAbstractI2CBus& ) { ++calls; } ),
+               KGenericError );
+
+    std::uint8_t id = 0;
+    TI2CFanOutRead read;
+    read.iBusIndex = 0;
+    read.iDeviceAddress = kDeviceAddress + 1;
+    read.iRegisterAddress = kIdRegister;
+    read.iDestination = &id;
+    read.iLength = 1;
+    EXPECT_EQ( iManager.ReadAll( &read, 1 ), KGenericError );
+    EXPECT_EQ( calls, 0 );
+
+    iManager.Start( );
+    EXPECT_EQ( iManager.ReadAll( &read, 1 ), KOk );
+    EXPECT_EQ( id, 1 );
+}
+
+TEST( BarrierTest, ReleasesAllParticipantsPerPhase )
+{
+    constexpr int kThreads = 4;
+    constexpr int kPhases = 50;
+    CBarrier barrier{ kThreads };
+    std::atomic< int > counter{ 0 };
+    std::atomic< int > elected{ 0 };
+    std::atomic< int > errors{ 0 };
+
+    std::thread threads[ kThreads ];
+    for ( auto& thread : threads )
+    {
+        thread = std::thread( [ & ]( ) {
+            for ( int phase = 0; phase < kPhases; ++phase )
+            {
+                ++counter;
+                elected += barrier.ArriveAndWait( );
+                errors += counter < ( phase + 1 ) * kThreads;
+                barrier.ArriveAndWait( );
+            }
+        } );
+    }
+    for ( auto& thread : threads )
+    {
+        thread.join( );
+    }
+    EXPECT_EQ( errors, 0 );
+    EXPECT_EQ( elected, kPhases );
+}
@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+#include <AbstractPlatform/i2c/I2CBusSimulator.hpp>
+#include <AbstractPlatform/i2c/I2CScheduler.hpp>
+
+#include <cstdint>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr std::uint8_t kDeviceAddress = 0x1D;
+
+struct TAcceleration
+{
+    std::int16_t iX;
+    std::int16_t iY;
+    std::int16_t iZ;
+};
+
+using TAccelerationBlock
+    = TRegisterBlock< TAcceleration,
+                      TRegisterBlockField< &TAcceleration::iX, Endianness::Big >,
+                      TRegisterBlockField< &TAcceleration::iY, Endianness::Big >,
+                      TRegisterBlockField< &TAcceleration::iZ, Endianness::Big > >;
+
+class CClearOnReadDevice : public CSimulatedRegisterDevice<>
+{
+public:
+    static constexpr std::uint8_t kStatusRegister = 0x27;
+
+    std::uint8_t
+    OnRegisterRead( std::uint8_t aRegisterAddress ) NOEXCEPT override
+    {
+        const std::uint8_t value = CSimulatedRegisterDevice<>::OnRegisterRead( aRegisterAddress );
+        if ( aRegisterAddress == kStatusRegister )
+        {
+            iRegisters[ kStatusRegister ] = 0;
+        }
+        return value;
+    }
+};
+}  // namespace
+
+TEST( I2CBusSimulatorTest, RegisterFileWithAutoIncrement )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+
+    CI2CBus i2cBus{ simulator };
+    const std::uint8_t kWrite[] = { 0x28, 0x01, 0x02, 0xFF, 0xFE, 0x80, 0x00 };
+    EXPECT_EQ( i2cBus.Write( kDeviceAddress, kWrite, sizeof( kWrite ), false ),
+               static_cast< int >( sizeof( kWrite ) ) );
+    EXPECT_EQ( device.iRegisters[ 0x2D ], 0x00 );
+    EXPECT_EQ( device.iRegisters[ 0x2C ], 0x80 );
+
+    TAcceleration acceleration{ };
+    EXPECT_TRUE( i2cBus.ReadRegisterBlock< TAccelerationBlock >( kDeviceAddress,
+                                                                 std::uint8_t{ 0x28 },
+                                                                 acceleration ) );
+    EXPECT_EQ( acceleration.iX, 0x0102 );
+    EXPECT_EQ( acceleration.iY, -2 );
+    EXPECT_EQ( acceleration.iZ, -32768 );
+}
+
+TEST( I2CBusSimulatorTest, AutoIncrementDisabled )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    device.iAutoIncrement = false;
+    device.iRegisters[ 0x10 ] = 0xAB;
+    device.iRegisters[ 0x11 ] = 0xCD;
+    simulator.Attach( kDeviceAddress, device );
+
+    const std::uint8_t kRegister = 0x10;
+    std::uint8_t data[ 2 ] = { };
+    EXPECT_EQ( simulator.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( simulator.Read( kDeviceAddress, data, sizeof( data ), false ), 2 );
+    EXPECT_EQ( data[ 0 ], 0xAB );
+    EXPECT_EQ( data[ 1 ], 0xAB );
+}
+
+TEST( I2CBusSimulatorTest, NackBehaviour )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+
+    const std::uint8_t kWrite[] = { 0x00, 0x01, 0x02, 0x03 };
+    EXPECT_EQ( simulator.Write( kDeviceAddress + 1, kWrite, sizeof( kWrite ), false ),
+               KGenericError );
+
+    device.iNackAfterBytes = 2;
+    EXPECT_EQ( simulator.Write( kDeviceAddress, kWrite, sizeof( kWrite ), false ), 2 );
+    EXPECT_EQ( device.iRegisters[ 0 ], 0x01 );
+    EXPECT_EQ( device.iRegisters[ 1 ], 0x00 );
+    EXPECT_EQ( simulator.Statistics( ).iBytesWritten, 3u );
+
+    device.iPresent = false;
+    EXPECT_EQ( simulator.Write( kDeviceAddress, kWrite, sizeof( kWrite ), false ),
+               KGenericError );
+    EXPECT_EQ( simulator.Statistics( ).iAddressNacks, 2u );
+}
+
+TEST( I2CBusSimulatorTest, ScriptedDevice )
+{
+    CI2CBusSimulator simulator;
+    CClearOnReadDevice device;
+    device.iRegisters[ CClearOnReadDevice::kStatusRegister ] = 0x0F;
+    simulator.Attach( kDeviceAddress, device );
+
+    const std::uint8_t kRegister = CClearOnReadDevice::kStatusRegister;
+    std::uint8_t status = 0;
+    EXPECT_EQ( simulator.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( simulator.Read( kDeviceAddress, &status, 1, false ), 1 );
+    EXPECT_EQ( status, 0x0F );
+
+    EXPECT_EQ( simulator.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( simulator.Read( kDeviceAddress, &status, 1, false ), 1 );
+    EXPECT_EQ( status, 0x00 );
+}
+
+TEST( I2CBusSimulatorTest, TimingModel )
+{
+    TI2CTimingModel timingModel;
+    timingModel.iClockFrequency = KI2CFastModeFrequency;
+    CI2CBusSimulator simulator{ timingModel };
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+
+    constexpr TNanoseconds kPeriod = 2500;
+    static_assert( TI2CTimingModel{ }.ClockPeriod( ) == kPeriod );
+
+    // Start + address + register, no Stop; Restart + address + 6 bytes + Stop
+    const std::uint8_t kRegister = 0x28;
+    std::uint8_t data[ 6 ];
+    simulator.Write( kDeviceAddress, &kRegister, 1, true );
+    simulator.Read( kDeviceAddress, data, sizeof( data ), false );
+    EXPECT_EQ( simulator.Now( ), ( 1 + 9 + 9 + 1 + 9 + 6 * 9 + 1 ) * kPeriod );
+    EXPECT_EQ( simulator.Statistics( ).iBusyTime, simulator.Now( ) );
+
+    simulator.AdvanceTime( 1000 );
+    EXPECT_EQ( simulator.Statistics( ).iBusyTime + 1000, simulator.Now( ) );
+
+    timingModel.iClockFrequency = KI2CStandardModeFrequency;
+    timingModel.iByteOverhead = 500;
+    timingModel.iTransferOverhead = 2000;
+    simulator.SetTimingModel( timingModel );
+    device.iClockStretch = 100;
+    simulator.ResetStatistics( );
+    simulator.Write( kDeviceAddress, &kRegister, 1, false );
+    EXPECT_EQ( simulator.Statistics( ).iBusyTime,
+               2000 + ( 1 + 9 + 1 ) * 10000 + ( 9 * 10000 + 500 + 100 ) );
+}
+
+TEST( I2CBusSimulatorTest, DrivesSchedulerInVirtualTime )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+
+    CI2CScheduler< CI2CBusSimulator > scheduler{ simulator, simulator };
+    const std::uint8_t kRegister = 0x00;
+    std::uint8_t data[ 4 ];
+    TI2CScheduledTransaction read;
+    read.iDeviceAddress = kDeviceAddress;
+    read.iDirection = TI2CDirection::Read;
+    read.iPrefix = &kRegister;
+    read.iPrefixLength = 1;
+    read.iDestination = data;
+    read.iDataLength = sizeof( data );
+    ASSERT_EQ( scheduler.Submit( read ), KOk );
+    scheduler.RunUntilIdle( );
+
+    EXPECT_EQ( read.iState, TI2CTransactionState::Done );
+    EXPECT_EQ( scheduler.Utilisation( 0 ).iBusyTime, simulator.Now( ) );
+    EXPECT_EQ( read.iCompletedAt, simulator.Now( ) );
+}
+
+TEST( I2CBusSimulatorTest, PacketErrorCode )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+    CI2CBus i2cBus{ simulator };
+
+    const std::uint8_t kData[] = { 0x34, 0x12 };
+    EXPECT_TRUE( i2cBus.WriteDataWithPec( kDeviceAddress, 0x08, kData, sizeof( kData ) ) );
+    const std::uint8_t kWritePacket[] = { kDeviceAddress << 1, 0x08, 0x34, 0x12 };
+    EXPECT_EQ( device.iRegisters[ 0x0A ], TCrc8Smbus::Compute( kWritePacket, 4 ) );
+
+    const std::uint8_t kReadPacket[] = { kDeviceAddress << 1, 0x08, ( kDeviceAddress << 1 ) | 1,
+                                         0x34, 0x12 };
+    device.iRegisters[ 0x0A ] = TCrc8Smbus::Compute( kReadPacket, 5 );
+    std::uint8_t data[ 2 ] = { };
+    EXPECT_TRUE( i2cBus.ReadDataWithPec( kDeviceAddress, 0x08, data, sizeof( data ) ) );
+    EXPECT_EQ( data[ 0 ], 0x34 );
+    EXPECT_EQ( data[ 1 ], 0x12 );
+
+    device.iRegisters[ 0x09 ] = 0x13;
+    data[ 1 ] = 0;
+    EXPECT_EQ( i2cBus.ReadDataWithPec( kDeviceAddress, 0x08, data, sizeof( data ) ).Error( ),
+               KChecksumError );
+    EXPECT_EQ( data[ 1 ], 0 );
+
+    std::uint8_t block[ KSmbusMaxBlockLength + 1 ];
+    EXPECT_EQ( i2cBus.ReadDataWithPec( kDeviceAddress, 0x00, block, sizeof( block ) ).Error( ),
+               KInvalidArgumentError );
+}
+
+TEST( I2CBusSimulatorTest, BlockPacketErrorCode )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+    CI2CBus i2cBus{ simulator };
+
+    // The Block Write stores the count, the data and the PEC from the command register on
+    const std::uint8_t kData[] = { 0x34, 0x12, 0x56 };
+    EXPECT_TRUE( i2cBus.WriteBlockWithPec( kDeviceAddress, 0x40, kData, sizeof( kData ) ) );
+    const std::uint8_t kWritePacket[] = { kDeviceAddress << 1, 0x40, 3, 0x34, 0x12, 0x56 };
+    EXPECT_EQ( device.iRegisters[ 0x40 ], 3 );
+    EXPECT_EQ( device.iRegisters[ 0x43 ], 0x56 );
+    EXPECT_EQ( device.iRegisters[ 0x44 ], TCrc8Smbus::Compute( kWritePacket, 6 ) );
+
+    // The device answers the Block Read with the same layout
+    const std::uint8_t kReadPacket[] = { kDeviceAddress << 1, 0x40, ( kDeviceAddress << 1 ) | 1,
+                                         3, 0x34, 0x12, 0x56 };
+    device.iRegisters[ 0x44 ] = TCrc8Smbus::Compute( kReadPacket, 7 );
+    std::uint8_t data[ 3 ] = { };
+    EXPECT_TRUE( i2cBus.ReadBlockWithPec( kDeviceAddress, 0x40, data, sizeof( data ) ) );
+    EXPECT_EQ( data[ 0 ], 0x34 );
+    EXPECT_EQ( data[ 2 ], 0x56 );
+
+    data[ 0 ] = 0;
+    EXPECT_EQ( i2cBus.ReadBlockWithPec( kDeviceAddress, 0x40, data, 2 ).Error( ),
+               KChecksumError );
+    const std::uint8_t kShortPacket[] = { kDeviceAddress << 1, 0x40, ( kDeviceAddress << 1 ) | 1,
+                                          3, 0x34, 0x12 };
+    device.iRegisters[ 0x43 ] = TCrc8Smbus::Compute( kShortPacket, 6 );
+    EXPECT_EQ( i2cBus.ReadBlockWithPec( kDeviceAddress, 0x40, data, 2 ).Error( ),
+               KGenericError );
+    EXPECT_EQ( data[ 0 ], 0 );
+}
+
+TEST( I2CBusSimulatorTest, RegisterBlockPacketErrorCode )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+    CI2CBus i2cBus{ simulator };
+
+    const std::uint8_t kRegisters[] = { 0x28, 0x01, 0x02, 0xFF, 0xFE, 0x80, 0x00 };
+    EXPECT_TRUE( i2cBus.WriteExact( kDeviceAddress, kRegisters, sizeof( kRegisters ) ) );
+    const std::uint8_t kReadPacket[] = { kDeviceAddress << 1, 0x28, ( kDeviceAddress << 1 ) | 1,
+                                         0x01, 0x02, 0xFF, 0xFE, 0x80, 0x00 };
+    device.iRegisters[ 0x2E ] = TCrc8Smbus::Compute( kReadPacket, sizeof( kReadPacket ) );
+
+    TAcceleration acceleration{ };
+    EXPECT_TRUE( i2cBus.ReadRegisterBlockWithPec< TAccelerationBlock >( kDeviceAddress, 0x28,
+                                                                        acceleration ) );
+    EXPECT_EQ( acceleration.iX, 0x0102 );
+    EXPECT_EQ( acceleration.iZ, -32768 );
+
+    device.iRegisters[ 0x29 ] = 0x11;
+    EXPECT_EQ( i2cBus.ReadRegisterBlockWithPec< TAccelerationBlock >( kDeviceAddress, 0x28,
+                                                                      acceleration )
+                   .Error( ),
+               KChecksumError );
+    EXPECT_EQ( acceleration.iX, 0x0102 );
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/i2c/I2CBusSimulator.hpp>
+#include <AbstractPlatform/i2c/I2CBusTracer.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr std::uint8_t kDeviceAddress = 0x44;
+
+using TTracer = CI2CBusTracer< CI2CBusSimulator, true, 4, 8 >;
+
+// Reports every transfer as complete without touching the data.
+class CEchoBus : public IAbstractI2CBus
+{
+public:
+    int
+    Write( std::uint8_t, const std::uint8_t*, size_t aDataLength, bool ) NOEXCEPT override
+    {
+        return static_cast< int >( aDataLength );
+    }
+
+    int
+    Read( std::uint8_t, std::uint8_t*, size_t aDataLength, bool ) NOEXCEPT override
+    {
+        return static_cast< int >( aDataLength );
+    }
+};
+}  // namespace
+
+TEST( I2CBusTracerTest, DisabledTracerIsPassThrough )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+
+    CI2CBusTracer< CI2CBusSimulator, false > tracer{ simulator, simulator };
+    static_assert( !decltype( tracer )::IsEnabled( ) );
+    static_assert( sizeof( tracer ) < 64 );
+
+    const std::uint8_t kWrite[] = { 0x00, 0x11 };
+    EXPECT_EQ( tracer.Write( kDeviceAddress, kWrite, sizeof( kWrite ), false ), 2 );
+    EXPECT_EQ( device.iRegisters[ 0 ], 0x11 );
+
+    TI2CTraceRecord record;
+    EXPECT_EQ( tracer.CopyRecords( &record, 1 ), 0u );
+}
+
+TEST( I2CBusTracerTest, RecordsTransfers )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+    TTracer tracer{ simulator, simulator };
+
+    const std::uint8_t kRegister = 0x10;
+    std::uint8_t data[ 4 ];
+    EXPECT_EQ( tracer.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    const TNanoseconds readStart = simulator.Now( );
+    EXPECT_EQ( tracer.Read( kDeviceAddress, data, sizeof( data ), false ), 4 );
+    EXPECT_EQ( tracer.Write( kDeviceAddress + 1, &kRegister, 1, false ), KGenericError );
+
+    TI2CTraceRecord records[ 8 ];
+    ASSERT_EQ( tracer.CopyRecords( records, 8 ), 3u );
+    EXPECT_EQ( records[ 0 ].iDirection, TI2CDirection::Write );
+    EXPECT_EQ( records[ 0 ].iLength, 1u );
+    EXPECT_EQ( records[ 1 ].iDirection, TI2CDirection::Read );
+    EXPECT_EQ( records[ 1 ].iDeviceAddress, kDeviceAddress );
+    EXPECT_EQ( records[ 1 ].iLength, 4u );
+    EXPECT_EQ( records[ 1 ].iResult, 4 );
+    EXPECT_EQ( records[ 1 ].iStart, readStart );
+    EXPECT_EQ( records[ 1 ].iEnd, records[ 2 ].iStart );
+    EXPECT_EQ( records[ 2 ].iResult, KGenericError );
+
+    const auto histogram = tracer.Histogram( kDeviceAddress );
+    EXPECT_EQ( histogram.iSize[ 1 ], 1u );
+    EXPECT_EQ( histogram.iSize[ 3 ], 1u );
+    EXPECT_EQ( histogram.iFailures, 0u );
+    std::uint32_t latencyCount = 0;
+    for ( auto count : histogram.iLatency )
+    {
+        latencyCount += count;
+    }
+    EXPECT_EQ( latencyCount, 2u );
+    EXPECT_EQ( tracer.Histogram( kDeviceAddress + 1 ).iFailures, 1u );
+}
+
+TEST( I2CBusTracerTest, RingKeepsLatestRecords )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+    TTracer tracer{ simulator, simulator };
+
+    std::uint8_t data[ 16 ];
+    for ( size_t length = 1; length <= 12; ++length )
+    {
+        tracer.Read( kDeviceAddress, data, length, false );
+    }
+
+    TI2CTraceRecord records[ 16 ];
+    ASSERT_EQ( tracer.CopyRecords( records, 16 ), 8u );
+    EXPECT_EQ( records[ 0 ].iLength, 5u );
+    EXPECT_EQ( records[ 7 ].iLength, 12u );
+}
+
+TEST( I2CBusTracerTest, RecordsLongTransferResult )
+{
+    CEchoBus bus;
+    CSteadyClock clock;
+    CI2CBusTracer< CSteadyClock, true, 1, 4 > tracer{ bus, clock };
+
+    const std::uint8_t kByte = 0;
+    EXPECT_EQ( tracer.Write( kDeviceAddress, &kByte, 70000, false ), 70000 );
+
+    TI2CTraceRecord record;
+    ASSERT_EQ( tracer.CopyRecords( &record, 1 ), 1u );
+    EXPECT_EQ( record.iResult, 70000 );
+    EXPECT_EQ( record.iLength, 70000u );
+    EXPECT_EQ( record.iDeviceAddress, kDeviceAddress );
+}
+
+TEST( I2CBusTracerTest, BinaryDump )
+{
+    CI2CBusSimulator simulator;
+    CSimulatedRegisterDevice<> device;
+    simulator.Attach( kDeviceAddress, device );
+    TTracer tracer{ simulator, simulator };
+
+    std::uint8_t data[ 3 ];
+    tracer.Read( kDeviceAddress, data, sizeof( data ), false );
+    tracer.Read( kDeviceAddress, data, sizeof( data ), false );
+
+    std::uint8_t dump[ TTracer::kDumpHeaderSize + 2 * TTracer::kDumpRecordSize ];
+    EXPECT_EQ( tracer.Dump( dump, sizeof( dump ) - 1 ),
+               TTracer::kDumpHeaderSize + TTracer::kDumpRecordSize );
+    ASSERT_EQ( tracer.Dump( dump, sizeof( dump ) ), sizeof( dump ) );
+    EXPECT_EQ( std::memcmp( dump, "I2CT", 4 ), 0 );
+    EXPECT_EQ( dump[ 4 ], 2 );
+    EXPECT_EQ( dump[ 6 ], TTracer::kDumpRecordSize );
+
+    const std::uint8_t* record = dump + TTracer::kDumpHeaderSize + TTracer::kDumpRecordSize;
+    TI2CTraceRecord records[ 2 ];
+    ASSERT_EQ( tracer.CopyRecords( records, 2 ), 2u );
+    const TNanoseconds duration = records[ 1 ].iEnd - records[ 1 ].iStart;
+    EXPECT_EQ( record[ 0 ], static_cast< std::uint8_t >( records[ 1 ].iStart ) );
+    EXPECT_EQ( record[ 8 ], static_cast< std::uint8_t >( duration ) );
+    EXPECT_EQ( record[ 9 ], static_cast< std::uint8_t >( duration >> 8 ) );
+    EXPECT_EQ( record[ 12 ], 3 );
+    EXPECT_EQ( record[ 16 ], 3 );
+    EXPECT_EQ( record[ 17 ], 0 );
+    EXPECT_EQ( record[ 20 ], kDeviceAddress );
+    EXPECT_EQ( record[ 21 ], static_cast< std::uint8_t >( TI2CDirection::Read ) );
+}
+
+TEST( I2CBusTracerTest, PerThreadRings )
+{
+    CEchoBus bus;
+    CSteadyClock clock;
+    CI2CBusTracer< CSteadyClock, true, 2, 16 > tracer{ bus, clock };
+
+    std::vector< std::thread > threads;
+    for ( std::uint8_t thread = 0; thread < 3; ++thread )
+    {
+        threads.emplace_back( [ &tracer, thread ]( ) {
+            const std::uint8_t kByte = 0;
+            for ( int i = 0; i < 4; ++i )
+            {
+                tracer.Write( thread, &kByte, 1, false );
+            }
+        } );
+    }
+    for ( auto& thread : threads )
+    {
+        thread.join( );
+    }
+
+    // A thread finding no free ring drops its records, unless it reuses the ring of a finished
+    // thread.
+    TI2CTraceRecord records[ 16 ];
+    const size_t copied = tracer.CopyRecords( records, 16 );
+    EXPECT_EQ( copied + tracer.DroppedRecords( ), 12u );
+    EXPECT_GE( copied, 8u );
+}
@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+#include <AbstractPlatform/i2c/I2CBusSimulator.hpp>
+#include <AbstractPlatform/i2c/I2CCapture.hpp>
+
+#include <cstdint>
+#include <cstdio>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr std::uint8_t kDeviceAddress = 0x48;
+
+class CCaptureTest : public ::testing::Test
+{
+protected:
+    void
+    SetUp( ) override
+    {
+        iSimulator.Attach( kDeviceAddress, iDevice );
+        iDevice.iRegisters[ 0x10 ] = 0x12;
+        iDevice.iRegisters[ 0x11 ] = 0x34;
+    }
+
+    void
+    RecordWorkload( IAbstractCaptureSink& aSink )
+    {
+        CI2CCaptureRecorder< CI2CBusSimulator > recorder{ iSimulator, aSink, iSimulator };
+        CI2CBus i2cBus{ recorder };
+
+        const std::uint8_t kRegister = 0x10;
+        std::uint8_t data[ 2 ];
+        i2cBus.Write( kDeviceAddress, &kRegister, 1, true );
+        i2cBus.Read( kDeviceAddress, data, sizeof( data ), false );
+        i2cBus.Write( kDeviceAddress + 1, &kRegister, 1, false );
+        EXPECT_EQ( recorder.RecordCount( ), 3u );
+        EXPECT_TRUE( recorder.IsValid( ) );
+    }
+
+    CI2CBusSimulator iSimulator;
+    CSimulatedRegisterDevice<> iDevice;
+};
+}  // namespace
+
+TEST_F( CCaptureTest, RecordAndRead )
+{
+    std::uint8_t buffer[ 256 ];
+    CBufferCaptureSink sink{ buffer, sizeof( buffer ) };
+    RecordWorkload( sink );
+
+    CI2CCaptureReader reader{ sink.Data( ), sink.Length( ) };
+    ASSERT_TRUE( reader.IsValid( ) );
+
+    TI2CCaptureRecord record;
+    ASSERT_TRUE( reader.Next( record ) );
+    EXPECT_EQ( record.iStart, 0u );
+    EXPECT_EQ( record.iDuration, iSimulator.TimingModel( ).ByteTime( ) * 2
+                                     + iSimulator.TimingModel( ).ClockPeriod( ) );
+    EXPECT_EQ( record.iDirection, TI2CDirection::Write );
+    EXPECT_TRUE( record.iNoStop );
+    ASSERT_EQ( record.iPayloadLength, 1u );
+    EXPECT_EQ( record.iPayload[ 0 ], 0x10 );
+
+    ASSERT_TRUE( reader.Next( record ) );
+    EXPECT_EQ( record.iDirection, TI2CDirection::Read );
+    EXPECT_EQ( record.iResult, 2 );
+    ASSERT_EQ( record.iPayloadLength, 2u );
+    EXPECT_EQ( record.iPayload[ 0 ], 0x12 );
+    EXPECT_EQ( record.iPayload[ 1 ], 0x34 );
+
+    ASSERT_TRUE( reader.Next( record ) );
+    EXPECT_EQ( record.iDeviceAddress, kDeviceAddress + 1 );
+    EXPECT_EQ( record.iResult, KGenericError );
+    EXPECT_FALSE( reader.Next( record ) );
+
+    // The truncated capture ends at the last complete record
+    reader.Reset( sink.Data( ), sink.Length( ) - 1 );
+    EXPECT_TRUE( reader.Next( record ) );
+    EXPECT_TRUE( reader.Next( record ) );
+    EXPECT_FALSE( reader.Next( record ) );
+
+    buffer[ 0 ] = 'X';
+    EXPECT_FALSE( reader.Reset( sink.Data( ), sink.Length( ) ) );
+}
+
+TEST_F( CCaptureTest, SinkOverflow )
+{
+    std::uint8_t buffer[ TI2CCaptureFormat::kFileHeaderSize + TI2CCaptureFormat::kRecordHeaderSize ];
+    CBufferCaptureSink sink{ buffer, sizeof( buffer ) };
+    CI2CCaptureRecorder< CI2CBusSimulator > recorder{ iSimulator, sink, iSimulator };
+
+    const std::uint8_t kRegister = 0x10;
+    EXPECT_EQ( recorder.Write( kDeviceAddress, &kRegister, 1, false ), 1 );
+    EXPECT_FALSE( recorder.IsValid( ) );
+}
+
+TEST_F( CCaptureTest, Replay )
+{
+    std::uint8_t buffer[ 256 ];
+    CBufferCaptureSink sink{ buffer, sizeof( buffer ) };
+    RecordWorkload( sink );
+
+    CI2CCaptureReader reader{ sink.Data( ), sink.Length( ) };
+    CSteadyClock clock;
+    CI2CReplayBus< CSteadyClock > replayBus{ reader, clock, TI2CReplayTiming::Captured };
+    CI2CBus i2cBus{ replayBus };
+
+    const std::uint8_t kRegister = 0x10;
+    std::uint8_t data[ 2 ] = { };
+    const TNanoseconds start = clock.Now( );
+    EXPECT_EQ( i2cBus.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( i2cBus.Read( kDeviceAddress, data, sizeof( data ), false ), 2 );
+    EXPECT_EQ( data[ 0 ], 0x12 );
+    EXPECT_EQ( data[ 1 ], 0x34 );
+    EXPECT_EQ( i2cBus.Write( kDeviceAddress + 1, &kRegister, 1, false ), KGenericError );
+    EXPECT_GE( clock.Now( ) - start, iSimulator.Now( ) );
+    EXPECT_EQ( replayBus.Mismatches( ), 0u );
+
+    // The stack diverging from the capture
+    reader.Rewind( );
+    const std::uint8_t kOtherRegister = 0x11;
+    EXPECT_EQ( i2cBus.Write( kDeviceAddress, &kOtherRegister, 1, true ), KGenericError );
+    EXPECT_EQ( i2cBus.Write( kDeviceAddress, &kRegister, 1, true ), KGenericError );
+    EXPECT_EQ( replayBus.Mismatches( ), 2u );
+}
+
+TEST_F( CCaptureTest, ReplayCorruptedCapture )
+{
+    std::uint8_t buffer[ 256 ];
+    CBufferCaptureSink sink{ buffer, sizeof( buffer ) };
+    RecordWorkload( sink );
+
+    // The read record claims more bytes than were requested
+    const size_t readRecord
+        = TI2CCaptureFormat::kFileHeaderSize + TI2CCaptureFormat::kRecordHeaderSize + 1;
+    buffer[ readRecord + 16 ] = 3;
+
+    CI2CCaptureReader reader{ sink.Data( ), sink.Length( ) };
+    CSteadyClock clock;
+    CI2CReplayBus< CSteadyClock > replayBus{ reader, clock };
+
+    const std::uint8_t kRegister = 0x10;
+    std::uint8_t data[ 3 ] = { };
+    EXPECT_EQ( replayBus.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( replayBus.Read( kDeviceAddress, data, 2, false ), KGenericError );
+    EXPECT_EQ( data[ 0 ], 0 );
+    EXPECT_EQ( data[ 2 ], 0 );
+    EXPECT_EQ( replayBus.Mismatches( ), 1u );
+
+    // The truncated capture ends in the middle of the read payload
+    buffer[ readRecord + 16 ] = 2;
+    reader.Reset( sink.Data( ), readRecord + TI2CCaptureFormat::kRecordHeaderSize + 1 );
+    EXPECT_EQ( replayBus.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( replayBus.Read( kDeviceAddress, data, 2, false ), KGenericError );
+    EXPECT_EQ( data[ 0 ], 0 );
+    EXPECT_EQ( replayBus.Mismatches( ), 2u );
+}
+
+TEST_F( CCaptureTest, ReplayPacingAnchorsOnFirstPacedRecord )
+{
+    static_assert( KClockCanSleep< CSteadyClock > );
+    static_assert( !KClockCanSleep< CI2CBusSimulator > );
+
+    std::uint8_t buffer[ 256 ];
+    CBufferCaptureSink sink{ buffer, sizeof( buffer ) };
+    RecordWorkload( sink );
+
+    CI2CCaptureReader reader{ sink.Data( ), sink.Length( ) };
+    TI2CCaptureRecord records[ 3 ];
+    for ( auto& record : records )
+    {
+        ASSERT_TRUE( reader.Next( record ) );
+    }
+    reader.Rewind( );
+
+    CSteadyClock clock;
+    CI2CReplayBus< CSteadyClock > replayBus{ reader, clock, TI2CReplayTiming::Captured };
+
+    // The first record mismatches, so the pacing is anchored on the second one.
+    const std::uint8_t kOtherRegister = 0x11;
+    EXPECT_EQ( replayBus.Write( kDeviceAddress, &kOtherRegister, 1, true ), KGenericError );
+    const TNanoseconds start = clock.Now( );
+    std::uint8_t data[ 2 ] = { };
+    EXPECT_EQ( replayBus.Read( kDeviceAddress, data, sizeof( data ), false ), 2 );
+    EXPECT_GE( clock.Now( ) - start, records[ 1 ].iDuration );
+    const std::uint8_t kRegister = 0x10;
+    EXPECT_EQ( replayBus.Write( kDeviceAddress + 1, &kRegister, 1, false ), KGenericError );
+    EXPECT_EQ( replayBus.Mismatches( ), 1u );
+    EXPECT_GE( clock.Now( ) - start,
+               records[ 2 ].iStart + records[ 2 ].iDuration - records[ 1 ].iStart );
+}
+
+#ifdef I2C_CAPTURE_MMAP
+TEST_F( CCaptureTest, ReplayFromMappedFile )
+{
+    char path[] = "/tmp/i2c_capture_XXXXXX";
+    const int file = ::mkstemp( path );
+    ASSERT_GE( file, 0 );
+    ::close( file );
+
+    {
+        CFileCaptureSink sink;
+        ASSERT_TRUE( sink.Open( path ) );
+        RecordWorkload( sink );
+    }
+
+    CMappedCaptureFile capture;
+    ASSERT_TRUE( capture.Open( path ) );
+    CI2CCaptureReader reader{ capture.Data( ), capture.Length( ) };
+    CSteadyClock clock;
+    CI2CReplayBus< CSteadyClock > replayBus{ reader, clock };
+
+    const std::uint8_t kRegister = 0x10;
+    std::uint8_t data[ 2 ] = { };
+    EXPECT_EQ( replayBus.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( replayBus.Read( kDeviceAddress, data, sizeof( data ), false ), 2 );
+    EXPECT_EQ( data[ 1 ], 0x34 );
+    EXPECT_EQ( replayBus.ReplayedRecords( ), 2u );
+
+    capture.Close( );
+    std::remove( path );
+}
+#endif
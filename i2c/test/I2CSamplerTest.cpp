@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+#include <AbstractPlatform/i2c/I2CBusSimulator.hpp>
+#include <AbstractPlatform/i2c/I2CSampler.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr std::uint8_t kAccelerometerAddress = 0x1D;
+constexpr std::uint8_t kThermometerAddress = 0x48;
+constexpr TNanoseconds kMillisecond = 1000000;
+
+using TSampler = CI2CSampler< CI2CBusSimulator, 8, 6, 16 >;
+
+// The clock advanced by the sleeps only, stopping the sampler after kSleeps of them.
+class CManualClock
+{
+public:
+    static constexpr int kSleeps = 5;
+
+    explicit CManualClock( std::atomic< bool >& aStop )
+        : iStop{ aStop }
+    {
+    }
+
+    TNanoseconds
+    Now( ) const NOEXCEPT
+    {
+        return iNow;
+    }
+
+    void
+    SleepUntil( TNanoseconds aTime ) const NOEXCEPT
+    {
+        iNow = aTime;
+        if ( ++iSleeps == kSleeps )
+        {
+            iStop = true;
+        }
+    }
+
+    mutable TNanoseconds iNow = 0;
+    mutable int iSleeps = 0;
+
+private:
+    std::atomic< bool >& iStop;
+};
+
+class CSamplerTest : public ::testing::Test
+{
+protected:
+    CSamplerTest( )
+        : iI2CBus{ iSimulator }
+        , iSampler{ iI2CBus, iSimulator }
+    {
+        iSimulator.Attach( kAccelerometerAddress, iAccelerometer );
+        iSimulator.Attach( kThermometerAddress, iThermometer );
+        for ( int i = 0; i < 8; ++i )
+        {
+            iAccelerometer.iRegisters[ 0x28 + i ] = static_cast< std::uint8_t >( 0x80 + i );
+        }
+        iThermometer.iRegisters[ 0x00 ] = 0x19;
+    }
+
+    int
+    AddChannel( std::uint8_t aDeviceAddress,
+                std::uint8_t aRegisterAddress,
+                std::uint8_t aLength,
+                TNanoseconds aPeriod )
+    {
+        TI2CSamplingChannel channel;
+        channel.iDeviceAddress = aDeviceAddress;
+        channel.iRegisterAddress = aRegisterAddress;
+        channel.iLength = aLength;
+        channel.iPeriod = aPeriod;
+        return iSampler.AddChannel( channel );
+    }
+
+    CI2CBusSimulator iSimulator;
+    CSimulatedRegisterDevice<> iAccelerometer;
+    CSimulatedRegisterDevice<> iThermometer;
+    CI2CBus iI2CBus;
+    TSampler iSampler;
+};
+}  // namespace
+
+TEST_F( CSamplerTest, InvalidChannels )
+{
+    EXPECT_EQ( AddChannel( kAccelerometerAddress, 0x28, 0, kMillisecond ), KInvalidArgumentError );
+    EXPECT_EQ( AddChannel( kAccelerometerAddress, 0x28, 7, kMillisecond ), KInvalidArgumentError );
+    EXPECT_EQ( AddChannel( kAccelerometerAddress, 0x28, 2, 0 ), KInvalidArgumentError );
+    for ( int i = 0; i < 8; ++i )
+    {
+        EXPECT_EQ( AddChannel( kAccelerometerAddress, 0x28, 2, kMillisecond ), i );
+    }
+    EXPECT_EQ( AddChannel( kAccelerometerAddress, 0x28, 2, kMillisecond ), KGenericError );
+}
+
+TEST_F( CSamplerTest, MergesAdjacentReads )
+{
+    const int x = AddChannel( kAccelerometerAddress, 0x28, 2, kMillisecond );
+    const int z = AddChannel( kAccelerometerAddress, 0x2C, 2, kMillisecond );
+    const int y = AddChannel( kAccelerometerAddress, 0x2A, 2, kMillisecond );
+    const int temperature = AddChannel( kThermometerAddress, 0x00, 1, 2 * kMillisecond );
+
+    EXPECT_EQ( iSampler.RunOnce( ), kMillisecond );
+    EXPECT_EQ( iSampler.Statistics( ).iTransactions, 2u );
+
+    TSampler::TSample samples[ 8 ];
+    ASSERT_EQ( iSampler.ReadSamples( samples, 8 ), 4u );
+    EXPECT_EQ( samples[ 0 ].iChannel, x );
+    EXPECT_EQ( samples[ 1 ].iChannel, y );
+    EXPECT_EQ( samples[ 2 ].iChannel, z );
+    EXPECT_EQ( samples[ 3 ].iChannel, temperature );
+    EXPECT_EQ( samples[ 0 ].iTimestamp, samples[ 2 ].iTimestamp );
+    EXPECT_LT( samples[ 0 ].iTimestamp, samples[ 3 ].iTimestamp );
+    EXPECT_EQ( samples[ 1 ].iData[ 0 ], 0x82 );
+    EXPECT_EQ( samples[ 2 ].iData[ 1 ], 0x85 );
+    EXPECT_EQ( samples[ 3 ].iData[ 0 ], 0x19 );
+    EXPECT_EQ( samples[ 3 ].iResult, KOk );
+
+    iSimulator.AdvanceTime( kMillisecond - iSimulator.Now( ) );
+    EXPECT_EQ( iSampler.RunOnce( ), 2 * kMillisecond );
+    EXPECT_EQ( iSampler.ReadSamples( samples, 8 ), 3u );
+    EXPECT_EQ( iSampler.Statistics( ).iTransactions, 3u );
+}
+
+TEST_F( CSamplerTest, OverrunsAndFailures )
+{
+    AddChannel( kThermometerAddress, 0x00, 1, kMillisecond );
+    iSampler.RunOnce( );
+
+    iSimulator.AdvanceTime( 3 * kMillisecond + kMillisecond / 2 );
+    iThermometer.iPresent = false;
+    EXPECT_EQ( iSampler.RunOnce( ), 4 * kMillisecond );
+    EXPECT_EQ( iSampler.Statistics( ).iOverruns, 2u );
+    EXPECT_EQ( iSampler.Statistics( ).iFailedTransactions, 1u );
+
+    TSampler::TSample samples[ 2 ];
+    ASSERT_EQ( iSampler.ReadSamples( samples, 2 ), 2u );
+    EXPECT_EQ( samples[ 1 ].iResult, KGenericError );
+}
+
+TEST_F( CSamplerTest, DropsSamplesWhenConsumerIsLate )
+{
+    AddChannel( kThermometerAddress, 0x00, 1, kMillisecond );
+    for ( int i = 0; i < 20; ++i )
+    {
+        iSimulator.AdvanceTime( iSampler.RunOnce( ) - iSimulator.Now( ) );
+    }
+    EXPECT_EQ( iSampler.Statistics( ).iSamples, 20u );
+    EXPECT_EQ( iSampler.Statistics( ).iDroppedSamples, 4u );
+}
+
+TEST_F( CSamplerTest, RunSleepsThroughClock )
+{
+    std::atomic< bool > stop{ false };
+    CManualClock clock{ stop };
+    CI2CSampler< CManualClock, 8, 6, 16 > sampler{ iI2CBus, clock };
+
+    TI2CSamplingChannel channel;
+    channel.iDeviceAddress = kThermometerAddress;
+    channel.iRegisterAddress = 0x00;
+    channel.iLength = 1;
+    channel.iPeriod = 2 * kMillisecond;
+    ASSERT_EQ( sampler.AddChannel( channel ), 0 );
+
+    sampler.Run( stop );
+    EXPECT_EQ( clock.iSleeps, CManualClock::kSleeps );
+    EXPECT_EQ( clock.Now( ), CManualClock::kSleeps * 2 * kMillisecond );
+
+    decltype( sampler )::TSample samples[ 8 ];
+    ASSERT_EQ( sampler.ReadSamples( samples, 8 ), static_cast< size_t >( CManualClock::kSleeps ) );
+    EXPECT_EQ( samples[ 4 ].iTimestamp, 4 * 2 * kMillisecond );
+}
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/i2c/I2CScheduler.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr std::uint8_t kImuAddress = 0x68;
+constexpr std::uint8_t kDisplayAddress = 0x3C;
+constexpr TNanoseconds kByteTime = 10000;
+
+struct TManualClock
+{
+    TNanoseconds
+    Now( ) const NOEXCEPT
+    {
+        return iNow;
+    }
+
+    TNanoseconds iNow = 0;
+};
+
+struct TTransfer
+{
+    std::uint8_t iDeviceAddress;
+    bool iIsRead;
+    std::vector< std::uint8_t > iData;
+};
+
+class CRecordingBus : public IAbstractI2CBus
+{
+public:
+    explicit CRecordingBus( TManualClock& aClock )
+        : iClock{ aClock }
+    {
+    }
+
+    int
+    Write( std::uint8_t aDeviceAddress,
+           const std::uint8_t* aDataSource,
+           size_t aDataLength,
+           bool /*aNoStop*/ ) NOEXCEPT override
+    {
+        iClock.iNow += aDataLength * kByteTime;
+        iTransfers.push_back(
+            { aDeviceAddress, false, { aDataSource, aDataSource + aDataLength } } );
+        return static_cast< int >( aDataLength );
+    }
+
+    int
+    Read( std::uint8_t aDeviceAddress,
+          std::uint8_t* aDataDestination,
+          size_t aDataLength,
+          bool /*aNoStop*/ ) NOEXCEPT override
+    {
+        iClock.iNow += aDataLength * kByteTime;
+        for ( size_t i = 0; i < aDataLength; ++i )
+        {
+            aDataDestination[ i ] = static_cast< std::uint8_t >( i );
+        }
+        iTransfers.push_back( { aDeviceAddress, true, { } } );
+        return static_cast< int >( aDataLength );
+    }
+
+    TManualClock& iClock;
+    std::vector< TTransfer > iTransfers;
+};
+
+using TScheduler = CI2CScheduler< TManualClock, 4, 2, 16 >;
+}  // namespace
+
+TEST( I2CSchedulerTest, ChunkedWriteIsInterleavedWithUrgentRead )
+{
+    TManualClock clock;
+    CRecordingBus bus{ clock };
+    TScheduler scheduler{ bus, clock };
+
+    std::uint8_t frame[ 32 ];
+    for ( size_t i = 0; i < sizeof( frame ); ++i )
+    {
+        frame[ i ] = static_cast< std::uint8_t >( i );
+    }
+    const std::uint8_t kDataPrefix = 0x40;
+    TI2CScheduledTransaction frameWrite;
+    frameWrite.iDeviceAddress = kDisplayAddress;
+    frameWrite.iPrefix = &kDataPrefix;
+    frameWrite.iPrefixLength = 1;
+    frameWrite.iSource = frame;
+    frameWrite.iDataLength = sizeof( frame );
+    frameWrite.iChunkLength = 8;
+    frameWrite.iClientId = 1;
+    ASSERT_EQ( scheduler.Submit( frameWrite ), KOk );
+
+    EXPECT_TRUE( scheduler.RunOnce( ) );
+    EXPECT_EQ( frameWrite.iState, TI2CTransactionState::Pending );
+    EXPECT_EQ( frameWrite.iTransferred, 8u );
+
+    const std::uint8_t kRegister = 0x3B;
+    std::uint8_t sample[ 6 ];
+    TI2CScheduledTransaction imuRead;
+    imuRead.iDeviceAddress = kImuAddress;
+    imuRead.iDirection = TI2CDirection::Read;
+    imuRead.iPrefix = &kRegister;
+    imuRead.iPrefixLength = 1;
+    imuRead.iDestination = sample;
+    imuRead.iDataLength = sizeof( sample );
+    imuRead.iDeadline = clock.Now( ) + 1000000;
+    ASSERT_EQ( scheduler.Submit( imuRead ), KOk );
+
+    EXPECT_EQ( scheduler.RunUntilIdle( ), 4u );
+    EXPECT_EQ( imuRead.iState, TI2CTransactionState::Done );
+    EXPECT_EQ( frameWrite.iState, TI2CTransactionState::Done );
+
+    ASSERT_EQ( bus.iTransfers.size( ), 6u );
+    EXPECT_EQ( bus.iTransfers[ 1 ].iDeviceAddress, kImuAddress );
+    EXPECT_EQ( bus.iTransfers[ 2 ].iDeviceAddress, kImuAddress );
+    EXPECT_TRUE( bus.iTransfers[ 2 ].iIsRead );
+    for ( size_t transfer : { 0u, 3u, 4u, 5u } )
+    {
+        ASSERT_EQ( bus.iTransfers[ transfer ].iData.size( ), 9u );
+        EXPECT_EQ( bus.iTransfers[ transfer ].iData[ 0 ], kDataPrefix );
+    }
+    EXPECT_EQ( bus.iTransfers[ 5 ].iData[ 8 ], 31 );
+
+    const auto& imuUtilisation = scheduler.Utilisation( 0 );
+    EXPECT_EQ( imuUtilisation.iTransactions, 1u );
+    EXPECT_EQ( imuUtilisation.iBytes, 6u );
+    EXPECT_EQ( imuUtilisation.iBusyTime, 7 * kByteTime );
+    EXPECT_EQ( imuUtilisation.iDeadlineMisses, 0u );
+
+    const auto& displayUtilisation = scheduler.Utilisation( 1 );
+    EXPECT_EQ( displayUtilisation.iBytes, 32u );
+    EXPECT_EQ( displayUtilisation.iBusyTime, 36 * kByteTime );
+    EXPECT_DOUBLE_EQ( scheduler.UtilisationRatio( 1 ), 36.0 / 43.0 );
+}
+
+TEST( I2CSchedulerTest, EqualDeadlinesAreOrderedByPriority )
+{
+    TManualClock clock;
+    CRecordingBus bus{ clock };
+    TScheduler scheduler{ bus, clock };
+
+    const std::uint8_t kCommand = 0;
+    TI2CScheduledTransaction transactions[ 3 ];
+    for ( std::uint8_t i = 0; i < 3; ++i )
+    {
+        transactions[ i ].iDeviceAddress = i;
+        transactions[ i ].iSource = &kCommand;
+        transactions[ i ].iDataLength = 1;
+        transactions[ i ].iPriority = i;
+        ASSERT_EQ( scheduler.Submit( transactions[ i ] ), KOk );
+    }
+
+    scheduler.RunUntilIdle( );
+    ASSERT_EQ( bus.iTransfers.size( ), 3u );
+    EXPECT_EQ( bus.iTransfers[ 0 ].iDeviceAddress, 2 );
+    EXPECT_EQ( bus.iTransfers[ 1 ].iDeviceAddress, 1 );
+    EXPECT_EQ( bus.iTransfers[ 2 ].iDeviceAddress, 0 );
+}
+
+TEST( I2CSchedulerTest, PriorityClassPrecedesDeadline )
+{
+    TManualClock clock;
+    CRecordingBus bus{ clock };
+    TScheduler scheduler{ bus, clock };
+
+    // The urgent class goes first despite its later deadline, then the earliest deadline
+    const std::uint8_t kCommand = 0;
+    const TNanoseconds kDeadlines[] = { 1000, 2000, 5000 };
+    const std::uint8_t kPriorities[] = { 0, 0, 1 };
+    TI2CScheduledTransaction transactions[ 3 ];
+    for ( std::uint8_t i = 0; i < 3; ++i )
+    {
+        transactions[ i ].iDeviceAddress = i;
+        transactions[ i ].iSource = &kCommand;
+        transactions[ i ].iDataLength = 1;
+        transactions[ i ].iDeadline = kDeadlines[ i ];
+        transactions[ i ].iPriority = kPriorities[ i ];
+    }
+    ASSERT_EQ( scheduler.Submit( transactions[ 1 ] ), KOk );
+    ASSERT_EQ( scheduler.Submit( transactions[ 0 ] ), KOk );
+    ASSERT_EQ( scheduler.Submit( transactions[ 2 ] ), KOk );
+
+    scheduler.RunUntilIdle( );
+    ASSERT_EQ( bus.iTransfers.size( ), 3u );
+    EXPECT_EQ( bus.iTransfers[ 0 ].iDeviceAddress, 2 );
+    EXPECT_EQ( bus.iTransfers[ 1 ].iDeviceAddress, 0 );
+    EXPECT_EQ( bus.iTransfers[ 2 ].iDeviceAddress, 1 );
+}
+
+TEST( I2CSchedulerTest, RejectsMalformedTransactions )
+{
+    TManualClock clock;
+    CRecordingBus bus{ clock };
+    TScheduler scheduler{ bus, clock };
+
+    std::uint8_t data[ 32 ] = { };
+    const std::uint8_t kPrefix = 0x40;
+
+    TI2CScheduledTransaction tooLong;
+    tooLong.iPrefix = &kPrefix;
+    tooLong.iPrefixLength = 1;
+    tooLong.iSource = data;
+    tooLong.iDataLength = sizeof( data );
+    EXPECT_EQ( scheduler.Submit( tooLong ), KInvalidArgumentError );
+
+    TI2CScheduledTransaction unknownClient;
+    unknownClient.iSource = data;
+    unknownClient.iDataLength = 1;
+    unknownClient.iClientId = 2;
+    EXPECT_EQ( scheduler.Submit( unknownClient ), KInvalidArgumentError );
+
+    TI2CScheduledTransaction valid;
+    valid.iSource = data;
+    valid.iDataLength = 1;
+    EXPECT_EQ( scheduler.Submit( valid ), KOk );
+    EXPECT_EQ( scheduler.Submit( valid ), KInvalidArgumentError );
+}
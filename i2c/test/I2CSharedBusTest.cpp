@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+#include <AbstractPlatform/i2c/I2CBusSimulator.hpp>
+#include <AbstractPlatform/i2c/I2CSharedBus.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr std::uint8_t kDeviceAddress = 0x50;
+
+class CSharedBusTest : public ::testing::Test
+{
+protected:
+    CSharedBusTest( )
+        : iSharedBus{ iSimulator, iClock }
+    {
+        iSimulator.Attach( kDeviceAddress, iDevice );
+        for ( int i = 0; i < 256; ++i )
+        {
+            iDevice.iRegisters[ i ] = static_cast< std::uint8_t >( i ^ 0x5A );
+        }
+    }
+
+    CSteadyClock iClock;
+    CI2CBusSimulator iSimulator;
+    CSimulatedRegisterDevice<> iDevice;
+    CI2CSharedBus< CSteadyClock > iSharedBus;
+};
+}  // namespace
+
+TEST_F( CSharedBusTest, ExecutesRestartSequence )
+{
+    const std::uint8_t kRegister = 0x10;
+    std::uint8_t data[ 2 ] = { };
+    const TI2CSegment kSegments[] = { { TI2CDirection::Write, &kRegister, nullptr, 1 },
+                                      { TI2CDirection::Read, nullptr, data, sizeof( data ) } };
+
+    TI2CSharedTransaction transaction;
+    EXPECT_EQ( iSharedBus.Submit( transaction ), KInvalidArgumentError );
+
+    transaction.iDeviceAddress = kDeviceAddress;
+    transaction.iSegments = kSegments;
+    transaction.iSegmentCount = 2;
+    ASSERT_EQ( iSharedBus.Submit( transaction ), KOk );
+    EXPECT_EQ( iSharedBus.Submit( transaction ), KInvalidArgumentError );
+    EXPECT_EQ( iSharedBus.Statistics( ).iQueueDepth, 1u );
+
+    EXPECT_EQ( iSharedBus.ProcessPending( ), 1u );
+    EXPECT_EQ( transaction.iState, TI2CTransactionState::Done );
+    EXPECT_EQ( transaction.iCompletedSegments, 2u );
+    EXPECT_EQ( data[ 0 ], 0x10 ^ 0x5A );
+    EXPECT_EQ( data[ 1 ], 0x11 ^ 0x5A );
+
+    iDevice.iPresent = false;
+    ASSERT_EQ( iSharedBus.Submit( transaction ), KOk );
+    iSharedBus.ProcessPending( );
+    EXPECT_EQ( transaction.iState, TI2CTransactionState::Failed );
+    EXPECT_EQ( transaction.iResult, KGenericError );
+    EXPECT_EQ( transaction.iCompletedSegments, 0u );
+
+    const auto statistics = iSharedBus.Statistics( );
+    EXPECT_EQ( statistics.iQueueDepth, 0u );
+    EXPECT_EQ( statistics.iMaxQueueDepth, 1u );
+    EXPECT_EQ( statistics.iTransactions, 2u );
+    EXPECT_EQ( statistics.iFailedTransactions, 1u );
+}
+
+TEST_F( CSharedBusTest, ClientDefersRestartSequence )
+{
+    CI2CSharedBusClient< CSteadyClock, 2 > client{ iSharedBus };
+    std::atomic< bool > stop{ false };
+    std::thread owner( [ this, &stop ]( ) { iSharedBus.Run( stop ); } );
+
+    const std::uint8_t kRegister = 0x20;
+    std::uint8_t data = 0;
+    EXPECT_EQ( client.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( client.Read( kDeviceAddress, &data, 1, false ), 1 );
+    EXPECT_EQ( data, 0x20 ^ 0x5A );
+
+    EXPECT_EQ( client.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( client.Read( kDeviceAddress + 1, &data, 1, false ), KGenericError );
+
+    EXPECT_EQ( client.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( client.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+    EXPECT_EQ( client.Read( kDeviceAddress, &data, 1, false ), KGenericError );
+
+    stop = true;
+    owner.join( );
+    EXPECT_EQ( iSharedBus.Statistics( ).iTransactions, 1u );
+}
+
+TEST_F( CSharedBusTest, WakesIdleOwner )
+{
+    CI2CSharedBusClient< CSteadyClock > client{ iSharedBus };
+    std::atomic< bool > stop{ false };
+    std::thread owner( [ this, &stop ]( ) { iSharedBus.Run( stop ); } );
+
+    // The owner thread runs out of the idle spins and sleeps before the transfers.
+    const std::uint8_t kRegister = 0x30;
+    std::uint8_t data = 0;
+    for ( int i = 0; i < 3; ++i )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds{ 2 } );
+        EXPECT_EQ( client.Write( kDeviceAddress, &kRegister, 1, true ), 1 );
+        EXPECT_EQ( client.Read( kDeviceAddress, &data, 1, false ), 1 );
+        EXPECT_EQ( data, 0x30 ^ 0x5A );
+    }
+
+    stop = true;
+    owner.join( );
+    EXPECT_EQ( iSharedBus.Statistics( ).iTransactions, 3u );
+}
+
+TEST_F( CSharedBusTest, ConcurrentClients )
+{
+    constexpr int kClients = 8;
+    constexpr int kReads = 200;
+
+    std::atomic< bool > stop{ false };
+    std::thread owner( [ this, &stop ]( ) { iSharedBus.Run( stop ); } );
+
+    std::atomic< int > errors{ 0 };
+    std::vector< std::thread > clients;
+    for ( int index = 0; index < kClients; ++index )
+    {
+        clients.emplace_back( [ this, &errors, index ]( ) {
+            CI2CSharedBusClient< CSteadyClock > client{ iSharedBus };
+            CI2CBus i2cBus{ client };
+            for ( int read = 0; read < kReads; ++read )
+            {
+                const std::uint8_t kRegister = static_cast< std::uint8_t >( index * 16 + read % 16 );
+                std::uint8_t data[ 3 ] = { };
+                if ( i2cBus.Write( kDeviceAddress, &kRegister, 1, true ) != 1
+                     || i2cBus.Read( kDeviceAddress, data, sizeof( data ), false ) != 3 )
+                {
+                    ++errors;
+                    continue;
+                }
+                for ( int i = 0; i < 3; ++i )
+                {
+                    errors += data[ i ] != ( static_cast< std::uint8_t >( kRegister + i ) ^ 0x5A );
+                }
+            }
+        } );
+    }
+    for ( auto& client : clients )
+    {
+        client.join( );
+    }
+    stop = true;
+    owner.join( );
+
+    EXPECT_EQ( errors, 0 );
+    const auto statistics = iSharedBus.Statistics( );
+    EXPECT_EQ( statistics.iTransactions, static_cast< std::uint64_t >( kClients * kReads ) );
+    EXPECT_EQ( statistics.iQueueDepth, 0u );
+    EXPECT_GE( statistics.iMaxQueueDepth, 1u );
+    EXPECT_GE( statistics.iMaxWaitTime * kClients * kReads, statistics.iTotalWaitTime );
+}
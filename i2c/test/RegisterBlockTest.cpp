@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+#include <AbstractPlatform/i2c/RegisterBlock.hpp>
+
+#include "RegisterFileBus.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr std::uint8_t kDeviceAddress = 0x19;
+
+struct TAcceleration
+{
+    std::int16_t iX;
+    std::int16_t iY;
+    std::int16_t iZ;
+};
+
+using TBigEndianAccelerationBlock
+    = TRegisterBlock< TAcceleration,
+                      TRegisterBlockField< &TAcceleration::iX, Endianness::Big >,
+                      TRegisterBlockField< &TAcceleration::iY, Endianness::Big >,
+                      TRegisterBlockField< &TAcceleration::iZ, Endianness::Big > >;
+
+struct TClimate
+{
+    std::uint8_t iStatus;
+    std::uint32_t iPressure;
+    std::uint16_t iTemperature[ 2 ];
+};
+
+using TMixedClimateBlock
+    = TRegisterBlock< TClimate,
+                      TRegisterBlockField< &TClimate::iStatus >,
+                      TRegisterBlockPadding< 1 >,
+                      TRegisterBlockField< &TClimate::iPressure, Endianness::Little >,
+                      TRegisterBlockField< &TClimate::iTemperature, Endianness::Big > >;
+}  // namespace
+
+TEST( RegisterBlockTest, WireSize )
+{
+    static_assert( TBigEndianAccelerationBlock::kSize == 6 );
+    static_assert( TMixedClimateBlock::kSize == 10 );
+}
+
+TEST( RegisterBlockTest, BurstReadIsSingleTransfer )
+{
+    CRegisterFileBus bus{ kDeviceAddress };
+    const std::uint8_t kAcceleration[] = { 0x01, 0x02, 0xFF, 0xFE, 0x80, 0x00 };
+    std::memcpy( bus.iRegisters + 0x28, kAcceleration, sizeof( kAcceleration ) );
+
+    CI2CBus i2cBus{ bus };
+    TAcceleration acceleration{ };
+    EXPECT_TRUE( i2cBus.ReadRegisterBlock< TBigEndianAccelerationBlock >(
+        kDeviceAddress, std::uint8_t{ 0x28 }, acceleration ) );
+
+    EXPECT_EQ( bus.iWriteCount, 1u );
+    EXPECT_EQ( bus.iReadCount, 1u );
+    EXPECT_EQ( acceleration.iX, 0x0102 );
+    EXPECT_EQ( acceleration.iY, -2 );
+    EXPECT_EQ( acceleration.iZ, -32768 );
+}
+
+TEST( RegisterBlockTest, MixedEndiannessWithPadding )
+{
+    CRegisterFileBus bus{ kDeviceAddress };
+    const std::uint8_t kClimate[] = { 0x5A, 0xEE, 0x78, 0x56, 0x34, 0x12, 0x0A, 0x0B, 0x0C, 0x0D };
+    std::memcpy( bus.iRegisters + 0xF0, kClimate, sizeof( kClimate ) );
+
+    CI2CBus i2cBus{ bus };
+    TClimate climate{ };
+    EXPECT_TRUE( i2cBus.ReadRegisterBlock< TMixedClimateBlock >( kDeviceAddress,
+                                                                 std::uint8_t{ 0xF0 }, climate ) );
+
+    EXPECT_EQ( climate.iStatus, 0x5A );
+    EXPECT_EQ( climate.iPressure, 0x12345678u );
+    EXPECT_EQ( climate.iTemperature[ 0 ], 0x0A0B );
+    EXPECT_EQ( climate.iTemperature[ 1 ], 0x0C0D );
+}
+
+TEST( RegisterBlockTest, FailedTransferLeavesBlockUntouched )
+{
+    CRegisterFileBus bus{ kDeviceAddress };
+    CI2CBus i2cBus{ bus };
+    TAcceleration acceleration{ 1, 2, 3 };
+    EXPECT_FALSE( i2cBus.ReadRegisterBlock< TBigEndianAccelerationBlock >(
+        kDeviceAddress + 1, std::uint8_t{ 0x28 }, acceleration ) );
+
+    EXPECT_EQ( acceleration.iX, 1 );
+    EXPECT_EQ( acceleration.iY, 2 );
+    EXPECT_EQ( acceleration.iZ, 3 );
+}
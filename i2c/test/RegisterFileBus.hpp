@@ -0,0 +1,64 @@
+#pragma once
+
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+
+#include <cstdint>
+
+namespace AbstractPlatform
+{
+/**
+ * @brief The test bus emulating a single device with 8-bit register addresses and the register
+ * address auto-increment.
+ */
+class CRegisterFileBus : public IAbstractI2CBus
+{
+public:
+    explicit CRegisterFileBus( std::uint8_t aDeviceAddress )
+        : iDeviceAddress{ aDeviceAddress }
+    {
+    }
+
+    int
+    Write( std::uint8_t aDeviceAddress,
+           const std::uint8_t* aDataSource,
+           size_t aDataLength,
+           bool /*aNoStop*/ ) NOEXCEPT override
+    {
+        ++iWriteCount;
+        if ( aDeviceAddress != iDeviceAddress || aDataLength == 0 )
+        {
+            return KGenericError;
+        }
+        iRegisterAddress = aDataSource[ 0 ];
+        for ( size_t i = 1; i < aDataLength; ++i )
+        {
+            iRegisters[ iRegisterAddress++ ] = aDataSource[ i ];
+        }
+        return static_cast< int >( aDataLength );
+    }
+
+    int
+    Read( std::uint8_t aDeviceAddress,
+          std::uint8_t* aDataDestination,
+          size_t aDataLength,
+          bool /*aNoStop*/ ) NOEXCEPT override
+    {
+        ++iReadCount;
+        if ( aDeviceAddress != iDeviceAddress )
+        {
+            return KGenericError;
+        }
+        for ( size_t i = 0; i < aDataLength; ++i )
+        {
+            aDataDestination[ i ] = iRegisters[ iRegisterAddress++ ];
+        }
+        return static_cast< int >( aDataLength );
+    }
+
+    const std::uint8_t iDeviceAddress;
+    std::uint8_t iRegisters[ 256 ] = { };
+    std::uint8_t iRegisterAddress = 0;
+    size_t iWriteCount = 0;
+    size_t iReadCount = 0;
+};
+}  // namespace AbstractPlatform
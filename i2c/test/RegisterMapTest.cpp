@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+#include <AbstractPlatform/i2c/RegisterMap.hpp>
+
+#include "RegisterFileBus.hpp"
+
+#include <cstdint>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr std::uint8_t kDeviceAddress = 0x76;
+
+enum class TOutputDataRate : std::uint8_t
+{
+    PowerDown = 0,
+    Hz100 = 5,
+    Hz400 = 7
+};
+
+using TMap = TRegisterMap< std::uint8_t >;
+using TWhoAmI = TMap::TRegister< 0x0F, std::uint8_t, TRegisterAccess::ReadOnly >;
+using TCtrl1 = TMap::TRegister< 0x20, std::uint8_t >;
+using TRate = TRegisterField< TCtrl1, 4, 4, TOutputDataRate >;
+using TLowPower = TRegisterField< TCtrl1, 3 >;
+using TAxes = TRegisterField< TCtrl1, 0, 3 >;
+using TThreshold = TMap::TRegister< 0x30, std::uint16_t >;
+using TThresholdValue = TRegisterField< TThreshold, 0, 16 >;
+using TReset = TMap::TRegister< 0x40, std::uint8_t, TRegisterAccess::WriteOnly >;
+using TResetCode = TRegisterField< TReset, 0, 8 >;
+using TResetLow = TRegisterField< TReset, 0, 4 >;
+}  // namespace
+
+TEST( RegisterMapTest, FieldAccessors )
+{
+    static_assert( TRate::kMask == 0xF0 );
+    static_assert( TLowPower::kMask == 0x08 );
+    static_assert( TAxes::kMask == 0x07 );
+    static_assert( TThresholdValue::kMask == 0xFFFF );
+
+    static_assert( TRate::Get( 0x5F ) == TOutputDataRate::Hz100 );
+    static_assert( TRate::Set( 0x0F, TOutputDataRate::Hz400 ) == 0x7F );
+    static_assert( TLowPower::Get( 0x08 ) );
+    static_assert( TLowPower::Set( 0xFF, false ) == 0xF7 );
+    static_assert( TAxes::Set( 0xF0, 0xFF ) == 0xF7 );
+    static_assert( TAxes::Get( 0xF5 ) == 0x05 );
+
+    static_assert( !TWhoAmI::IsWritable( ) );
+    static_assert( TCtrl1::IsReadable( ) && TCtrl1::IsWritable( ) );
+}
+
+TEST( RegisterMapTest, UpdateAccumulation )
+{
+    constexpr auto update = TRegisterUpdate< TCtrl1 >{ }
+                                .Set< TRate >( TOutputDataRate::Hz100 )
+                                .Set< TLowPower >( true );
+    static_assert( update.iMask == 0xF8 );
+    static_assert( update.Apply( 0x07 ) == 0x5F );
+    static_assert( !update.IsComplete( ) );
+
+    constexpr auto completeUpdate = TRegisterUpdate< TCtrl1 >{ }
+                                        .Set< TRate >( TOutputDataRate::PowerDown )
+                                        .Set< TLowPower >( false )
+                                        .Set< TAxes >( 7 );
+    static_assert( completeUpdate.IsComplete( ) );
+}
+
+TEST( RegisterMapTest, ReadAndWriteBigEndianRegister )
+{
+    CRegisterFileBus bus{ kDeviceAddress };
+    CI2CBus i2cBus{ bus };
+
+    EXPECT_TRUE( i2cBus.WriteRegister< TThreshold >( kDeviceAddress, 0x1234 ) );
+    EXPECT_EQ( bus.iRegisters[ 0x30 ], 0x12 );
+    EXPECT_EQ( bus.iRegisters[ 0x31 ], 0x34 );
+
+    const auto threshold = i2cBus.ReadRegister< TThreshold >( kDeviceAddress );
+    ASSERT_TRUE( threshold );
+    EXPECT_EQ( threshold.Value( ), 0x1234 );
+}
+
+TEST( RegisterMapTest, PartialUpdateIsSingleWrite )
+{
+    CRegisterFileBus bus{ kDeviceAddress };
+    bus.iRegisters[ 0x20 ] = 0x07;
+    CI2CBus i2cBus{ bus };
+
+    EXPECT_TRUE( i2cBus.UpdateRegister( kDeviceAddress, TRegisterUpdate< TCtrl1 >{ }
+                                                            .Set< TRate >( TOutputDataRate::Hz400 )
+                                                            .Set< TLowPower >( true ) ) );
+    EXPECT_EQ( bus.iRegisters[ 0x20 ], 0x7F );
+    EXPECT_EQ( bus.iReadCount, 1u );
+    EXPECT_EQ( bus.iWriteCount, 2u );
+
+    const auto rate = i2cBus.ReadField< TRate >( kDeviceAddress );
+    ASSERT_TRUE( rate );
+    EXPECT_EQ( rate.Value( ), TOutputDataRate::Hz400 );
+}
+
+TEST( RegisterMapTest, CompleteUpdateSkipsRead )
+{
+    CRegisterFileBus bus{ kDeviceAddress };
+    CI2CBus i2cBus{ bus };
+
+    EXPECT_TRUE( i2cBus.UpdateRegister( kDeviceAddress, TRegisterUpdate< TCtrl1 >{ }
+                                                            .Set< TRate >( TOutputDataRate::Hz100 )
+                                                            .Set< TLowPower >( false )
+                                                            .Set< TAxes >( 7 ) ) );
+    EXPECT_EQ( bus.iRegisters[ 0x20 ], 0x57 );
+    EXPECT_EQ( bus.iReadCount, 0u );
+    EXPECT_EQ( bus.iWriteCount, 1u );
+}
+
+TEST( RegisterMapTest, WriteOnlyRegisterUpdate )
+{
+    CRegisterFileBus bus{ kDeviceAddress };
+    CI2CBus i2cBus{ bus };
+
+    EXPECT_TRUE( i2cBus.UpdateRegister( kDeviceAddress,
+                                        TRegisterUpdate< TReset >{ }.Set< TResetCode >( 0xB6 ) ) );
+    EXPECT_EQ( bus.iRegisters[ 0x40 ], 0xB6 );
+    EXPECT_EQ( bus.iReadCount, 0u );
+
+    EXPECT_EQ( i2cBus
+                   .UpdateRegister( kDeviceAddress,
+                                    TRegisterUpdate< TReset >{ }.Set< TResetLow >( 0x3 ) )
+                   .Error( ),
+               KInvalidArgumentError );
+    EXPECT_EQ( bus.iRegisters[ 0x40 ], 0xB6 );
+    EXPECT_EQ( bus.iWriteCount, 1u );
+}
+
+TEST( RegisterMapTest, ShadowUpdateSkipsRedundantWrite )
+{
+    CRegisterFileBus bus{ kDeviceAddress };
+    CI2CBus i2cBus{ bus };
+    std::uint8_t shadow = 0;
+
+    const auto update = TRegisterUpdate< TCtrl1 >{ }.Set< TAxes >( 5 );
+    EXPECT_TRUE( i2cBus.UpdateRegister( kDeviceAddress, update, shadow ) );
+    EXPECT_TRUE( i2cBus.UpdateRegister( kDeviceAddress, update, shadow ) );
+
+    EXPECT_EQ( shadow, 0x05 );
+    EXPECT_EQ( bus.iRegisters[ 0x20 ], 0x05 );
+    EXPECT_EQ( bus.iReadCount, 0u );
+    EXPECT_EQ( bus.iWriteCount, 1u );
+}
+
+TEST( RegisterMapTest, FailedTransferReturnsError )
+{
+    CRegisterFileBus bus{ kDeviceAddress };
+    CI2CBus i2cBus{ bus };
+
+    EXPECT_EQ( i2cBus.ReadField< TRate >( kDeviceAddress + 1 ).Error( ), KGenericError );
+    const auto write
+        = i2cBus.WriteRegisterRaw( kDeviceAddress + 1, std::uint8_t{ 0x20 }, std::uint8_t{ 1 } );
+    EXPECT_EQ( write.Error( ), KGenericError );
+    EXPECT_TRUE(
+        i2cBus.WriteRegisterRaw( kDeviceAddress, std::uint8_t{ 0x20 }, std::uint8_t{ 1 } ) );
+
+    const auto raw
+        = i2cBus.ReadRegisterRaw< std::uint8_t >( kDeviceAddress, std::uint8_t{ 0x20 } );
+    ASSERT_TRUE( raw );
+    EXPECT_EQ( raw.Value( ), 1 );
+    EXPECT_EQ( bus.iReadCount, 1u );
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/LookupTable.hpp>
 #include <cstdint>
 #include <cassert>
 
@@ -60,6 +61,18 @@ struct TRGBPixel
     }
 };
 
+/**
+ * @brief Applies the gamma correction of taNumerator / taDenominator to the pixel through the
+ * table generated at build time (see TGammaTable).
+ */
+template < std::uint32_t taNumerator = 22, std::uint32_t taDenominator = 10 >
+constexpr TRGBPixel
+GammaCorrect( TRGBPixel aPixel )
+{
+    const auto& table = TGammaTable< taNumerator, taDenominator >::kEntries;
+    return TRGBPixel{ table[ aPixel.iRed ], table[ aPixel.iGreen ], table[ aPixel.iBlue ] };
+}
+
 struct TPosition
 {
     int iX = 0;
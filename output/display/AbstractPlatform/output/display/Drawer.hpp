@@ -1,6 +1,7 @@
 #pragma once
 
 #include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/Profiling.hpp>
 #include <AbstractPlatform/output/display/AbstractDisplay.hpp>
 
 #include <cstdint>
@@ -28,6 +29,7 @@ public:
     inline void
     Clear( )
     {
+        PROFILE_SCOPE( "display.clear" );
         iCanvas.Clear( );
     }
 
@@ -39,6 +41,7 @@ public:
     void
     FillWith( TPixel aPixelValue )
     {
+        PROFILE_SCOPE( "display.fill" );
         iCanvas.FillWith( aPixelValue );
     }
 
@@ -55,6 +58,7 @@ public:
     void
     DrawLine( int aFromX, int aFromY, int aToX, int aToY, TPixel aPixelValue = TPixel{ true } )
     {
+        PROFILE_SCOPE( "display.draw_line" );
         assert( aFromX >= 0 );
         assert( aToX >= 0 );
         assert( aFromY >= 0 );
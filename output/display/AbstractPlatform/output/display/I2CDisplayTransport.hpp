@@ -0,0 +1,257 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/common/ErrorCode.hpp>
+#include <AbstractPlatform/i2c/AbstractI2C.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace AbstractPlatform
+{
+/// @brief The range of the framebuffer bytes.
+struct TByteRange
+{
+    size_t iOffset = 0;
+    size_t iLength = 0;
+};
+
+/**
+ * @brief The framebuffer in the display controller memory layout, preceded by the headroom the
+ * CI2CDisplayTransport puts the transfer prefix into.
+ *
+ * @tparam taLength The framebuffer length in bytes.
+ * @tparam taHeadroom The maximum length of the transfer prefix.
+ */
+template < size_t taLength, size_t taHeadroom = 1 >
+struct TI2CFramebuffer
+{
+    static constexpr size_t kLength = taLength;
+    static constexpr size_t kHeadroom = taHeadroom;
+
+    std::uint8_t*
+    Data( ) NOEXCEPT
+    {
+        return iStorage + taHeadroom;
+    }
+
+    const std::uint8_t*
+    Data( ) const NOEXCEPT
+    {
+        return iStorage + taHeadroom;
+    }
+
+    std::uint8_t iStorage[ taHeadroom + taLength ] = { };
+};
+
+/**
+ * @brief The display controller specific addressing of the framebuffer range (e.g. the column and
+ * page address commands of the SSD1306), issued before the range is sent.
+ */
+class IAbstractDisplayAddressing
+{
+public:
+    virtual ~IAbstractDisplayAddressing( ) = default;
+
+    /**
+     * @brief Makes the controller store the following data starting from the framebuffer byte
+     * aOffset.
+     *
+     * @return true If operation succeed, otherwise - false
+     */
+    virtual bool SelectRange( size_t aOffset, size_t aLength ) NOEXCEPT = 0;
+};
+
+/**
+ * @brief Streams the framebuffer ranges to the I2C display controller.
+ *
+ * The ranges are split into transfers of at most the bus maximum transfer length, each starting
+ * with the controller data prefix (e.g. the 0x40 control byte of the SSD1306). The prefix is
+ * written in place into the bytes preceding the chunk, which are restored after the transfer, so
+ * the framebuffer is never copied. The framebuffer therefore has to be preceded by at least
+ * taMaxPrefixLength writable bytes (see TI2CFramebuffer).
+ *
+ * @tparam taMaxPrefixLength The maximum length of the data prefix.
+ */
+template < size_t taMaxPrefixLength = 1 >
+class CI2CDisplayTransport
+{
+public:
+    static_assert( taMaxPrefixLength > 0, "taMaxPrefixLength has to be > 0" );
+
+    /**
+     * @param aI2CBus The bus the display is attached to.
+     * @param aDeviceAddress The display controller address.
+     * @param aMaxTransferLength The maximum length of the single bus transfer, the prefix
+     * included. Has to leave room for at least one data byte after the prefix, otherwise Push()
+     * fails with KInvalidArgumentError.
+     */
+    CI2CDisplayTransport( IAbstractI2CBus& aI2CBus,
+                          std::uint8_t aDeviceAddress,
+                          size_t aMaxTransferLength )
+        : iI2CBus{ aI2CBus }
+        , iDeviceAddress{ aDeviceAddress }
+        , iMaxTransferLength{ aMaxTransferLength }
+    {
+    }
+
+    /**
+     * @brief Sets the prefix every data transfer starts with.
+     *
+     * @return TErrorCode KOk on success, KInvalidArgumentError if the prefix is too long.
+     */
+    TErrorCode
+    SetDataPrefix( const std::uint8_t* aPrefix, size_t aPrefixLength ) NOEXCEPT
+    {
+        if ( aPrefixLength > taMaxPrefixLength || aPrefixLength >= iMaxTransferLength )
+        {
+            return KInvalidArgumentError;
+        }
+        std::memcpy( iPrefix, aPrefix, aPrefixLength );
+        iPrefixLength = aPrefixLength;
+        return KOk;
+    }
+
+    /**
+     * @brief Sets the addressing issued before every range, or nullptr if the controller
+     * auto-increments through the whole framebuffer.
+     */
+    void
+    SetAddressing( IAbstractDisplayAddressing* aAddressing ) NOEXCEPT
+    {
+        iAddressing = aAddressing;
+    }
+
+    /**
+     * @brief Sets the length of the gap between the ranges that is sent rather than addressed
+     * anew. Resending a few unchanged bytes is cheaper than the addressing commands.
+     */
+    void
+    SetMergeGap( size_t aMergeGap ) NOEXCEPT
+    {
+        iMergeGap = aMergeGap;
+    }
+
+    /**
+     * @brief Sends the whole framebuffer.
+     */
+    TErrorCode
+    Push( std::uint8_t* aFramebuffer, size_t aFramebufferLength ) NOEXCEPT
+    {
+        const TByteRange range{ 0, aFramebufferLength };
+        return Push( aFramebuffer, aFramebufferLength, &range, 1 );
+    }
+
+    /**
+     * @brief Sends the dirty ranges of the framebuffer.
+     *
+     * @param aFramebuffer The framebuffer preceded by at least taMaxPrefixLength writable bytes.
+     * Its content is unchanged when the call returns.
+     * @param aFramebufferLength The framebuffer length.
+     * @param aRanges The dirty ranges ordered by the offset.
+     * @param aRangeCount The count of the ranges.
+     * @return TErrorCode KOk on success, KInvalidArgumentError if a range is out of the
+     * framebuffer or the maximum transfer length leaves no room for the data, KGenericError if the
+     * display failed to receive the data.
+     */
+    TErrorCode
+    Push( std::uint8_t* aFramebuffer,
+          size_t aFramebufferLength,
+          const TByteRange* aRanges,
+          size_t aRangeCount ) NOEXCEPT
+    {
+        assert( aFramebuffer != nullptr );
+        if ( iMaxTransferLength <= iPrefixLength )
+        {
+            return KInvalidArgumentError;
+        }
+
+        for ( size_t index = 0; index < aRangeCount; )
+        {
+            size_t begin = aRanges[ index ].iOffset;
+            size_t end = begin + aRanges[ index ].iLength;
+            for ( ++index; index < aRangeCount && aRanges[ index ].iOffset <= end + iMergeGap;
+                  ++index )
+            {
+                const size_t rangeEnd = aRanges[ index ].iOffset + aRanges[ index ].iLength;
+                end = rangeEnd > end ? rangeEnd : end;
+            }
+
+            if ( end > aFramebufferLength || end < begin )
+            {
+                return KInvalidArgumentError;
+            }
+            if ( begin == end )
+            {
+                continue;
+            }
+            if ( iAddressing != nullptr && !iAddressing->SelectRange( begin, end - begin ) )
+            {
+                return KGenericError;
+            }
+            if ( !Send( aFramebuffer + begin, end - begin ) )
+            {
+                return KGenericError;
+            }
+        }
+        return KOk;
+    }
+
+    /// @brief The count of the bus transfers issued.
+    std::uint64_t
+    Transfers( ) const NOEXCEPT
+    {
+        return iTransfers;
+    }
+
+    /// @brief The count of the framebuffer bytes sent.
+    std::uint64_t
+    BytesSent( ) const NOEXCEPT
+    {
+        return iBytesSent;
+    }
+
+private:
+    bool
+    Send( std::uint8_t* aData, size_t aLength ) NOEXCEPT
+    {
+        // Push() guarantees the room for the data, so the loop always advances.
+        const size_t chunkLength = iMaxTransferLength - iPrefixLength;
+        for ( size_t offset = 0; offset < aLength; offset += chunkLength )
+        {
+            std::uint8_t* chunk = aData + offset;
+            const size_t length = aLength - offset < chunkLength ? aLength - offset : chunkLength;
+
+            std::uint8_t saved[ taMaxPrefixLength ];
+            std::memcpy( saved, chunk - iPrefixLength, iPrefixLength );
+            std::memcpy( chunk - iPrefixLength, iPrefix, iPrefixLength );
+
+            const size_t transferLength = iPrefixLength + length;
+            const int result
+                = iI2CBus.Write( iDeviceAddress, chunk - iPrefixLength, transferLength, false );
+
+            std::memcpy( chunk - iPrefixLength, saved, iPrefixLength );
+
+            ++iTransfers;
+            if ( result != static_cast< int >( transferLength ) )
+            {
+                return false;
+            }
+            iBytesSent += length;
+        }
+        return true;
+    }
+
+    IAbstractI2CBus& iI2CBus;
+    const std::uint8_t iDeviceAddress;
+    const size_t iMaxTransferLength;
+    std::uint8_t iPrefix[ taMaxPrefixLength ] = { };
+    size_t iPrefixLength = 0;
+    size_t iMergeGap = 0;
+    IAbstractDisplayAddressing* iAddressing = nullptr;
+    std::uint64_t iTransfers = 0;
+    std::uint64_t iBytesSent = 0;
+};
+
+}  // namespace AbstractPlatform
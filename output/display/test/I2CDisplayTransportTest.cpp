@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/output/display/I2CDisplayTransport.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace AbstractPlatform;
+namespace
+{
+constexpr std::uint8_t kDisplayAddress = 0x3C;
+constexpr std::uint8_t kDataPrefix = 0x40;
+
+class CRecordingBus : public IAbstractI2CBus
+{
+public:
+    int
+    Write( std::uint8_t aDeviceAddress,
+           const std::uint8_t* aDataSource,
+           size_t aDataLength,
+           bool /*aNoStop*/ ) NOEXCEPT override
+    {
+        if ( aDeviceAddress != kDisplayAddress )
+        {
+            return KGenericError;
+        }
+        iTransfers.emplace_back( aDataSource, aDataSource + aDataLength );
+        return static_cast< int >( aDataLength );
+    }
+
+    int
+    Read( std::uint8_t, std::uint8_t*, size_t, bool ) NOEXCEPT override
+    {
+        return KGenericError;
+    }
+
+    std::vector< std::vector< std::uint8_t > > iTransfers;
+};
+
+class CRecordingAddressing : public IAbstractDisplayAddressing
+{
+public:
+    bool
+    SelectRange( size_t aOffset, size_t aLength ) NOEXCEPT override
+    {
+        iRanges.push_back( { aOffset, aLength } );
+        return true;
+    }
+
+    std::vector< TByteRange > iRanges;
+};
+
+class CDisplayTransportTest : public ::testing::Test
+{
+protected:
+    CDisplayTransportTest( )
+        : iTransport{ iBus, kDisplayAddress, 5 }
+    {
+        iTransport.SetDataPrefix( &kDataPrefix, 1 );
+        for ( size_t i = 0; i < TFramebuffer::kLength; ++i )
+        {
+            iFramebuffer.Data( )[ i ] = static_cast< std::uint8_t >( i );
+        }
+    }
+
+    using TFramebuffer = TI2CFramebuffer< 16 >;
+
+    CRecordingBus iBus;
+    TFramebuffer iFramebuffer;
+    CI2CDisplayTransport<> iTransport;
+};
+}  // namespace
+
+TEST_F( CDisplayTransportTest, ChunksWholeFramebuffer )
+{
+    ASSERT_EQ( iTransport.Push( iFramebuffer.Data( ), TFramebuffer::kLength ), KOk );
+
+    ASSERT_EQ( iBus.iTransfers.size( ), 4u );
+    EXPECT_EQ( iBus.iTransfers[ 0 ], ( std::vector< std::uint8_t >{ 0x40, 0, 1, 2, 3 } ) );
+    EXPECT_EQ( iBus.iTransfers[ 1 ], ( std::vector< std::uint8_t >{ 0x40, 4, 5, 6, 7 } ) );
+    EXPECT_EQ( iBus.iTransfers[ 3 ], ( std::vector< std::uint8_t >{ 0x40, 12, 13, 14, 15 } ) );
+    EXPECT_EQ( iTransport.BytesSent( ), 16u );
+
+    // The bytes the prefix was patched into are restored
+    EXPECT_EQ( iFramebuffer.iStorage[ 0 ], 0 );
+    for ( size_t i = 0; i < TFramebuffer::kLength; ++i )
+    {
+        EXPECT_EQ( iFramebuffer.Data( )[ i ], i );
+    }
+}
+
+TEST_F( CDisplayTransportTest, DirtyRanges )
+{
+    CRecordingAddressing addressing;
+    iTransport.SetAddressing( &addressing );
+    iTransport.SetMergeGap( 1 );
+
+    const TByteRange kRanges[] = { { 1, 2 }, { 4, 1 }, { 8, 2 }, { 9, 3 } };
+    ASSERT_EQ( iTransport.Push( iFramebuffer.Data( ), TFramebuffer::kLength, kRanges, 4 ), KOk );
+
+    ASSERT_EQ( addressing.iRanges.size( ), 2u );
+    EXPECT_EQ( addressing.iRanges[ 0 ].iOffset, 1u );
+    EXPECT_EQ( addressing.iRanges[ 0 ].iLength, 4u );
+    EXPECT_EQ( addressing.iRanges[ 1 ].iOffset, 8u );
+    EXPECT_EQ( addressing.iRanges[ 1 ].iLength, 4u );
+
+    ASSERT_EQ( iBus.iTransfers.size( ), 2u );
+    EXPECT_EQ( iBus.iTransfers[ 0 ], ( std::vector< std::uint8_t >{ 0x40, 1, 2, 3, 4 } ) );
+    EXPECT_EQ( iBus.iTransfers[ 1 ], ( std::vector< std::uint8_t >{ 0x40, 8, 9, 10, 11 } ) );
+    EXPECT_EQ( iFramebuffer.Data( )[ 7 ], 7 );
+}
+
+TEST_F( CDisplayTransportTest, Errors )
+{
+    const std::uint8_t kLongPrefix[] = { 0x00, 0x40 };
+    EXPECT_EQ( iTransport.SetDataPrefix( kLongPrefix, 2 ), KInvalidArgumentError );
+
+    const TByteRange kRange{ 10, 7 };
+    EXPECT_EQ( iTransport.Push( iFramebuffer.Data( ), TFramebuffer::kLength, &kRange, 1 ),
+               KInvalidArgumentError );
+
+    CI2CDisplayTransport<> transport{ iBus, kDisplayAddress + 1, 5 };
+    EXPECT_EQ( transport.Push( iFramebuffer.Data( ), TFramebuffer::kLength ), KGenericError );
+    EXPECT_EQ( transport.Transfers( ), 1u );
+
+    // No room for the data after the prefix
+    CI2CDisplayTransport<> emptyTransport{ iBus, kDisplayAddress, 0 };
+    EXPECT_EQ( emptyTransport.Push( iFramebuffer.Data( ), TFramebuffer::kLength ),
+               KInvalidArgumentError );
+    EXPECT_EQ( emptyTransport.Transfers( ), 0u );
+}
@@ -0,0 +1,391 @@
+#pragma once
+
+#include <AbstractPlatform/common/Platform.hpp>
+#include <AbstractPlatform/tensor/StaticTensorIterator.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace AbstractPlatform::Tensor
+{
+/// @brief The minimal alignment of the TStaticTensor storage: the 128-bit vector register width
+/// (SSE, NEON), so the compiler may use the aligned vector loads over the whole tensor.
+static constexpr size_t KStaticTensorAlignment = 16;
+
+/**
+ * @brief The view of taSize contiguous elements.
+ */
+template < typename taValue, size_t taSize >
+class TStaticTensorSpan
+{
+public:
+    constexpr explicit TStaticTensorSpan( taValue* aData ) NOEXCEPT
+        : iData{ aData }
+    {
+    }
+
+    static constexpr size_t
+    Size( ) NOEXCEPT
+    {
+        return taSize;
+    }
+
+    constexpr taValue*
+    Data( ) const NOEXCEPT
+    {
+        return iData;
+    }
+
+    constexpr taValue&
+    operator[]( size_t aIndex ) const NOEXCEPT
+    {
+        assert( aIndex < taSize );
+        return iData[ aIndex ];
+    }
+
+    constexpr taValue*
+    begin( ) const NOEXCEPT
+    {
+        return iData;
+    }
+
+    constexpr taValue*
+    end( ) const NOEXCEPT
+    {
+        return iData + taSize;
+    }
+
+private:
+    taValue* iData;
+};
+
+namespace Detail
+{
+template < typename taTag, size_t taIndex, typename... taDimension >
+struct TDimensionIndexOfTag;
+
+template < typename taTag, size_t taIndex, typename taFirst, typename... taRest >
+struct TDimensionIndexOfTag< taTag, taIndex, taFirst, taRest... >
+    : std::conditional_t< std::is_same< typename taFirst::TTag, taTag >::value,
+                          std::integral_constant< size_t, taIndex >,
+                          TDimensionIndexOfTag< taTag, taIndex + 1, taRest... > >
+{
+};
+
+template < typename taTag, size_t taIndex >
+struct TDimensionIndexOfTag< taTag, taIndex >
+{
+    static_assert( !std::is_same< taTag, taTag >::value, "The tensor has no dimension of the tag" );
+};
+}  // namespace Detail
+
+/**
+ * @brief The tensor of the elements stored contiguously in place.
+ *
+ * The layout is the one of TStaticTensorIterator: the first dimension varies fastest, the
+ * element ( i0, i1, ... ) is at i0 * Stride< 0 >( ) + i1 * Stride< 1 >( ) + ..., where
+ * Stride< 0 >( ) = 1 and Stride< n >( ) = SubTensorSize< n - 1 >( ). The storage is aligned to
+ * kAlignment and the strides are compile-time constants, so the loops over Span( ) and Line( )
+ * vectorize.
+ *
+ * @tparam taValue The element type.
+ * @tparam taDimension The TStaticDimension list with the distinct tags, ordered from the fastest
+ * varying dimension to the slowest one.
+ */
+template < typename taValue, typename... taDimension >
+class TStaticTensor
+{
+    static_assert( sizeof...( taDimension ) > 0, "The tensor needs at least one dimension" );
+
+    using TDimensionIndexes = std::index_sequence_for< taDimension... >;
+
+    template < typename taTag >
+    using TDimensionOfTag = std::tuple_element_t<
+        Detail::TDimensionIndexOfTag< taTag, 0, taDimension... >::value,
+        std::tuple< taDimension... > >;
+
+    static constexpr size_t kLineSize
+        = std::tuple_element_t< 0, std::tuple< taDimension... > >::Size( );
+
+public:
+    using TValue = taValue;
+    using TSize = size_t;
+    using TIterator = TStaticTensorIterator< taDimension... >;
+    using TDimensionList = std::tuple< taDimension... >;
+
+    static constexpr size_t kAlignment
+        = alignof( taValue ) > KStaticTensorAlignment ? alignof( taValue ) : KStaticTensorAlignment;
+
+    constexpr TStaticTensor( ) = default;
+
+    /**
+     * @brief Constructs the tensor of the elements in the storage order.
+     */
+    constexpr explicit TStaticTensor( const taValue ( &aValues )[ TIterator::Size( ) ] )
+    {
+        for ( size_t offset = 0; offset < Size( ); ++offset )
+        {
+            iData[ offset ] = aValues[ offset ];
+        }
+    }
+
+    /**
+     * @brief Returns the tensor with every element equal to aValue.
+     */
+    static constexpr TStaticTensor
+    Filled( const taValue& aValue )
+    {
+        TStaticTensor tensor;
+        for ( auto& element : tensor.iData )
+        {
+            element = aValue;
+        }
+        return tensor;
+    }
+
+    /**
+     * @brief Returns the tensor with the element ( i0, i1, ... ) equal to
+     * aGenerator( i0, i1, ... ). Used in the constant expressions to generate the tensors at build
+     * time.
+     */
+    template < typename taGenerator >
+    static constexpr TStaticTensor
+    Generate( taGenerator aGenerator )
+    {
+        TStaticTensor tensor;
+        for ( size_t offset = 0; offset < Size( ); ++offset )
+        {
+            tensor.iData[ offset ] = GenerateAt( aGenerator, offset, TDimensionIndexes{ } );
+        }
+        return tensor;
+    }
+
+    static constexpr size_t
+    DimentsionCount( )
+    {
+        return TIterator::DimentsionCount( );
+    }
+
+    /**
+     * @brief Returns tensor's cardinality (total number of elements).
+     *
+     * @return constexpr TSize  Tensor's cardinality.
+     */
+    static constexpr TSize
+    Size( )
+    {
+        return TIterator::Size( );
+    }
+
+    template < size_t taDimentsionIndex >
+    static constexpr TSize
+    SubTensorSize( )
+    {
+        return TIterator::template SubTensorSize< taDimentsionIndex >( );
+    }
+
+    /**
+     * @brief Returns the distance in elements between the neighbouring positions of the dimension.
+     */
+    template < size_t taDimentsionIndex >
+    static constexpr TSize
+    Stride( )
+    {
+        static_assert( taDimentsionIndex < DimentsionCount( ),
+                       "The taDimentsionIndex must be less than kDimentsionCount" );
+
+        if constexpr ( taDimentsionIndex == 0 )
+        {
+            return 1;
+        }
+        else
+        {
+            return SubTensorSize< taDimentsionIndex - 1 >( );
+        }
+    }
+
+    /**
+     * @brief Returns the stride of the dimension of the tag.
+     */
+    template < typename taTag >
+    static constexpr TSize
+    Stride( )
+    {
+        return Stride< Detail::TDimensionIndexOfTag< taTag, 0, taDimension... >::value >( );
+    }
+
+    /**
+     * @brief Returns the offset of the element in the storage.
+     *
+     * @param aIndexes The position in every dimension, the first dimension first.
+     */
+    template < typename... taIndex >
+    static constexpr size_t
+    Offset( taIndex... aIndexes )
+    {
+        static_assert( sizeof...( taIndex ) == sizeof...( taDimension ),
+                       "The index count must match the dimension count" );
+        static_assert( ( ... && std::is_integral< taIndex >::value ) );
+
+        return OffsetImpl( TDimensionIndexes{ }, static_cast< size_t >( aIndexes )... );
+    }
+
+    /**
+     * @brief Returns the offset of the element at the positions of the dimensions, identified by
+     * their tags and given in any order.
+     */
+    template < typename... taPositionDimension >
+    static constexpr size_t
+    DimensionOffset( const taPositionDimension&... aDimensions )
+    {
+        static_assert( sizeof...( taPositionDimension ) == sizeof...( taDimension ),
+                       "The position of every dimension is required" );
+        static_assert( ( ...
+                         && ( taPositionDimension::Size( )
+                              == TDimensionOfTag< typename taPositionDimension::TTag >::Size( ) ) ),
+                       "The dimension size must match the tensor dimension of the tag" );
+
+        return ( ...
+                 + ( aDimensions.GetPosition( )
+                     * Stride< typename taPositionDimension::TTag >( ) ) );
+    }
+
+    /**
+     * @brief Returns the element at the position, the first dimension first.
+     */
+    template < typename... taIndex >
+    constexpr taValue&
+    operator( )( taIndex... aIndexes )
+    {
+        return Element( Offset( aIndexes... ) );
+    }
+
+    template < typename... taIndex >
+    constexpr const taValue&
+    operator( )( taIndex... aIndexes ) const
+    {
+        return Element( Offset( aIndexes... ) );
+    }
+
+    /**
+     * @brief Returns the element at the positions of the tag-typed dimensions.
+     */
+    template < typename... taPositionDimension >
+    constexpr taValue&
+    At( const taPositionDimension&... aDimensions )
+    {
+        return Element( DimensionOffset( aDimensions... ) );
+    }
+
+    template < typename... taPositionDimension >
+    constexpr const taValue&
+    At( const taPositionDimension&... aDimensions ) const
+    {
+        return Element( DimensionOffset( aDimensions... ) );
+    }
+
+    /**
+     * @brief Returns the element at the iterator position.
+     */
+    taValue&
+    operator[]( const TIterator& aIterator )
+    {
+        return Element( aIterator.GetPosition( ) );
+    }
+
+    const taValue&
+    operator[]( const TIterator& aIterator ) const
+    {
+        return Element( aIterator.GetPosition( ) );
+    }
+
+    constexpr taValue*
+    Data( ) NOEXCEPT
+    {
+        return iData;
+    }
+
+    constexpr const taValue*
+    Data( ) const NOEXCEPT
+    {
+        return iData;
+    }
+
+    /**
+     * @brief Returns the span over the whole storage.
+     */
+    constexpr TStaticTensorSpan< taValue, TIterator::Size( ) >
+    Span( ) NOEXCEPT
+    {
+        return TStaticTensorSpan< taValue, TIterator::Size( ) >{ iData };
+    }
+
+    constexpr TStaticTensorSpan< const taValue, TIterator::Size( ) >
+    Span( ) const NOEXCEPT
+    {
+        return TStaticTensorSpan< const taValue, TIterator::Size( ) >{ iData };
+    }
+
+    /**
+     * @brief Returns the span over the first (contiguous) dimension at the position of the other
+     * dimensions.
+     *
+     * @param aIndexes The position in every dimension but the first one.
+     */
+    template < typename... taIndex >
+    constexpr TStaticTensorSpan< taValue, kLineSize >
+    Line( taIndex... aIndexes )
+    {
+        return TStaticTensorSpan< taValue, kLineSize >{ iData + Offset( 0, aIndexes... ) };
+    }
+
+    template < typename... taIndex >
+    constexpr TStaticTensorSpan< const taValue, kLineSize >
+    Line( taIndex... aIndexes ) const
+    {
+        return TStaticTensorSpan< const taValue, kLineSize >{ iData + Offset( 0, aIndexes... ) };
+    }
+
+private:
+    constexpr taValue&
+    Element( size_t aOffset )
+    {
+        assert( aOffset < Size( ) );
+        return iData[ aOffset ];
+    }
+
+    constexpr const taValue&
+    Element( size_t aOffset ) const
+    {
+        assert( aOffset < Size( ) );
+        return iData[ aOffset ];
+    }
+
+    template < size_t... taDimensionIndex, typename... taIndex >
+    static constexpr size_t
+    OffsetImpl( std::index_sequence< taDimensionIndex... >, taIndex... aIndexes )
+    {
+        assert( ( ...
+                  && ( aIndexes
+                       < std::tuple_element_t< taDimensionIndex, TDimensionList >::Size( ) ) ) );
+        return ( ... + ( aIndexes * Stride< taDimensionIndex >( ) ) );
+    }
+
+    template < typename taGenerator, size_t... taDimensionIndex >
+    static constexpr taValue
+    GenerateAt( taGenerator& aGenerator,
+                size_t aOffset,
+                std::index_sequence< taDimensionIndex... > )
+    {
+        return aGenerator(
+            ( aOffset / Stride< taDimensionIndex >( )
+              % std::tuple_element_t< taDimensionIndex, TDimensionList >::Size( ) )... );
+    }
+
+    alignas( kAlignment ) taValue iData[ TIterator::Size( ) ] = { };
+};
+
+}  // namespace AbstractPlatform::Tensor
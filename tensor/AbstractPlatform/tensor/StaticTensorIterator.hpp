@@ -6,6 +6,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 #include <tuple>
 #include <utility>
@@ -240,6 +241,8 @@ private:
         return ( ... * std::tuple_element_t< taIndexes, TDimensionList >::Size( ) );
     }
 
+    // The member templates cannot be explicitly specialized in the class scope, so the first and
+    // the last dimensions are handled with if constexpr.
     template < size_t taIdx >
     struct Devider
     {
@@ -247,17 +250,14 @@ private:
         static constexpr size_t
         Value( )
         {
-            return TStaticDevider::SubTensorSize< taIdx - 1 >( );
-        };
-    };
-
-    template <>
-    struct Devider< 0 >
-    {
-        static constexpr size_t
-        Value( )
-        {
-            return 1;
+            if constexpr ( taIdx == 0 )
+            {
+                return 1;
+            }
+            else
+            {
+                return TStaticDevider::SubTensorSize< taIdx - 1 >( );
+            }
         };
     };
 
@@ -268,18 +268,15 @@ private:
         static constexpr size_t
         Value( )
         {
-            return std::tuple_element_t< taIdx - 1, TDimensionList >::Size( )
-                   * Multiplier< taIdx - 1 >::Value( );
-        };
-    };
-
-    template <>
-    struct Multiplier< 0 >
-    {
-        static constexpr size_t
-        Value( )
-        {
-            return 1;
+            if constexpr ( taIdx == 0 )
+            {
+                return 1;
+            }
+            else
+            {
+                return std::tuple_element_t< taIdx - 1, TDimensionList >::Size( )
+                       * Multiplier< taIdx - 1 >::Value( );
+            }
         };
     };
 
@@ -291,20 +288,16 @@ private:
         Value( )
         {
             using TStaticDimension = std::tuple_element_t< taIdx, TDimensionList >;
-            return TStaticDimension::Size( );
-        };
-    };
-
-    template <>
-    struct Module< kDimentsionCount - 1 >
-    {
-        static constexpr size_t
-        Value( )
-        {
-            using TStaticDimension = std::tuple_element_t< kDimentsionCount - 1, TDimensionList >;
-            static_assert( TStaticDimension::Size( )
-                           < std::numeric_limits< typename TStaticDimension::TSize >::max( ) );
-            return TStaticDimension::Size( ) + 1;
+            if constexpr ( taIdx + 1 == kDimentsionCount )
+            {
+                using TSize = typename TStaticDimension::TSize;
+                static_assert( TStaticDimension::Size( ) < std::numeric_limits< TSize >::max( ) );
+                return TStaticDimension::Size( ) + 1;
+            }
+            else
+            {
+                return TStaticDimension::Size( );
+            }
         };
     };
 
@@ -9,6 +9,7 @@
 #include <type_traits>
 #include <tuple>
 
+using namespace AbstractPlatform;
 using namespace AbstractPlatform::Tensor;
 namespace
 {
@@ -31,7 +32,7 @@ struct StaticDimensionTest : public testing::Test
     static constexpr auto kExpectedIterationDirection = TDimensionParameters::kIterationDirection;
 
     using TStaticDimension
-        = TStaticDimension< TSomeTag, kExpectedSize, kExpectedIterationDirection >;
+        = Tensor::TStaticDimension< TSomeTag, kExpectedSize, kExpectedIterationDirection >;
 
     static constexpr size_t
     expectedPlainPosition( size_t forwardPosition )
@@ -235,7 +236,7 @@ struct StaticTwoDimensionTensorIteratorTest : public testing::Test
 {
     using TByte = typename T::first_type;
     using TWord = typename T::second_type;
-    using TStaticTensorIterator = TStaticTensorIterator< TByte, TWord >;
+    using TStaticTensorIterator = Tensor::TStaticTensorIterator< TByte, TWord >;
 
     static constexpr size_t kByteDimensionSize = TByte::kSize;
     static constexpr size_t kWordDimensionSize = TWord::kSize;
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <AbstractPlatform/tensor/StaticTensor.hpp>
+
+#include <cstdint>
+#include <numeric>
+
+using namespace AbstractPlatform::Tensor;
+namespace
+{
+struct TChannelTag;
+struct TColumnTag;
+struct TRowTag;
+
+using TChannel = TStaticDimension< TChannelTag, 3 >;
+using TColumn = TStaticDimension< TColumnTag, 4 >;
+using TRow = TStaticDimension< TRowTag, 2 >;
+using TImage = TStaticTensor< std::int16_t, TChannel, TColumn, TRow >;
+
+constexpr TImage kImage = TImage::Generate(
+    []( size_t aChannel, size_t aColumn, size_t aRow )
+    { return static_cast< std::int16_t >( aRow * 100 + aColumn * 10 + aChannel ); } );
+
+static_assert( TImage::DimentsionCount( ) == 3 );
+static_assert( TImage::Size( ) == 24 );
+static_assert( TImage::Stride< 0 >( ) == 1 );
+static_assert( TImage::Stride< 1 >( ) == 3 );
+static_assert( TImage::Stride< 2 >( ) == 12 );
+static_assert( TImage::Stride< TRowTag >( ) == TImage::SubTensorSize< 1 >( ) );
+static_assert( TImage::Offset( 2, 3, 1 ) == 23 );
+static_assert( kImage( 1, 2, 1 ) == 121 );
+static_assert( kImage.Data( )[ 5 ] == 12 );
+static_assert( alignof( TImage ) >= KStaticTensorAlignment );
+static_assert( sizeof( TImage ) == 48 );
+}  // namespace
+
+TEST( StaticTensorTest, ElementAccess )
+{
+    TImage image;
+    EXPECT_EQ( image( 2, 3, 1 ), 0 );
+    EXPECT_EQ( reinterpret_cast< std::uintptr_t >( image.Data( ) ) % TImage::kAlignment, 0u );
+
+    image( 2, 3, 1 ) = 7;
+    EXPECT_EQ( image.Data( )[ 23 ], 7 );
+
+    const auto filled = TImage::Filled( 5 );
+    EXPECT_EQ( std::accumulate( filled.Span( ).begin( ), filled.Span( ).end( ), 0 ), 5 * 24 );
+
+    const std::int16_t values[ 24 ] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+                                        12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23 };
+    const TImage sequence{ values };
+    EXPECT_EQ( sequence( 1, 0, 1 ), 13 );
+}
+
+TEST( StaticTensorTest, AccessByTaggedDimensions )
+{
+    // The dimensions are matched by their tags, in any order and of any iteration direction.
+    TRow row;
+    TStaticDimension< TColumnTag, 4, TIterationDirection::Backward > column;
+    TChannel channel;
+    row.SetPosition( 1 );
+    column.SetPosition( 3 );
+    channel.SetPosition( 2 );
+    EXPECT_EQ( kImage.At( row, column, channel ), 132 );
+
+    TImage image;
+    image.At( channel, row, column ) = -1;
+    EXPECT_EQ( image( 2, 3, 1 ), -1 );
+}
+
+TEST( StaticTensorTest, MatchesIteratorLayout )
+{
+    TImage::TIterator iterator;
+    for ( size_t position = 0; position < TImage::Size( ); ++position )
+    {
+        iterator.SetPosition( position );
+        const auto channel = iterator.Dimension< 0 >( ).GetPosition( );
+        const auto column = iterator.Dimension< 1 >( ).GetPosition( );
+        const auto row = iterator.Dimension< 2 >( ).GetPosition( );
+
+        EXPECT_EQ( &kImage[ iterator ], &kImage( channel, column, row ) );
+        EXPECT_EQ( kImage[ iterator ], row * 100 + column * 10 + channel );
+    }
+}
+
+TEST( StaticTensorTest, Spans )
+{
+    TImage image = kImage;
+
+    const auto line = image.Line( 2, 1 );
+    static_assert( decltype( line )::Size( ) == 3 );
+    EXPECT_EQ( line.Data( ), &image( 0, 2, 1 ) );
+    EXPECT_EQ( line[ 2 ], 122 );
+
+    for ( auto& element : image.Line( 0, 0 ) )
+    {
+        element = 1;
+    }
+    EXPECT_EQ( image( 2, 0, 0 ), 1 );
+    EXPECT_EQ( image( 0, 1, 0 ), 10 );
+
+    EXPECT_EQ( image.Span( ).Size( ), TImage::Size( ) );
+    EXPECT_EQ( image.Span( ).end( ) - image.Span( ).begin( ), 24 );
+}